@@ -0,0 +1,118 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+##
+## Output:
+##
+##  $ ./taint_only_benchmark.py
+##  Recorded trace: 4099 instructions
+##  Full semantics: 7822 instructions per second
+##  Taint only    : 108281 instructions per second
+##  Tainted memory: 4096 bytes (same result)
+##
+
+import  sys
+import  time
+
+from triton import *
+
+
+# A copy loop which mixes the source buffer with rdx and rbx. The source buffer
+# is tainted, thus the destination buffer must be tainted at the end.
+#
+#     for (i = 0; i < 512; i++)
+#       dst[i] = (src[i] ^ rdx) + rbx;
+#
+SRC   = 0x100000
+DST   = 0x200000
+COUNT = 512
+
+code = {
+  0x400000: "\x48\xbe\x00\x00\x10\x00\x00\x00\x00\x00",  #   movabs  rsi, 0x100000
+  0x40000a: "\x48\xbf\x00\x00\x20\x00\x00\x00\x00\x00",  #   movabs  rdi, 0x200000
+  0x400014: "\x48\xb9\x00\x02\x00\x00\x00\x00\x00\x00",  #   movabs  rcx, 0x200
+  0x40001e: "\x48\x8b\x06",                              #   mov     rax, qword ptr [rsi]
+  0x400021: "\x48\x31\xd0",                              #   xor     rax, rdx
+  0x400024: "\x48\x01\xd8",                              #   add     rax, rbx
+  0x400027: "\x48\x89\x07",                              #   mov     qword ptr [rdi], rax
+  0x40002a: "\x48\x83\xc6\x08",                          #   add     rsi, 8
+  0x40002e: "\x48\x83\xc7\x08",                          #   add     rdi, 8
+  0x400032: "\x48\x83\xe9\x01",                          #   sub     rcx, 1
+  0x400036: "\x75\xe6",                                  #   jne     0x40001e
+}
+
+# Returns the registers saved with each instruction of the trace.
+def getContextRegisters():
+    return [REG.RAX, REG.RBX, REG.RCX, REG.RDX, REG.RSI, REG.RDI, REG.RSP, REG.RBP]
+
+
+
+# Runs the code with the full semantics and records, for each instruction,
+# its address, its opcodes and the concrete value of the registers.
+def record():
+    trace = list()
+    ip    = 0x400000
+
+    setArchitecture(ARCH.X86_64)
+    enableSymbolicEngine(False)
+
+    while ip in code:
+        trace.append((ip, code[ip], [getConcreteRegisterValue(r) for r in getContextRegisters()]))
+        inst = Instruction()
+        inst.setOpcodes(code[ip])
+        inst.setAddress(ip)
+        processing(inst)
+        ip = getConcreteRegisterValue(REG.RIP)
+
+    return trace
+
+
+
+# Replays a trace and returns the number of instructions per second
+# and the tainted memory.
+def replay(trace, taintOnly):
+    setArchitecture(ARCH.X86_64)
+    enableSymbolicEngine(False)
+    enableSymbolicOptimization(OPTIMIZATION.TAINT_ONLY, taintOnly)
+
+    # Taint the source buffer
+    for index in range(COUNT):
+        taintMemory(MemoryAccess(SRC + index * CPUSIZE.QWORD, CPUSIZE.QWORD))
+
+    regs  = getContextRegisters()
+    start = time.time()
+    for ip, opcodes, context in trace:
+        inst = Instruction()
+        inst.setOpcodes(opcodes)
+        inst.setAddress(ip)
+        # The taint-only mode does not update the concrete state, thus
+        # each instruction comes with the registers of the trace.
+        for reg, value in zip(regs, context):
+            inst.updateContext(Register(reg, value))
+        processing(inst)
+    elapsed = time.time() - start
+
+    tainted = list(getTaintedMemory())
+    enableSymbolicOptimization(OPTIMIZATION.TAINT_ONLY, False)
+    resetEngines()
+
+    return int(len(trace) / elapsed), tainted
+
+
+
+if __name__ == '__main__':
+    trace = record()
+    print 'Recorded trace: %d instructions' %(len(trace))
+
+    fullIps, fullTainted = replay(trace, False)
+    print 'Full semantics: %d instructions per second' %(fullIps)
+
+    taintIps, taintTainted = replay(trace, True)
+    print 'Taint only    : %d instructions per second' %(taintIps)
+
+    if fullTainted != taintTainted:
+        print 'Tainted memory: results differ'
+        sys.exit(-1)
+
+    print 'Tainted memory: %d bytes (same result)' %(len(taintTainted) - COUNT * CPUSIZE.QWORD)
+    sys.exit(0)
+
@@ -5,11 +5,15 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <map>
+#include <algorithm>
+#include <cstring>
 #include <list>
+#include <map>
 
 #include <api.hpp>
+#include <cpuSize.hpp>
 #include <exceptions.hpp>
+#include <x86Specifications.hpp>
 
 
 
@@ -228,6 +232,8 @@ namespace triton {
     this->removeEngines();
     this->initEngines();
     this->removeAllCallbacks();
+    this->clearBlockCache();
+    this->clearTranslationCache();
   }
 
 
@@ -277,6 +283,11 @@ namespace triton {
   }
 
 
+  triton::arch::RegisterSpecification API::getCpuRegSpecification(triton::uint32 reg) const {
+    return this->arch.getRegisterSpecification(reg);
+  }
+
+
   std::set<triton::arch::Register*> API::getAllRegisters(void) const {
     this->checkArchitecture();
     return this->arch.getAllRegisters();
@@ -304,6 +315,12 @@ namespace triton {
   }
 
 
+  void API::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+    this->checkArchitecture();
+    this->arch.getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+  }
+
+
   triton::uint512 API::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
     return this->arch.getConcreteRegisterValue(reg, execCallbacks);
   }
@@ -352,6 +369,7 @@ namespace triton {
 
   bool API::buildSemantics(triton::arch::Instruction& inst) {
     this->checkArchitecture();
+    this->checkTaint();
 
     /* Stage 1 - Update the context memory */
     std::list<triton::arch::MemoryAccess>::iterator it1;
@@ -365,15 +383,22 @@ namespace triton {
       this->setConcreteRegisterValue(it2->second);
     }
 
-    /* Stage 3 - Initialize the target address of memory operands */
-    std::vector<triton::arch::OperandWrapper>::iterator it3;
-    for (it3 = inst.operands.begin(); it3 != inst.operands.end(); it3++) {
-      if (it3->getType() == triton::arch::OP_MEM) {
-        it3->getMemory().initAddress();
+    /* Stage 3 - Initialize the target address of memory operands (the taint-only semantics do it without AST) */
+    if (!this->isSymbolicOptimizationEnabled(triton::engines::symbolic::TAINT_ONLY)) {
+      std::vector<triton::arch::OperandWrapper>::iterator it3;
+      for (it3 = inst.operands.begin(); it3 != inst.operands.end(); it3++) {
+        if (it3->getType() == triton::arch::OP_MEM) {
+          it3->getMemory().initAddress();
+        }
       }
     }
 
-    return this->arch.buildSemantics(inst);
+    /* Stage 4 - Build the semantics. Taint spreadings are linked to the instruction in the provenance graph */
+    this->taint->enterInstruction(inst.getAddress());
+    bool ret = this->arch.buildSemantics(inst);
+    this->taint->leaveInstruction();
+
+    return ret;
   }
 
 
@@ -433,17 +458,306 @@ namespace triton {
       this->removeEngines();
       this->initEngines();
       this->clearArchitecture();
+      this->clearBlockCache();
+      this->clearTranslationCache();
     }
   }
 
 
   bool API::processing(triton::arch::Instruction& inst) {
     this->checkArchitecture();
-    this->disassembly(inst);
+    if (this->isSymbolicOptimizationEnabled(triton::engines::symbolic::SEMANTICS_TEMPLATES))
+      this->cachedDisassembly(inst);
+    else
+      this->disassembly(inst);
     return this->buildSemantics(inst);
   }
 
 
+  void API::cachedDisassembly(triton::arch::Instruction& inst) {
+    /* The cache is bounded, flush it when a new address does not fit anymore */
+    if (this->translationCache.size() >= triton::TRANSLATION_CACHE_CAPACITY && this->translationCache.find(inst.getAddress()) == this->translationCache.end())
+      this->clearTranslationCache();
+
+    triton::arch::Instruction& cached = this->translationCache[inst.getAddress()];
+    std::vector<triton::arch::OperandWrapper>::const_iterator it;
+
+    /* Cache miss (or modified code), decode and record the instruction */
+    if (cached.getType() == 0 || inst.getSize() < cached.getSize() || std::memcmp(cached.getOpcodes(), inst.getOpcodes(), cached.getSize()) != 0) {
+      this->disassembly(inst);
+      cached = inst;
+      cached.memoryAccess.clear();
+      cached.registerState.clear();
+      return;
+    }
+
+    /* Cache hit, setup the instruction from the decoded one */
+    inst.setDisassembly(cached.getDisassembly());
+    inst.setSize(cached.getSize());
+    inst.setType(cached.getType());
+    inst.setPrefix(cached.getPrefix());
+    inst.setBranch(cached.isBranch());
+    inst.setControlFlow(cached.isControlFlow());
+
+    /* Register operands take the concrete values given by the context of the current execution */
+    inst.operands.clear();
+    for (it = cached.operands.begin(); it != cached.operands.end(); it++) {
+      if (it->getType() == triton::arch::OP_REG)
+        inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(it->getConstRegister().getId())));
+      else
+        inst.operands.push_back(*it);
+    }
+  }
+
+
+  const triton::arch::BasicBlock& API::disassemblyBlock(const triton::uint8* area, triton::usize size, triton::uint64 addr) {
+    triton::usize offset = 0;
+
+    this->checkArchitecture();
+
+    if (area == nullptr || size == 0)
+      throw triton::exceptions::API("API::disassemblyBlock(): The area must be defined.");
+
+    /* Returns the cached block if the code has not changed */
+    std::map<triton::uint64, triton::arch::BasicBlock>::iterator it = this->blockCache.find(addr);
+    if (it != this->blockCache.end() && it->second.isSameOpcodes(area, size))
+      return it->second;
+
+    /* Decode until the first control flow instruction. The block is cached only once fully decoded */
+    triton::arch::BasicBlock block(addr);
+    while (offset < size) {
+      triton::arch::Instruction inst;
+      inst.setOpcodes(area + offset, static_cast<triton::uint32>(std::min<triton::usize>(size - offset, 16)));
+      inst.setAddress(addr + offset);
+      this->disassembly(inst);
+      block.addInstruction(inst);
+      offset += inst.getSize();
+      if (inst.isControlFlow())
+        break;
+    }
+
+    /* The cache is bounded, flush it when a new address does not fit anymore */
+    if (this->blockCache.size() >= triton::TRANSLATION_CACHE_CAPACITY && it == this->blockCache.end())
+      this->clearBlockCache();
+
+    triton::arch::BasicBlock& cached = this->blockCache[addr];
+    cached = block;
+    return cached;
+  }
+
+
+  std::vector<triton::arch::Instruction> API::processBlock(const triton::uint8* area, triton::usize size, triton::uint64 addr) {
+    std::vector<triton::arch::Instruction> block = this->disassemblyBlock(area, size, addr).getInstructions();
+    std::vector<triton::arch::Instruction>::iterator it;
+
+    /* Only semantics are built, the disassembly comes from the cache */
+    for (it = block.begin(); it != block.end(); it++)
+      this->buildSemantics(*it);
+
+    if (this->isSymbolicOptimizationEnabled(triton::engines::symbolic::DEAD_FLAGS_ELIMINATION))
+      this->deadFlagsElimination(block);
+
+    return block;
+  }
+
+
+  void API::clearBlockCache(void) {
+    this->blockCache.clear();
+  }
+
+
+  void API::clearTranslationCache(void) {
+    this->translationCache.clear();
+    this->semanticsTemplates.clear();
+  }
+
+
+  const triton::arch::SemanticsTemplate* API::getSemanticsTemplate(const triton::arch::Instruction& inst) const {
+    std::map<triton::uint64, triton::arch::SemanticsTemplate>::const_iterator it = this->semanticsTemplates.find(inst.getAddress());
+
+    if (it == this->semanticsTemplates.end() || !it->second.isSameOpcodes(inst))
+      return nullptr;
+
+    return &it->second;
+  }
+
+
+  bool API::recordSemanticsTemplate(const triton::arch::Instruction& inst) {
+    this->checkSymbolic();
+
+    /* The expressions must be the ones built by the semantics, without any rewriting */
+    if (this->isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_CANONICALIZATION) ||
+        this->isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES) ||
+        this->isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_FOLDING) ||
+        this->symbolic->isZ3SimplificationEnabled() ||
+        !this->symbolic->getSimplificationRules().isEmpty() ||
+        this->callbacks.isSymbolicSimplificationDefined())
+      return false;
+
+    /* Same bound as the decoded instructions */
+    if (this->semanticsTemplates.size() >= triton::TRANSLATION_CACHE_CAPACITY && this->semanticsTemplates.find(inst.getAddress()) == this->semanticsTemplates.end())
+      this->clearTranslationCache();
+
+    triton::arch::SemanticsTemplate& record = this->semanticsTemplates[inst.getAddress()];
+    if (record.record(inst))
+      return true;
+
+    this->semanticsTemplates.erase(inst.getAddress());
+    return false;
+  }
+
+
+  void API::deadFlagsElimination(std::vector<triton::arch::Instruction>& block) {
+    /* The last definition (not read yet) of each flag. **item1**: flag id<br>**item2**: expression id */
+    std::map<triton::uint32, triton::usize> pending;
+    std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>::const_iterator it1;
+    std::vector<triton::engines::symbolic::SymbolicExpression*>::iterator it2;
+    std::set<triton::usize> deadIds;
+
+    for (triton::usize index = 0; index < block.size(); index++) {
+      triton::arch::Instruction& inst = block[index];
+
+      /* A read keeps the previous definition of a flag alive */
+      for (it1 = inst.getReadRegisters().begin(); it1 != inst.getReadRegisters().end(); it1++) {
+        if (it1->first.isFlag())
+          pending.erase(it1->first.getId());
+      }
+
+      /* A write of a flag which has not been read kills the previous definition */
+      for (it2 = inst.symbolicExpressions.begin(); it2 != inst.symbolicExpressions.end(); it2++) {
+        const triton::arch::Register& flag = (*it2)->getOriginRegister();
+        if ((*it2)->getKind() != triton::engines::symbolic::REG || !flag.isFlag())
+          continue;
+        if (pending.find(flag.getId()) != pending.end())
+          deadIds.insert(pending[flag.getId()]);
+        pending[flag.getId()] = (*it2)->getId();
+      }
+    }
+
+    if (deadIds.empty())
+      return;
+
+    /*
+     * Dead expressions are unlinked from their instructions and removed from
+     * the symbolic engine. AST nodes are kept by the garbage collector as they
+     * may be shared with other expressions of the same instruction.
+     */
+    for (triton::usize index = 0; index < block.size(); index++) {
+      std::vector<triton::engines::symbolic::SymbolicExpression*> newVector;
+      for (it2 = block[index].symbolicExpressions.begin(); it2 != block[index].symbolicExpressions.end(); it2++) {
+        if (deadIds.find((*it2)->getId()) != deadIds.end())
+          this->removeSymbolicExpression((*it2)->getId());
+        else
+          newVector.push_back(*it2);
+      }
+      block[index].symbolicExpressions = newVector;
+    }
+  }
+
+
+
+  /* Emulation API ================================================================================= */
+
+  void API::loadBinary(const triton::format::BinaryInterface& binary) {
+    std::list<triton::format::MemoryMapping>::const_iterator it;
+
+    this->checkArchitecture();
+    for (it = binary.getMemoryMapping().begin(); it != binary.getMemoryMapping().end(); it++)
+      this->setConcreteMemoryAreaValue(it->getVirtualAddress(), it->getMemoryArea(), it->getSize());
+  }
+
+
+  void API::setupStack(triton::uint64 base) {
+    this->checkArchitecture();
+
+    triton::arch::Register sp(TRITON_X86_REG_SP.getParent().getId(), base);
+    triton::arch::Register bp(TRITON_X86_REG_BP.getParent().getId(), base);
+
+    this->concretizeRegister(sp);
+    this->concretizeRegister(bp);
+    this->setConcreteRegisterValue(sp);
+    this->setConcreteRegisterValue(bp);
+  }
+
+
+  triton::usize API::emulate(triton::uint64 pc, triton::usize maxCount, const std::set<triton::uint64>& stopAddrs) {
+    triton::uint8 opcodes[DQWORD_SIZE] = {0};
+    triton::usize count = 0;
+
+    this->checkArchitecture();
+
+    /* The program counter always points to the next instruction to emulate */
+    triton::arch::Register pcReg(TRITON_X86_REG_PC.getId(), pc);
+    this->concretizeRegister(pcReg);
+    this->setConcreteRegisterValue(pcReg);
+
+    while (maxCount == 0 || count < maxCount) {
+      if (stopAddrs.find(pc) != stopAddrs.end() || !this->isMemoryMapped(pc))
+        break;
+
+      /* Fetch enough bytes for the longest x86 instruction (15 bytes) in one walk of the memory */
+      this->getConcreteMemoryAreaValue(pc, opcodes, DQWORD_SIZE, false);
+
+      triton::arch::Instruction inst;
+      inst.setOpcodes(opcodes, DQWORD_SIZE);
+      inst.setAddress(pc);
+
+      if (!this->processing(inst))
+        break;
+      count++;
+
+      /* Syscalls are emulated by callbacks, otherwise the emulation stops */
+      if (inst.getType() == triton::arch::x86::ID_INS_SYSCALL || inst.getType() == triton::arch::x86::ID_INS_SYSENTER || inst.getType() == triton::arch::x86::ID_INS_INT) {
+        if (!this->processCallbacks(triton::callbacks::SYSCALL, inst))
+          break;
+      }
+
+      pc = this->getConcreteRegisterValue(TRITON_X86_REG_PC, false).convert_to<triton::uint64>();
+    }
+
+    return count;
+  }
+
+
+  triton::usize API::replayTrace(triton::format::trace::TraceReader& reader, triton::usize maxCount) {
+    triton::format::trace::TraceRecord record;
+    triton::arch::Instruction inst;
+    triton::usize count = 0;
+
+    this->checkArchitecture();
+    if (reader.getArchitecture() != this->getArchitecture())
+      throw triton::exceptions::API("API::replayTrace(): The architecture of the trace does not match.");
+
+    while ((maxCount == 0 || count < maxCount) && reader.next(record)) {
+      for (const triton::arch::Register& reg : record.registers)
+        this->setConcreteRegisterValue(reg);
+
+      for (const triton::arch::MemoryAccess& mem : record.memory)
+        this->setConcreteMemoryValue(mem);
+
+      inst.reset();
+      inst.setOpcodes(record.opcodes.data(), static_cast<triton::uint32>(record.opcodes.size()));
+      inst.setAddress(record.address);
+
+      if (!this->processing(inst))
+        break;
+      count++;
+    }
+
+    return count;
+  }
+
+
+  triton::usize API::replayTrace(std::istream& stream, triton::usize maxCount) {
+    triton::format::trace::TraceReader reader(stream);
+
+    if (this->getArchitecture() == triton::arch::ARCH_INVALID)
+      this->setArchitecture(reader.getArchitecture());
+
+    return this->replayTrace(reader, maxCount);
+  }
+
+
 
   /* AST garbage collector API ====================================================================== */
 
@@ -455,12 +769,17 @@ namespace triton {
 
   void API::freeAllAstNodes(void) {
     this->checkAstGarbageCollector();
+    if (this->symbolic != nullptr)
+      this->symbolic->clearFoldedNodes();
     this->astGarbageCollector->freeAllAstNodes();
   }
 
 
   void API::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
     this->checkAstGarbageCollector();
+    /* The folded nodes may be freed */
+    if (!nodes.empty() && this->symbolic != nullptr)
+      this->symbolic->evictFoldedNodes(nodes);
     this->astGarbageCollector->freeAstNodes(nodes);
   }
 
@@ -558,6 +877,11 @@ namespace triton {
   }
 
 
+  void API::addCallback(triton::callbacks::syscallCallback cb) {
+    this->callbacks.addCallback(cb);
+  }
+
+
   #ifdef TRITON_PYTHON_BINDINGS
   void API::addCallback(PyObject* function, triton::callbacks::callback_e kind) {
     this->callbacks.addCallback(function, kind);
@@ -585,6 +909,11 @@ namespace triton {
   }
 
 
+  void API::removeCallback(triton::callbacks::syscallCallback cb) {
+    this->callbacks.removeCallback(cb);
+  }
+
+
   #ifdef TRITON_PYTHON_BINDINGS
   void API::removeCallback(PyObject* function, triton::callbacks::callback_e kind) {
     this->callbacks.removeCallback(function, kind);
@@ -611,6 +940,13 @@ namespace triton {
   }
 
 
+  bool API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Instruction& inst) const {
+    if (this->callbacks.isDefined)
+      return this->callbacks.processCallbacks(kind, inst);
+    return false;
+  }
+
+
 
   /* Symbolic Engine API ============================================================================ */
 
@@ -798,6 +1134,12 @@ namespace triton {
   }
 
 
+  const std::map<triton::uint64, triton::usize>& API::getSymbolicMemoryReferences(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemoryReferences();
+  }
+
+
   triton::usize API::getSymbolicRegisterId(const triton::arch::Register& reg) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisterId(reg);
@@ -840,12 +1182,78 @@ namespace triton {
   }
 
 
+  triton::ast::AbstractNode* API::canonicalizeAstNode(triton::ast::AbstractNode* node) {
+    this->checkSymbolic();
+    return this->symbolic->canonicalizeAstNode(node);
+  }
+
+
+  triton::ast::AbstractNode* API::foldAst(triton::ast::AbstractNode* node) {
+    this->checkSymbolic();
+    return this->symbolic->foldAst(node);
+  }
+
+
+  triton::usize API::foldSymbolicExpressions(void) {
+    this->checkSymbolic();
+    return this->symbolic->foldSymbolicExpressions();
+  }
+
+
+  void API::saveSymbolicState(std::ostream& stream) const {
+    this->checkSymbolic();
+    this->symbolic->saveSymbolicState(stream);
+  }
+
+
+  void API::loadSymbolicState(std::istream& stream) {
+    this->checkSymbolic();
+    this->symbolic->loadSymbolicState(stream);
+  }
+
+
   triton::ast::AbstractNode* API::processSimplification(triton::ast::AbstractNode* node, bool z3) const {
     this->checkSymbolic();
     return this->symbolic->processSimplification(node, z3);
   }
 
 
+  void API::addSimplificationRule(const std::string& rule) {
+    this->checkSymbolic();
+    this->symbolic->getSimplificationRules().addRule(rule);
+  }
+
+
+  void API::addSimplificationRule(triton::callbacks::symbolicSimplificationCallback cb) {
+    this->checkSymbolic();
+    this->symbolic->getSimplificationRules().addRule(cb);
+  }
+
+
+  triton::usize API::loadSimplificationRules(const std::string& path) {
+    this->checkSymbolic();
+    return this->symbolic->getSimplificationRules().loadRules(path);
+  }
+
+
+  void API::loadSimplificationPlugin(const std::string& path) {
+    this->checkSymbolic();
+    this->symbolic->getSimplificationRules().loadPlugin(path);
+  }
+
+
+  std::vector<std::string> API::getSimplificationRules(void) {
+    this->checkSymbolic();
+    return this->symbolic->getSimplificationRules().getRules();
+  }
+
+
+  void API::clearSimplificationRules(void) {
+    this->checkSymbolic();
+    this->symbolic->getSimplificationRules().clear();
+  }
+
+
   triton::engines::symbolic::SymbolicExpression* API::getSymbolicExpressionFromId(triton::usize symExprId) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpressionFromId(symExprId);
@@ -1047,13 +1455,37 @@ namespace triton {
   }
 
 
-  const std::set<triton::uint64>& API::getTaintedMemory(void) const {
+  std::set<triton::uint64> API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
 
 
-  const std::set<triton::arch::Register>& API::getTaintedRegisters(void) const {
+  std::vector<std::pair<triton::uint64, triton::usize>> API::getTaintedMemoryRanges(void) const {
+    this->checkTaint();
+    return this->taint->getTaintedMemoryRanges();
+  }
+
+
+  std::vector<std::pair<triton::uint64, triton::usize>> API::getTaintedMemoryRanges(triton::uint64 start, triton::uint64 end) const {
+    this->checkTaint();
+    return this->taint->getTaintedMemoryRanges(start, end);
+  }
+
+
+  triton::usize API::countTaintedMemory(triton::uint64 start, triton::uint64 end) const {
+    this->checkTaint();
+    return this->taint->countTaintedMemory(start, end);
+  }
+
+
+  bool API::getNextTaintedMemory(triton::uint64 addr, triton::uint64& found) const {
+    this->checkTaint();
+    return this->taint->getNextTaintedMemory(addr, found);
+  }
+
+
+  std::set<triton::arch::Register> API::getTaintedRegisters(void) const {
     this->checkTaint();
     return this->taint->getTaintedRegisters();
   }
@@ -1071,6 +1503,66 @@ namespace triton {
   }
 
 
+  void API::enableTaintLabels(bool flag) {
+    this->checkTaint();
+    this->taint->enableLabels(flag);
+  }
+
+
+  bool API::isTaintLabelsEnabled(void) const {
+    this->checkTaint();
+    return this->taint->isLabelsEnabled();
+  }
+
+
+  std::vector<triton::uint32> API::getMemoryTaintLabels(triton::uint64 addr, triton::uint32 size) const {
+    this->checkTaint();
+    return this->taint->getMemoryLabels(addr, size);
+  }
+
+
+  std::vector<triton::uint32> API::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+    this->checkTaint();
+    return this->taint->getMemoryLabels(mem);
+  }
+
+
+  std::vector<triton::uint32> API::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getRegisterLabels(reg);
+  }
+
+
+  void API::enableTaintProvenance(bool flag, triton::usize capacity) {
+    this->checkTaint();
+    this->taint->enableProvenance(flag, capacity);
+  }
+
+
+  bool API::isTaintProvenanceEnabled(void) const {
+    this->checkTaint();
+    return this->taint->isProvenanceEnabled();
+  }
+
+
+  std::vector<triton::engines::taint::TaintEvent> API::getMemoryTaintProvenance(triton::uint64 addr, triton::uint32 size) const {
+    this->checkTaint();
+    return this->taint->getMemoryProvenance(addr, size);
+  }
+
+
+  std::vector<triton::engines::taint::TaintEvent> API::getMemoryTaintProvenance(const triton::arch::MemoryAccess& mem) const {
+    this->checkTaint();
+    return this->taint->getMemoryProvenance(mem);
+  }
+
+
+  std::vector<triton::engines::taint::TaintEvent> API::getRegisterTaintProvenance(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getRegisterProvenance(reg);
+  }
+
+
   bool API::isTainted(const triton::arch::OperandWrapper& op) const {
     this->checkTaint();
     switch (op.getType()) {
@@ -1127,6 +1619,20 @@ namespace triton {
   }
 
 
+  bool API::setTaintRegister(const triton::arch::Register& reg, bool flag, const triton::arch::Instruction& inst) {
+    this->checkTaint();
+    this->taint->setTaintRegister(reg, flag, inst);
+    return flag;
+  }
+
+
+  bool API::setTaintRegister(const triton::arch::Register& reg, bool flag, const std::vector<triton::arch::OperandWrapper>& sources) {
+    this->checkTaint();
+    this->taint->setTaintRegister(reg, flag, sources);
+    return flag;
+  }
+
+
   bool API::taintMemory(triton::uint64 addr) {
     this->checkTaint();
     return this->taint->taintMemory(addr);
@@ -1145,6 +1651,24 @@ namespace triton {
   }
 
 
+  bool API::taintMemory(triton::uint64 addr, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintMemory(addr, label);
+  }
+
+
+  bool API::taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintMemory(mem, label);
+  }
+
+
+  bool API::taintRegister(const triton::arch::Register& reg, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintRegister(reg, label);
+  }
+
+
   bool API::untaintMemory(triton::uint64 addr) {
     this->checkTaint();
     return this->taint->untaintMemory(addr);
@@ -150,6 +150,16 @@ namespace triton {
     }
 
 
+    triton::arch::RegisterSpecification Architecture::getRegisterSpecification(triton::uint32 reg) const {
+      triton::arch::RegisterSpecification ret = {"unknown", 0, 0, 0};
+
+      if (this->cpu)
+        ret = this->cpu->getRegisterSpecification(reg);
+
+      return ret;
+    }
+
+
     std::set<triton::arch::Register*> Architecture::getAllRegisters(void) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getAllRegisters(): You must define an architecture.");
@@ -211,6 +221,13 @@ namespace triton {
     }
 
 
+    void Architecture::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteMemoryAreaValue(): You must define an architecture.");
+      this->cpu->getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+    }
+
+
     triton::uint512 Architecture::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteRegisterValue(): You must define an architecture.");
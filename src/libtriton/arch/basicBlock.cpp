@@ -0,0 +1,118 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <basicBlock.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    BasicBlock::BasicBlock() {
+      this->address = 0;
+    }
+
+
+    BasicBlock::BasicBlock(triton::uint64 addr) {
+      this->address = addr;
+    }
+
+
+    BasicBlock::BasicBlock(const BasicBlock& other) {
+      this->address      = other.address;
+      this->instructions = other.instructions;
+      this->opcodes      = other.opcodes;
+    }
+
+
+    BasicBlock::~BasicBlock() {
+    }
+
+
+    void BasicBlock::operator=(const BasicBlock& other) {
+      this->address      = other.address;
+      this->instructions = other.instructions;
+      this->opcodes      = other.opcodes;
+    }
+
+
+    triton::uint64 BasicBlock::getAddress(void) const {
+      return this->address;
+    }
+
+
+    triton::uint64 BasicBlock::getNextAddress(void) const {
+      return this->address + this->opcodes.size();
+    }
+
+
+    triton::usize BasicBlock::getSize(void) const {
+      return this->opcodes.size();
+    }
+
+
+    const std::vector<triton::uint8>& BasicBlock::getOpcodes(void) const {
+      return this->opcodes;
+    }
+
+
+    const std::vector<triton::arch::Instruction>& BasicBlock::getInstructions(void) const {
+      return this->instructions;
+    }
+
+
+    bool BasicBlock::isEmpty(void) const {
+      return this->instructions.empty();
+    }
+
+
+    bool BasicBlock::isComplete(void) const {
+      if (this->instructions.empty())
+        return false;
+      return this->instructions.back().isControlFlow();
+    }
+
+
+    bool BasicBlock::isSameOpcodes(const triton::uint8* area, triton::usize size) const {
+      if (this->opcodes.empty() || size < this->opcodes.size())
+        return false;
+      /* A longer area may continue a block which has been cut short */
+      if (!this->isComplete() && size != this->opcodes.size())
+        return false;
+      return (std::memcmp(this->opcodes.data(), area, this->opcodes.size()) == 0);
+    }
+
+
+    void BasicBlock::addInstruction(const triton::arch::Instruction& inst) {
+      const triton::uint8* opcodes = inst.getOpcodes();
+      this->opcodes.insert(this->opcodes.end(), opcodes, opcodes + inst.getSize());
+      this->instructions.push_back(inst);
+    }
+
+
+    void BasicBlock::setAddress(triton::uint64 addr) {
+      this->address = addr;
+    }
+
+
+    void BasicBlock::clear(void) {
+      this->instructions.clear();
+      this->opcodes.clear();
+    }
+
+
+    std::ostream& operator<<(std::ostream& stream, const BasicBlock& block) {
+      std::vector<triton::arch::Instruction>::const_iterator it;
+      for (it = block.getInstructions().begin(); it != block.getInstructions().end(); it++)
+        stream << *it << std::endl;
+      return stream;
+    }
+
+  };
+};
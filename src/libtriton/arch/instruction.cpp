@@ -229,6 +229,11 @@ namespace triton {
     }
 
 
+    void Instruction::setTaint(bool flag) {
+      this->tainted = flag;
+    }
+
+
     void Instruction::updateContext(const triton::arch::Register& reg) {
       this->registerState[reg.getId()] = reg;
     }
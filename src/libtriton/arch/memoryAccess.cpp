@@ -21,6 +21,7 @@ namespace triton {
       this->concreteValue = 0;
       this->trusted       = false;
       this->pcRelative    = 0;
+      this->clearLea();
     }
 
 
@@ -30,6 +31,7 @@ namespace triton {
       this->concreteValue = concreteValue;
       this->trusted       = true;
       this->pcRelative    = 0;
+      this->clearLea();
 
       if (size == 0)
         throw triton::exceptions::MemoryAccess("MemoryAccess::MemoryAccess(): size cannot be zero.");
@@ -53,6 +55,17 @@ namespace triton {
     }
 
 
+    void MemoryAccess::clearLea(void) {
+      this->lea.segment          = triton::api.cpuInvalidRegister();
+      this->lea.base             = triton::api.cpuInvalidRegister();
+      this->lea.index            = triton::api.cpuInvalidRegister();
+      this->lea.displacementSize = 0;
+      this->lea.displacement     = 0;
+      this->lea.scaleSize        = 0;
+      this->lea.scale            = 0;
+    }
+
+
     triton::uint32 MemoryAccess::getAbstractLow(void) const {
       return this->getLow();
     }
@@ -77,34 +90,34 @@ namespace triton {
       if (this->pcRelative)
         return this->pcRelative;
 
-      else if (this->baseReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->baseReg).convert_to<triton::uint64>();
+      else if (triton::api.isCpuRegisterValid(this->lea.base))
+        return triton::api.getConcreteRegisterValue(this->getBaseRegister()).convert_to<triton::uint64>();
 
       return 0;
     }
 
 
     triton::uint64 MemoryAccess::getIndexValue(void) {
-      if (this->indexReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->indexReg).convert_to<triton::uint64>();
+      if (triton::api.isCpuRegisterValid(this->lea.index))
+        return triton::api.getConcreteRegisterValue(this->getIndexRegister()).convert_to<triton::uint64>();
       return 0;
     }
 
 
     triton::uint64 MemoryAccess::getSegmentValue(void) {
-      if (this->segmentReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->segmentReg).convert_to<triton::uint64>();
+      if (triton::api.isCpuRegisterValid(this->lea.segment))
+        return triton::api.getConcreteRegisterValue(this->getSegmentRegister()).convert_to<triton::uint64>();
       return 0;
     }
 
 
     triton::uint64 MemoryAccess::getScaleValue(void) {
-      return this->scale.getValue();
+      return this->lea.scale;
     }
 
 
     triton::uint64 MemoryAccess::getDisplacementValue(void) {
-      return this->displacement.getValue();
+      return this->lea.displacement;
     }
 
 
@@ -115,14 +128,14 @@ namespace triton {
 
 
     triton::uint32 MemoryAccess::getAccessSize(void) {
-      if (this->indexReg.isValid())
-        return this->indexReg.getBitSize();
+      if (triton::api.isCpuRegisterValid(this->lea.index))
+        return this->getIndexRegister().getBitSize();
 
-      else if (this->baseReg.isValid())
-        return this->baseReg.getBitSize();
+      else if (triton::api.isCpuRegisterValid(this->lea.base))
+        return this->getBaseRegister().getBitSize();
 
-      else if (this->displacement.getBitSize())
-        return this->displacement.getBitSize();
+      else if (this->lea.displacementSize)
+        return this->lea.displacementSize * BYTE_SIZE_BIT;
 
       return triton::api.cpuRegisterBitSize();
     }
@@ -131,8 +144,8 @@ namespace triton {
     void MemoryAccess::initAddress(void) {
       /* Otherwise, try to compute the address */
       if (triton::api.isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT) {
-        triton::arch::Register& base  = this->baseReg;
-        triton::arch::Register& index = this->indexReg;
+        triton::arch::Register base   = this->getBaseRegister();
+        triton::arch::Register index  = this->getIndexRegister();
         triton::uint64 segmentValue   = this->getSegmentValue();
         triton::uint64 scaleValue     = this->getScaleValue();
         triton::uint64 dispValue      = this->getDisplacementValue();
@@ -152,9 +165,10 @@ namespace triton {
 
         /* Use segments as base address instead of selector into the GDT. */
         if (segmentValue) {
+          triton::uint32 segmentSize = this->getSegmentRegister().getBitSize();
           this->ast = triton::ast::bvadd(
-                        triton::ast::bv(segmentValue, this->segmentReg.getBitSize()),
-                        triton::ast::sx((this->segmentReg.getBitSize() - bitSize), this->ast)
+                        triton::ast::bv(segmentValue, segmentSize),
+                        triton::ast::sx((segmentSize - bitSize), this->ast)
                       );
         }
 
@@ -165,6 +179,33 @@ namespace triton {
     }
 
 
+    void MemoryAccess::initConcreteAddress(void) {
+      if (triton::api.isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT && !this->address) {
+        triton::uint32 bitSize      = this->getAccessSize();
+        triton::uint64 segmentValue = this->getSegmentValue();
+        triton::uint64 address      = this->getBaseValue() + this->getIndexValue() * this->getScaleValue() + this->getDisplacementValue();
+
+        if (bitSize < QWORD_SIZE_BIT)
+          address &= ((static_cast<triton::uint64>(1) << bitSize) - 1);
+
+        /* Use segments as base address instead of selector into the GDT. The offset is sign-extended as in initAddress() */
+        if (segmentValue) {
+          triton::uint32 segmentSize = this->getSegmentRegister().getBitSize();
+
+          if (bitSize < segmentSize && ((address >> (bitSize - 1)) & 1))
+            address |= ~((static_cast<triton::uint64>(1) << bitSize) - 1);
+
+          address += segmentValue;
+
+          if (segmentSize < QWORD_SIZE_BIT)
+            address &= ((static_cast<triton::uint64>(1) << segmentSize) - 1);
+        }
+
+        this->address = address;
+      }
+    }
+
+
     triton::uint32 MemoryAccess::getBitSize(void) const {
       return this->getVectorSize();
     }
@@ -190,53 +231,62 @@ namespace triton {
     }
 
 
-    triton::arch::Register& MemoryAccess::getSegmentRegister(void) {
-      return this->segmentReg;
+    triton::arch::Register MemoryAccess::getSegmentRegister(void) const {
+      return triton::arch::Register(this->lea.segment);
+    }
+
+
+    triton::arch::Register MemoryAccess::getBaseRegister(void) const {
+      return triton::arch::Register(this->lea.base);
     }
 
 
-    triton::arch::Register& MemoryAccess::getBaseRegister(void) {
-      return this->baseReg;
+    triton::arch::Register MemoryAccess::getIndexRegister(void) const {
+      return triton::arch::Register(this->lea.index);
     }
 
 
-    triton::arch::Register& MemoryAccess::getIndexRegister(void) {
-      return this->indexReg;
+    triton::arch::Immediate MemoryAccess::getDisplacement(void) const {
+      if (!this->lea.displacementSize)
+        return triton::arch::Immediate();
+      return triton::arch::Immediate(this->lea.displacement, this->lea.displacementSize);
     }
 
 
-    triton::arch::Immediate& MemoryAccess::getDisplacement(void) {
-      return this->displacement;
+    triton::arch::Immediate MemoryAccess::getScale(void) const {
+      if (!this->lea.scaleSize)
+        return triton::arch::Immediate();
+      return triton::arch::Immediate(this->lea.scale, this->lea.scaleSize);
     }
 
 
-    triton::arch::Immediate& MemoryAccess::getScale(void) {
-      return this->scale;
+    triton::arch::Register MemoryAccess::getConstSegmentRegister(void) const {
+      return this->getSegmentRegister();
     }
 
 
-    const triton::arch::Register& MemoryAccess::getConstSegmentRegister(void) const {
-      return this->segmentReg;
+    triton::arch::Register MemoryAccess::getConstBaseRegister(void) const {
+      return this->getBaseRegister();
     }
 
 
-    const triton::arch::Register& MemoryAccess::getConstBaseRegister(void) const {
-      return this->baseReg;
+    triton::arch::Register MemoryAccess::getConstIndexRegister(void) const {
+      return this->getIndexRegister();
     }
 
 
-    const triton::arch::Register& MemoryAccess::getConstIndexRegister(void) const {
-      return this->indexReg;
+    triton::arch::Immediate MemoryAccess::getConstDisplacement(void) const {
+      return this->getDisplacement();
     }
 
 
-    const triton::arch::Immediate& MemoryAccess::getConstDisplacement(void) const {
-      return this->displacement;
+    triton::arch::Immediate MemoryAccess::getConstScale(void) const {
+      return this->getScale();
     }
 
 
-    const triton::arch::Immediate& MemoryAccess::getConstScale(void) const {
-      return this->scale;
+    const triton::arch::LeaDescriptor& MemoryAccess::getLeaDescriptor(void) const {
+      return this->lea;
     }
 
 
@@ -275,28 +325,30 @@ namespace triton {
     }
 
 
-    void MemoryAccess::setSegmentRegister(triton::arch::Register& segment) {
-      this->segmentReg = segment;
+    void MemoryAccess::setSegmentRegister(const triton::arch::Register& segment) {
+      this->lea.segment = segment.getId();
     }
 
 
-    void MemoryAccess::setBaseRegister(triton::arch::Register& base) {
-      this->baseReg = base;
+    void MemoryAccess::setBaseRegister(const triton::arch::Register& base) {
+      this->lea.base = base.getId();
     }
 
 
-    void MemoryAccess::setIndexRegister(triton::arch::Register& index) {
-      this->indexReg = index;
+    void MemoryAccess::setIndexRegister(const triton::arch::Register& index) {
+      this->lea.index = index.getId();
     }
 
 
-    void MemoryAccess::setDisplacement(triton::arch::Immediate& displacement) {
-      this->displacement = displacement;
+    void MemoryAccess::setDisplacement(const triton::arch::Immediate& displacement) {
+      this->lea.displacement     = displacement.getValue();
+      this->lea.displacementSize = displacement.getSize();
     }
 
 
-    void MemoryAccess::setScale(triton::arch::Immediate& scale) {
-      this->scale = scale;
+    void MemoryAccess::setScale(const triton::arch::Immediate& scale) {
+      this->lea.scale     = scale.getValue();
+      this->lea.scaleSize = scale.getSize();
     }
 
 
@@ -309,13 +361,9 @@ namespace triton {
     void MemoryAccess::copy(const MemoryAccess& other) {
       this->address       = other.address;
       this->ast           = other.ast;
-      this->baseReg       = other.baseReg;
       this->concreteValue = other.concreteValue;
-      this->displacement  = other.displacement;
-      this->indexReg      = other.indexReg;
+      this->lea           = other.lea;
       this->pcRelative    = other.pcRelative;
-      this->scale         = other.scale;
-      this->segmentReg    = other.segmentReg;
       this->trusted       = other.trusted;
     }
 
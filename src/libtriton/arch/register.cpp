@@ -38,7 +38,7 @@ namespace triton {
 
 
     void Register::setup(triton::uint32 reg, triton::uint512 concreteValue) {
-      std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> regInfo;
+      triton::arch::RegisterSpecification spec;
 
       this->id        = reg;
       this->trusted   = true;
@@ -48,13 +48,13 @@ namespace triton {
         this->trusted = false;
       }
 
-      regInfo      = triton::api.getCpuRegInformation(this->id);
+      spec         = triton::api.getCpuRegSpecification(this->id);
 
-      this->name   = std::get<0>(regInfo);
-      this->parent = std::get<3>(regInfo);
+      this->name   = spec.name;
+      this->parent = spec.parent;
 
-      this->setHigh(std::get<1>(regInfo));
-      this->setLow(std::get<2>(regInfo));
+      this->setHigh(spec.high);
+      this->setLow(spec.low);
 
       if (concreteValue > this->getMaxValue())
         throw triton::exceptions::Register("Register::setup(): You cannot set this concrete value (too big) to this register.");
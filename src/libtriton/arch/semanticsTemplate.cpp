@@ -0,0 +1,256 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+
+#include <api.hpp>
+#include <ast.hpp>
+#include <semanticsTemplate.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    SemanticsTemplate::SemanticsTemplate() {
+    }
+
+
+    SemanticsTemplate::SemanticsTemplate(const SemanticsTemplate& other) {
+      this->opcodes     = other.opcodes;
+      this->inputs      = other.inputs;
+      this->nodes       = other.nodes;
+      this->expressions = other.expressions;
+    }
+
+
+    SemanticsTemplate::~SemanticsTemplate() {
+    }
+
+
+    void SemanticsTemplate::operator=(const SemanticsTemplate& other) {
+      this->opcodes     = other.opcodes;
+      this->inputs      = other.inputs;
+      this->nodes       = other.nodes;
+      this->expressions = other.expressions;
+    }
+
+
+    bool SemanticsTemplate::isSameOpcodes(const triton::arch::Instruction& inst) const {
+      if (this->opcodes.empty() || inst.getSize() != this->opcodes.size())
+        return false;
+      return std::equal(this->opcodes.begin(), this->opcodes.end(), inst.getOpcodes());
+    }
+
+
+    bool SemanticsTemplate::addNodes(triton::ast::AbstractNode* root, std::unordered_map<triton::ast::AbstractNode*, triton::uint32>& indexes, const std::unordered_map<triton::usize, triton::uint32>& ids, TemplateExpression& expr) {
+      /* Post-order walk, a node is added once all its childs are indexed */
+      std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+      worklist.push_back(std::make_pair(root, false));
+      while (!worklist.empty()) {
+        triton::ast::AbstractNode* node = worklist.back().first;
+        bool visited = worklist.back().second;
+        enum triton::ast::kind_e kind = node->getKind();
+        TemplateNode tnode;
+
+        worklist.pop_back();
+        if (indexes.find(node) != indexes.end())
+          continue;
+
+        tnode.kind      = kind;
+        tnode.value     = 0;
+        tnode.size      = 0;
+        tnode.dependent = false;
+
+        switch (kind) {
+          case triton::ast::BV_NODE:
+            tnode.value = node->evaluate();
+            tnode.size  = node->getBitvectorSize();
+            break;
+
+          case triton::ast::DECIMAL_NODE:
+            tnode.value = reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue();
+            break;
+
+          /* Only the expressions of the instruction may be referenced, the others are read through the inputs */
+          case triton::ast::REFERENCE_NODE: {
+            std::unordered_map<triton::usize, triton::uint32>::const_iterator it = ids.find(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue());
+            if (it == ids.end())
+              return false;
+            tnode.value     = it->second;
+            tnode.dependent = true;
+            break;
+          }
+
+          default:
+            if (!triton::ast::isOperator(kind))
+              return false;
+
+            if (!visited) {
+              worklist.push_back(std::make_pair(node, true));
+              for (triton::ast::AbstractNode* child : node->getChilds())
+                worklist.push_back(std::make_pair(child, false));
+              continue;
+            }
+
+            for (triton::ast::AbstractNode* child : node->getChilds()) {
+              triton::uint32 index = indexes[child];
+              tnode.childs.push_back(index);
+              tnode.dependent |= this->nodes[index].dependent;
+            }
+            break;
+        }
+
+        indexes[node] = static_cast<triton::uint32>(this->nodes.size());
+        this->nodes.push_back(tnode);
+      }
+
+      expr.root = indexes[root];
+      return true;
+    }
+
+
+    bool SemanticsTemplate::record(const triton::arch::Instruction& inst) {
+      std::unordered_map<triton::ast::AbstractNode*, triton::uint32> indexes;
+      std::unordered_map<triton::usize, triton::uint32> ids;
+
+      this->opcodes.assign(inst.getOpcodes(), inst.getOpcodes() + inst.getSize());
+      this->inputs.clear();
+      this->nodes.clear();
+      this->expressions.clear();
+
+      if (!inst.getLoadAccess().empty() || !inst.getStoreAccess().empty())
+        return false;
+
+      /* The registers read are the inputs */
+      for (const std::pair<triton::arch::Register, triton::ast::AbstractNode*>& read : inst.getReadRegisters()) {
+        TemplateNode tnode;
+
+        tnode.kind      = triton::ast::UNDEFINED_NODE;
+        tnode.value     = static_cast<triton::uint32>(this->inputs.size());
+        tnode.size      = 0;
+        tnode.dependent = true;
+
+        indexes[read.second] = static_cast<triton::uint32>(this->nodes.size());
+        this->inputs.push_back(read.first);
+        this->nodes.push_back(tnode);
+      }
+
+      for (triton::engines::symbolic::SymbolicExpression* se : inst.symbolicExpressions) {
+        TemplateExpression expr;
+        triton::ast::AbstractNode* root = nullptr;
+
+        expr.kind    = se->getKind();
+        expr.comment = se->getComment();
+
+        switch (expr.kind) {
+          case triton::engines::symbolic::UNDEF:
+            root = se->getAst();
+            break;
+
+          /* The AST of a register expression is built around the node written in the sub-register */
+          case triton::engines::symbolic::REG:
+            for (const std::pair<triton::arch::Register, triton::ast::AbstractNode*>& written : inst.getWrittenRegisters()) {
+              if (written.first.getParent().getId() != se->getOriginRegister().getId())
+                continue;
+              if (root != nullptr)
+                return false;
+              expr.reg = written.first;
+              root     = written.second;
+            }
+            if (root == nullptr)
+              return false;
+            break;
+
+          default:
+            return false;
+        }
+
+        if (!this->addNodes(root, indexes, ids, expr))
+          return false;
+
+        ids[se->getId()] = static_cast<triton::uint32>(this->expressions.size());
+        this->expressions.push_back(expr);
+      }
+
+      return true;
+    }
+
+
+    void SemanticsTemplate::instantiate(triton::arch::Instruction& inst) const {
+      std::vector<triton::ast::AbstractNode*> built;
+      std::vector<triton::usize> ids;
+
+      /* The inputs are the first nodes */
+      for (triton::arch::Register reg : this->inputs)
+        built.push_back(triton::api.buildSymbolicRegister(inst, reg));
+
+      for (const TemplateExpression& expr : this->expressions) {
+        triton::engines::symbolic::SymbolicExpression* se = nullptr;
+        triton::arch::Register reg = expr.reg;
+
+        /* The nodes of an expression are recorded before its root */
+        while (built.size() <= expr.root) {
+          const TemplateNode& tnode = this->nodes[built.size()];
+          std::vector<triton::ast::AbstractNode*> childs;
+
+          switch (tnode.kind) {
+            case triton::ast::BV_NODE:
+              built.push_back(triton::ast::bv(tnode.value, tnode.size));
+              break;
+
+            case triton::ast::DECIMAL_NODE:
+              built.push_back(triton::ast::decimal(tnode.value));
+              break;
+
+            case triton::ast::REFERENCE_NODE:
+              built.push_back(triton::ast::reference(ids[tnode.value.convert_to<triton::uint32>()]));
+              break;
+
+            default:
+              for (triton::uint32 index : tnode.childs)
+                childs.push_back(built[index]);
+              built.push_back(triton::ast::buildNode(tnode.kind, childs));
+              break;
+          }
+        }
+
+        if (expr.kind == triton::engines::symbolic::UNDEF)
+          se = triton::api.createSymbolicVolatileExpression(inst, built[expr.root], expr.comment);
+        else if (reg.isFlag())
+          se = triton::api.createSymbolicFlagExpression(inst, built[expr.root], reg, expr.comment);
+        else
+          se = triton::api.createSymbolicRegisterExpression(inst, built[expr.root], reg, expr.comment);
+
+        ids.push_back(se->getId());
+      }
+    }
+
+
+    void SemanticsTemplate::setTaint(triton::arch::Instruction& inst) const {
+      bool operands = false;
+
+      for (const triton::arch::OperandWrapper& op : inst.operands)
+        operands |= triton::api.isTainted(op);
+
+      /* Same taint as the semantics, the registers have already been tainted by the rules table */
+      for (triton::usize index = 0; index < this->expressions.size(); index++) {
+        const TemplateExpression& expr = this->expressions[index];
+        triton::engines::symbolic::SymbolicExpression* se = inst.symbolicExpressions[index];
+
+        if (expr.kind == triton::engines::symbolic::UNDEF)
+          se->isTainted = operands;
+        else if (!this->nodes[expr.root].dependent)
+          se->isTainted = triton::api.setTaintRegister(expr.reg, triton::engines::taint::UNTAINTED);
+        else
+          se->isTainted = triton::api.isRegisterTainted(expr.reg);
+      }
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -598,6 +598,11 @@ namespace triton {
       }
 
 
+      triton::arch::RegisterSpecification x8664Cpu::getRegisterSpecification(triton::uint32 reg) const {
+        return triton::arch::x86::registerIdToRegisterSpecification(reg);
+      }
+
+
       std::set<triton::arch::Register*> x8664Cpu::getAllRegisters(void) const {
         std::set<triton::arch::Register*> ret;
 
@@ -785,15 +790,33 @@ namespace triton {
 
 
       std::vector<triton::uint8> x8664Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
 
-        for (triton::usize index = 0; index < size; index++) {
-          if (execCallbacks)
+        if (size)
+          this->getConcreteMemoryAreaValue(baseAddr, area.data(), size, execCallbacks);
+
+        return area;
+      }
+
+
+      void x8664Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+        std::map<triton::uint64, triton::uint8>::const_iterator it;
+
+        if (execCallbacks) {
+          for (triton::usize index = 0; index < size; index++)
             triton::api.processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE));
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
         }
 
-        return area;
+        /* The cells are ordered, thus the area is read in one walk */
+        it = this->memory.lower_bound(baseAddr);
+        for (triton::usize index = 0; index < size; index++) {
+          if (it != this->memory.end() && it->first == baseAddr+index) {
+            area[index] = it->second;
+            it++;
+          }
+          else
+            area[index] = 0x00;
+        }
       }
 
 
@@ -1052,15 +1075,21 @@ namespace triton {
 
 
       void x8664Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->memory[baseAddr+index] = values[index];
-        }
+        if (!values.empty())
+          this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
       }
 
 
       void x8664Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+        std::map<triton::uint64, triton::uint8>::iterator it = this->memory.lower_bound(baseAddr);
+
+        /* Each cell is inserted next to the previous one, thus without a lookup */
         for (triton::usize index = 0; index < size; index++) {
-          this->memory[baseAddr+index] = area[index];
+          if (it != this->memory.end() && it->first == baseAddr+index)
+            it->second = area[index];
+          else
+            it = this->memory.insert(it, std::make_pair(baseAddr+index, area[index]));
+          it++;
         }
       }
 
@@ -0,0 +1,523 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <api.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+#include <x86Semantics.hpp>
+#include <x86Specifications.hpp>
+
+
+
+/*! \page concrete_fast_path_page Concrete fast path
+    \brief [**internal**] The concrete fast path of the x86 semantics.
+
+\tableofcontents
+
+\section concrete_fast_path_description Description
+<hr>
+
+When the triton::engines::symbolic::CONCRETE_FAST_PATH optimization is enabled, common x86 instructions whose inputs
+(registers, memory cells and flags) are neither symbolized nor tainted are emulated natively. No AST node nor symbolic
+expression is created for them, only the concrete state is updated. Written registers, memory cells and flags are
+concretized and untainted, which is the state the symbolic semantics would lead to when the
+triton::engines::symbolic::ONLY_ON_SYMBOLIZED optimization is enabled.
+
+As there is no AST, the load, store and register accesses of such instructions are not recorded into the
+triton::arch::Instruction class. Any other instruction (or an instruction with a symbolized or tainted input)
+goes through the symbolic semantics.
+
+*/
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+      namespace semantics {
+
+        /* Returns the mask of a bit-vector */
+        static triton::uint64 bvMask(triton::uint32 bvSize) {
+          return (bvSize >= QWORD_SIZE_BIT) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << bvSize) - 1);
+        }
+
+
+        /* Returns the most significant bit of a bit-vector */
+        static bool bvMsb(triton::uint64 value, triton::uint32 bvSize) {
+          return ((value >> (bvSize - 1)) & 1);
+        }
+
+
+        /* Returns the sign extension of a bit-vector */
+        static triton::uint64 bvSx(triton::uint64 value, triton::uint32 from, triton::uint32 to) {
+          if (bvMsb(value, from))
+            value |= ~bvMask(from);
+          return value & bvMask(to);
+        }
+
+
+        /* Returns true if the register is a concrete general purpose register */
+        static bool isConcreteRegister(const triton::arch::Register& reg) {
+          triton::arch::Register parent = reg.getParent();
+          triton::uint32 parentId       = parent.getId();
+          triton::usize symReg          = triton::engines::symbolic::UNSET;
+
+          if (parentId < ID_REG_RAX || parentId >= ID_REG_EFLAGS || parentId == ID_REG_RIP || parentId == ID_REG_EIP)
+            return false;
+
+          if (triton::api.isRegisterTainted(parent))
+            return false;
+
+          symReg = triton::api.getSymbolicRegisterId(parent);
+          if (symReg != triton::engines::symbolic::UNSET && triton::api.getAstFromId(symReg)->isSymbolized())
+            return false;
+
+          return true;
+        }
+
+
+        /* Returns true if the flag is concrete */
+        static bool isConcreteFlag(const triton::arch::Register& flag) {
+          triton::usize symReg = triton::api.getSymbolicRegisterId(flag);
+
+          if (triton::api.isRegisterTainted(flag))
+            return false;
+
+          if (symReg != triton::engines::symbolic::UNSET && triton::api.getAstFromId(symReg)->isSymbolized())
+            return false;
+
+          return true;
+        }
+
+
+        /* Returns true if the memory access (its content and its address) is concrete */
+        static bool isConcreteMemory(const triton::arch::MemoryAccess& mem) {
+          triton::uint64 addr = mem.getAddress();
+          triton::usize symMem = triton::engines::symbolic::UNSET;
+
+          if (mem.getLeaAst() && mem.getLeaAst()->isSymbolized())
+            return false;
+
+          if (triton::api.isMemoryTainted(mem))
+            return false;
+
+          for (triton::uint32 index = 0; index < mem.getSize(); index++) {
+            symMem = triton::api.getSymbolicMemoryId(addr + index);
+            if (symMem != triton::engines::symbolic::UNSET && triton::api.getAstFromId(symMem)->isSymbolized())
+              return false;
+          }
+
+          return true;
+        }
+
+
+        /* Returns true if the operand is a concrete input which fits into 64 bits */
+        static bool isConcreteOperand(triton::arch::OperandWrapper& op) {
+          if (op.getBitSize() > QWORD_SIZE_BIT)
+            return false;
+
+          switch (op.getType()) {
+            case triton::arch::OP_IMM: return true;
+            case triton::arch::OP_MEM: return isConcreteMemory(op.getConstMemory());
+            case triton::arch::OP_REG: return isConcreteRegister(op.getConstRegister());
+            default:
+              return false;
+          }
+        }
+
+
+        /* Returns true if all operands of the instruction are concrete */
+        static bool isConcreteOperands(triton::arch::Instruction& inst) {
+          for (triton::uint32 index = 0; index < inst.operands.size(); index++) {
+            if (!isConcreteOperand(inst.operands[index]))
+              return false;
+          }
+          return true;
+        }
+
+
+        /* Returns the concrete value of an operand */
+        static triton::uint64 readOperand(triton::arch::OperandWrapper& op) {
+          switch (op.getType()) {
+            case triton::arch::OP_IMM: return op.getConstImmediate().getValue();
+            case triton::arch::OP_MEM: return triton::api.getConcreteMemoryValue(op.getConstMemory()).convert_to<triton::uint64>();
+            case triton::arch::OP_REG: return triton::api.getConcreteRegisterValue(op.getConstRegister()).convert_to<triton::uint64>();
+            default:
+              throw triton::exceptions::Semantics("x86ConcreteSemantics::readOperand(): Invalid operand.");
+          }
+        }
+
+
+        /* Writes a concrete value into a register. The register is concretized and untainted */
+        static void writeRegister(const triton::arch::Register& reg, triton::uint64 value) {
+          triton::arch::Register parent = reg.getParent();
+
+          /* In AMD64, if a reg32 is written, it clears the 32-bit MSB of the corresponding register */
+          if (reg.getSize() == DWORD_SIZE && triton::api.getArchitecture() == triton::arch::ARCH_X86_64)
+            triton::api.setConcreteRegisterValue(triton::arch::Register(parent.getId(), value & bvMask(DWORD_SIZE_BIT)));
+          else
+            triton::api.setConcreteRegisterValue(triton::arch::Register(reg.getId(), value & bvMask(reg.getBitSize())));
+
+          triton::api.concretizeRegister(parent);
+          triton::api.setTaintRegister(parent, triton::engines::taint::UNTAINTED);
+        }
+
+
+        /* Writes a concrete value into a memory. The memory is concretized and untainted */
+        static void writeMemory(const triton::arch::MemoryAccess& mem, triton::uint64 value) {
+          triton::arch::MemoryAccess dst(mem.getAddress(), mem.getSize(), value & bvMask(mem.getBitSize()));
+          triton::api.setConcreteMemoryValue(dst);
+          triton::api.concretizeMemory(dst);
+          triton::api.setTaintMemory(dst, triton::engines::taint::UNTAINTED);
+        }
+
+
+        /* Writes a concrete value into an operand */
+        static void writeOperand(triton::arch::OperandWrapper& op, triton::uint64 value) {
+          switch (op.getType()) {
+            case triton::arch::OP_MEM: writeMemory(op.getConstMemory(), value); break;
+            case triton::arch::OP_REG: writeRegister(op.getConstRegister(), value); break;
+            default:
+              throw triton::exceptions::Semantics("x86ConcreteSemantics::writeOperand(): Invalid operand.");
+          }
+        }
+
+
+        /* Writes a concrete flag. The flag is concretized and untainted */
+        static void writeFlag(const triton::arch::Register& flag, bool value) {
+          triton::api.setConcreteRegisterValue(triton::arch::Register(flag.getId(), value));
+          triton::api.concretizeRegister(flag);
+          triton::api.setTaintRegister(flag, triton::engines::taint::UNTAINTED);
+        }
+
+
+        /* Writes the PF, SF and ZF flags according to a result */
+        static void writeResultFlags(triton::uint64 res, triton::uint32 bvSize) {
+          triton::uint8 low = static_cast<triton::uint8>(res);
+          bool pf = true;
+
+          /* pf is set to one if there is an even number of bit set to 1 in the least significant byte of the result */
+          for (triton::uint32 counter = 0; counter < BYTE_SIZE_BIT; counter++)
+            pf ^= ((low >> counter) & 1);
+
+          writeFlag(TRITON_X86_REG_PF, pf);
+          writeFlag(TRITON_X86_REG_SF, bvMsb(res, bvSize));
+          writeFlag(TRITON_X86_REG_ZF, (res & bvMask(bvSize)) == 0);
+        }
+
+
+        /* Writes the program counter. The program counter is concretized and untainted */
+        static void writeProgramCounter(triton::uint64 value) {
+          writeRegister(TRITON_X86_REG_PC.getParent(), value);
+        }
+
+
+        /* Returns the condition of a conditional jump. Returns false if the flags of the condition are not concrete */
+        static bool jccCondition(triton::uint32 type, bool& taken) {
+          auto& cf = TRITON_X86_REG_CF;
+          auto& of = TRITON_X86_REG_OF;
+          auto& pf = TRITON_X86_REG_PF;
+          auto& sf = TRITON_X86_REG_SF;
+          auto& zf = TRITON_X86_REG_ZF;
+
+          if (!isConcreteFlag(cf) || !isConcreteFlag(of) || !isConcreteFlag(pf) || !isConcreteFlag(sf) || !isConcreteFlag(zf))
+            return false;
+
+          bool cfv = (triton::api.getConcreteRegisterValue(cf) != 0);
+          bool ofv = (triton::api.getConcreteRegisterValue(of) != 0);
+          bool pfv = (triton::api.getConcreteRegisterValue(pf) != 0);
+          bool sfv = (triton::api.getConcreteRegisterValue(sf) != 0);
+          bool zfv = (triton::api.getConcreteRegisterValue(zf) != 0);
+
+          switch (type) {
+            case ID_INS_JA:   taken = (!cfv && !zfv);       break;
+            case ID_INS_JAE:  taken = !cfv;                 break;
+            case ID_INS_JB:   taken = cfv;                  break;
+            case ID_INS_JBE:  taken = (cfv || zfv);         break;
+            case ID_INS_JE:   taken = zfv;                  break;
+            case ID_INS_JG:   taken = (!zfv && sfv == ofv); break;
+            case ID_INS_JGE:  taken = (sfv == ofv);         break;
+            case ID_INS_JL:   taken = (sfv != ofv);         break;
+            case ID_INS_JLE:  taken = (zfv || sfv != ofv);  break;
+            case ID_INS_JNE:  taken = !zfv;                 break;
+            case ID_INS_JNO:  taken = !ofv;                 break;
+            case ID_INS_JNP:  taken = !pfv;                 break;
+            case ID_INS_JNS:  taken = !sfv;                 break;
+            case ID_INS_JO:   taken = ofv;                  break;
+            case ID_INS_JP:   taken = pfv;                  break;
+            case ID_INS_JS:   taken = sfv;                  break;
+            default:
+              return false;
+          }
+
+          return true;
+        }
+
+
+        /* Binary arithmetic and logic operations */
+        static bool binaryOperation(triton::arch::Instruction& inst) {
+          auto& dst           = inst.operands[0];
+          auto& src           = inst.operands[1];
+          triton::uint32 size = dst.getBitSize();
+          triton::uint64 op1  = readOperand(dst) & bvMask(size);
+          triton::uint64 op2  = bvSx(readOperand(src), src.getBitSize(), size);
+          triton::uint64 res  = 0;
+
+          switch (inst.getType()) {
+            case ID_INS_ADD:
+              res = (op1 + op2) & bvMask(size);
+              writeOperand(dst, res);
+              writeFlag(TRITON_X86_REG_AF, ((res ^ op1 ^ op2) & 0x10) != 0);
+              writeFlag(TRITON_X86_REG_CF, bvMsb((op1 & op2) ^ ((op1 ^ op2 ^ res) & (op1 ^ op2)), size));
+              writeFlag(TRITON_X86_REG_OF, bvMsb((op1 ^ ~op2) & (op1 ^ res), size));
+              break;
+
+            case ID_INS_SUB:
+            case ID_INS_CMP:
+              res = (op1 - op2) & bvMask(size);
+              if (inst.getType() == ID_INS_SUB)
+                writeOperand(dst, res);
+              writeFlag(TRITON_X86_REG_AF, ((res ^ op1 ^ op2) & 0x10) != 0);
+              writeFlag(TRITON_X86_REG_CF, bvMsb((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)), size));
+              writeFlag(TRITON_X86_REG_OF, bvMsb((op1 ^ op2) & (op1 ^ res), size));
+              break;
+
+            case ID_INS_AND:
+            case ID_INS_TEST:
+              res = op1 & op2;
+              if (inst.getType() == ID_INS_AND)
+                writeOperand(dst, res);
+              writeFlag(TRITON_X86_REG_CF, false);
+              writeFlag(TRITON_X86_REG_OF, false);
+              break;
+
+            case ID_INS_OR:
+              res = op1 | op2;
+              writeOperand(dst, res);
+              writeFlag(TRITON_X86_REG_CF, false);
+              writeFlag(TRITON_X86_REG_OF, false);
+              break;
+
+            case ID_INS_XOR:
+              res = op1 ^ op2;
+              writeOperand(dst, res);
+              writeFlag(TRITON_X86_REG_CF, false);
+              writeFlag(TRITON_X86_REG_OF, false);
+              break;
+
+            default:
+              return false;
+          }
+
+          writeResultFlags(res, size);
+          return true;
+        }
+
+
+        /* Unary arithmetic and logic operations */
+        static bool unaryOperation(triton::arch::Instruction& inst) {
+          auto& dst           = inst.operands[0];
+          triton::uint32 size = dst.getBitSize();
+          triton::uint64 op1  = readOperand(dst) & bvMask(size);
+          triton::uint64 res  = 0;
+
+          switch (inst.getType()) {
+            case ID_INS_INC:
+              res = (op1 + 1) & bvMask(size);
+              writeOperand(dst, res);
+              writeFlag(TRITON_X86_REG_AF, ((res ^ op1 ^ 1) & 0x10) != 0);
+              writeFlag(TRITON_X86_REG_OF, bvMsb((op1 ^ ~static_cast<triton::uint64>(1)) & (op1 ^ res), size));
+              break;
+
+            case ID_INS_DEC:
+              res = (op1 - 1) & bvMask(size);
+              writeOperand(dst, res);
+              writeFlag(TRITON_X86_REG_AF, ((res ^ op1 ^ 1) & 0x10) != 0);
+              writeFlag(TRITON_X86_REG_OF, bvMsb((op1 ^ 1) & (op1 ^ res), size));
+              break;
+
+            case ID_INS_NEG:
+              res = (0 - op1) & bvMask(size);
+              writeOperand(dst, res);
+              writeFlag(TRITON_X86_REG_AF, ((op1 ^ res) & 0x10) != 0);
+              writeFlag(TRITON_X86_REG_CF, op1 != 0);
+              writeFlag(TRITON_X86_REG_OF, bvMsb(res & op1, size));
+              break;
+
+            case ID_INS_NOT:
+              writeOperand(dst, ~op1);
+              return true;
+
+            default:
+              return false;
+          }
+
+          writeResultFlags(res, size);
+          return true;
+        }
+
+
+        bool buildConcrete(triton::arch::Instruction& inst) {
+          auto stack           = TRITON_X86_REG_SP.getParent();
+          triton::uint32 type  = inst.getType();
+          triton::uint64 next  = inst.getNextAddress();
+          triton::uint64 sp    = 0;
+          bool branch          = (type == ID_INS_JMP || type == ID_INS_CALL || type == ID_INS_RET || (type >= ID_INS_JAE && type <= ID_INS_JS));
+          bool taken           = false;
+
+          /* Instructions with a repeat prefix update the counter and are not handled */
+          if (inst.getPrefix() != ID_PREFIX_INVALID && inst.getPrefix() != ID_PREFIX_LOCK)
+            return false;
+
+          /* Concrete branches do not create path constraints only if they are tracked when symbolized */
+          if (branch && !triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::PC_TRACKING_SYMBOLIC))
+            return false;
+
+          if (!isConcreteOperands(inst))
+            return false;
+
+          switch (type) {
+            case ID_INS_ADD:
+            case ID_INS_AND:
+            case ID_INS_CMP:
+            case ID_INS_OR:
+            case ID_INS_SUB:
+            case ID_INS_TEST:
+            case ID_INS_XOR:
+              /* Partial writes keep the other bits of the parent register */
+              if (inst.operands.size() != 2 || !binaryOperation(inst))
+                return false;
+              break;
+
+            case ID_INS_DEC:
+            case ID_INS_INC:
+            case ID_INS_NEG:
+            case ID_INS_NOT:
+              if (inst.operands.size() != 1 || inst.operands[0].getType() == triton::arch::OP_IMM || !unaryOperation(inst))
+                return false;
+              break;
+
+            case ID_INS_MOV:
+            case ID_INS_MOVABS:
+            case ID_INS_MOVSX:
+            case ID_INS_MOVSXD:
+            case ID_INS_MOVZX: {
+              if (inst.operands.size() != 2 || inst.operands[0].getType() == triton::arch::OP_IMM)
+                return false;
+              /* The destination of a partial register write is an input too */
+              auto& dst = inst.operands[0];
+              auto& src = inst.operands[1];
+              triton::uint64 value = readOperand(src) & bvMask(src.getBitSize());
+              if (type == ID_INS_MOVSX || type == ID_INS_MOVSXD)
+                value = bvSx(value, src.getBitSize(), dst.getBitSize());
+              writeOperand(dst, value);
+              break;
+            }
+
+            case ID_INS_LEA: {
+              if (inst.operands.size() != 2 || inst.operands[1].getType() != triton::arch::OP_MEM)
+                return false;
+              auto& dst   = inst.operands[0].getRegister();
+              auto& mem   = inst.operands[1].getMemory();
+              auto  base  = mem.getBaseRegister();
+              auto  index = mem.getIndexRegister();
+              if ((base.isValid() && !isConcreteRegister(base)) || (index.isValid() && !isConcreteRegister(index)) || mem.getSegmentRegister().isValid())
+                return false;
+              triton::uint32 leaSize = base.isValid() ? base.getBitSize() : index.isValid() ? index.getBitSize() : mem.getDisplacement().getBitSize();
+              triton::uint64 value   = mem.getDisplacement().getValue();
+              if (base.isValid())
+                value += triton::api.getConcreteRegisterValue(base).convert_to<triton::uint64>();
+              if (index.isValid())
+                value += triton::api.getConcreteRegisterValue(index).convert_to<triton::uint64>() * mem.getScale().getValue();
+              writeRegister(dst, value & bvMask(leaSize));
+              break;
+            }
+
+            case ID_INS_NOP:
+              break;
+
+            case ID_INS_PUSH: {
+              if (inst.operands.size() != 1 || !isConcreteRegister(stack))
+                return false;
+              auto& src = inst.operands[0];
+              triton::uint64 value = readOperand(src);
+              sp = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>() - src.getSize();
+              writeRegister(stack, sp);
+              writeMemory(triton::arch::MemoryAccess(sp, src.getSize()), value);
+              break;
+            }
+
+            case ID_INS_POP: {
+              if (inst.operands.size() != 1 || inst.operands[0].getType() == triton::arch::OP_IMM || !isConcreteRegister(stack))
+                return false;
+              auto& dst = inst.operands[0];
+              /* pop rsp/esp is left to the symbolic semantics, so both paths give the same stack pointer */
+              if (dst.getType() == triton::arch::OP_REG && dst.getConstRegister().getParent().getId() == stack.getId())
+                return false;
+              sp = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+              triton::arch::MemoryAccess src(sp, dst.getSize());
+              if (!isConcreteMemory(src))
+                return false;
+              triton::uint64 value = triton::api.getConcreteMemoryValue(src).convert_to<triton::uint64>();
+              writeOperand(dst, value);
+              writeRegister(stack, sp + dst.getSize());
+              break;
+            }
+
+            case ID_INS_CALL: {
+              if (inst.operands.size() != 1 || !isConcreteRegister(stack))
+                return false;
+              triton::uint64 target = readOperand(inst.operands[0]);
+              sp = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>() - stack.getSize();
+              writeRegister(stack, sp);
+              writeMemory(triton::arch::MemoryAccess(sp, stack.getSize()), next);
+              next = target;
+              break;
+            }
+
+            case ID_INS_RET: {
+              if (!isConcreteRegister(stack))
+                return false;
+              sp = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+              triton::arch::MemoryAccess src(sp, stack.getSize());
+              if (!isConcreteMemory(src))
+                return false;
+              next = triton::api.getConcreteMemoryValue(src).convert_to<triton::uint64>();
+              sp  += stack.getSize();
+              if (inst.operands.size() > 0)
+                sp += readOperand(inst.operands[0]);
+              writeRegister(stack, sp);
+              break;
+            }
+
+            case ID_INS_JMP:
+              if (inst.operands.size() != 1)
+                return false;
+              next = readOperand(inst.operands[0]);
+              inst.setConditionTaken(true);
+              break;
+
+            default:
+              if (!branch || inst.operands.size() != 1 || inst.operands[0].getType() != triton::arch::OP_IMM)
+                return false;
+              if (!jccCondition(type, taken))
+                return false;
+              if (taken) {
+                next = inst.operands[0].getImmediate().getValue();
+                inst.setConditionTaken(true);
+              }
+              break;
+          }
+
+          writeProgramCounter(next);
+          return true;
+        }
+
+      }; /* semantics namespace */
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -299,7 +299,79 @@ namespace triton {
       namespace semantics {
 
 
+        /* The register-only instructions whose semantics do not depend on concrete values */
+        static bool isTemplateInstruction(const triton::arch::Instruction& inst) {
+          if (inst.getPrefix() != ID_PREFIX_INVALID)
+            return false;
+
+          for (triton::usize index = 0; index < inst.operands.size(); index++) {
+            if (inst.operands[index].getType() != triton::arch::OP_REG && inst.operands[index].getType() != triton::arch::OP_IMM)
+              return false;
+          }
+
+          switch (inst.getType()) {
+            case ID_INS_ADC:
+            case ID_INS_ADD:
+            case ID_INS_AND:
+            case ID_INS_BSWAP:
+            case ID_INS_CMP:
+            case ID_INS_DEC:
+            case ID_INS_INC:
+            case ID_INS_MOV:
+            case ID_INS_MOVABS:
+            case ID_INS_MOVSX:
+            case ID_INS_MOVSXD:
+            case ID_INS_MOVZX:
+            case ID_INS_NEG:
+            case ID_INS_NOT:
+            case ID_INS_OR:
+            case ID_INS_SBB:
+            case ID_INS_SUB:
+            case ID_INS_TEST:
+            case ID_INS_XOR:
+              return true;
+            default:
+              return false;
+          }
+        }
+
+
         bool build(triton::arch::Instruction& inst) {
+          bool taintOnly = triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::TAINT_ONLY);
+
+          /* The taint-only mode skips the initialization of the memory operands, their address is computed without AST */
+          if (taintOnly) {
+            for (triton::usize index = 0; index < inst.operands.size(); index++) {
+              if (inst.operands[index].getType() == triton::arch::OP_MEM)
+                inst.operands[index].getMemory().initConcreteAddress();
+            }
+          }
+
+          /* Instructions without symbolized nor tainted inputs may be emulated natively */
+          if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::CONCRETE_FAST_PATH) && triton::arch::x86::semantics::buildConcrete(inst))
+            return true;
+
+          /* Only spread the taint through the rules table. Unsupported instructions go through the whole semantics */
+          if (taintOnly) {
+            if (triton::arch::x86::semantics::buildTaint(inst))
+              return true;
+            for (triton::usize index = 0; index < inst.operands.size(); index++) {
+              if (inst.operands[index].getType() == triton::arch::OP_MEM)
+                inst.operands[index].getMemory().initAddress();
+            }
+          }
+
+          /* An instruction already processed at this address is rebuilt from its template */
+          bool templates = triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::SEMANTICS_TEMPLATES) && isTemplateInstruction(inst);
+          if (templates) {
+            const triton::arch::SemanticsTemplate* cached = triton::api.getSemanticsTemplate(inst);
+            if (cached != nullptr && triton::arch::x86::semantics::buildTaint(inst)) {
+              cached->instantiate(inst);
+              cached->setTaint(inst);
+              return true;
+            }
+          }
+
           switch (inst.getType()) {
             case ID_INS_ADC:            triton::arch::x86::semantics::adc_s(inst);          break;
             case ID_INS_ADD:            triton::arch::x86::semantics::add_s(inst);          break;
@@ -560,6 +632,10 @@ namespace triton {
             default:
               return false;
           }
+
+          if (templates)
+            triton::api.recordSemanticsTemplate(inst);
+
           return true;
         }
 
@@ -761,7 +837,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_AF, "Adjust flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AF, parent->isTainted, inst);
         }
 
 
@@ -793,7 +869,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_AF, "Adjust flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AF, parent->isTainted, inst);
         }
 
 
@@ -822,7 +898,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -844,7 +920,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -868,7 +944,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -892,7 +968,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -918,7 +994,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -946,7 +1022,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -977,7 +1053,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -1005,7 +1081,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -1034,7 +1110,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -1064,7 +1140,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -1094,7 +1170,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -1123,7 +1199,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -1150,7 +1226,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_CF, parent->isTainted, inst);
         }
 
 
@@ -1174,7 +1250,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1196,7 +1272,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1220,7 +1296,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1244,7 +1320,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1279,7 +1355,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1313,7 +1389,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1347,7 +1423,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1371,7 +1447,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1400,7 +1476,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1424,7 +1500,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1448,7 +1524,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_OF, parent->isTainted, inst);
         }
 
 
@@ -1479,7 +1555,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_PF, "Parity flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_PF, parent->isTainted, inst);
         }
 
 
@@ -1516,7 +1592,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node2, TRITON_X86_REG_PF, "Parity flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_PF, parent->isTainted, inst);
         }
 
 
@@ -1534,7 +1610,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_SF, parent->isTainted, inst);
         }
 
 
@@ -1557,7 +1633,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_SF, parent->isTainted, inst);
         }
 
 
@@ -1583,7 +1659,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted, inst);
         }
 
 
@@ -1604,7 +1680,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted, inst);
         }
 
 
@@ -1635,7 +1711,7 @@ namespace triton {
           auto expr = triton::api.createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+          expr->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted, inst);
         }
 
 
@@ -2488,7 +2564,7 @@ namespace triton {
           auto expr2 = triton::api.createSymbolicExpression(inst, node2, src, "CDQ EAX operation");
 
           /* Spread taint */
-          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_EAX, expr1->isTainted);
+          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_EAX, expr1->isTainted, inst);
 
           /* Create the semantics - EDX = TMP[63...32] */
           auto node3 = triton::ast::extract(QWORD_SIZE_BIT-1, DWORD_SIZE_BIT, triton::ast::reference(expr1->getId()));
@@ -2497,7 +2573,7 @@ namespace triton {
           auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst, "CDQ EDX operation");
 
           /* Spread taint */
-          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_EDX, expr1->isTainted);
+          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_EDX, expr1->isTainted, inst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3653,7 +3729,7 @@ namespace triton {
           auto expr2 = triton::api.createSymbolicExpression(inst, node2, src, "CQO RAX operation");
 
           /* Spread taint */
-          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_RAX, expr1->isTainted);
+          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_RAX, expr1->isTainted, inst);
 
           /* Create the semantics - RDX = TMP[127...64] */
           auto node3 = triton::ast::extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, triton::ast::reference(expr1->getId()));
@@ -3662,7 +3738,7 @@ namespace triton {
           auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst, "CQO RDX operation");
 
           /* Spread taint */
-          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_RDX, expr1->isTainted);
+          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_RDX, expr1->isTainted, inst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -3692,7 +3768,7 @@ namespace triton {
           auto expr2 = triton::api.createSymbolicExpression(inst, node2, src, "CWD AX operation");
 
           /* Spread taint */
-          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AX, expr1->isTainted);
+          expr2->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_AX, expr1->isTainted, inst);
 
           /* Create the semantics - DX = TMP[31...16] */
           auto node3 = triton::ast::extract(DWORD_SIZE_BIT-1, WORD_SIZE_BIT, triton::ast::reference(expr1->getId()));
@@ -3701,7 +3777,7 @@ namespace triton {
           auto expr3 = triton::api.createSymbolicExpression(inst, node3, dst, "CWD DX operation");
 
           /* Spread taint */
-          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_DX, expr1->isTainted);
+          expr3->isTainted = triton::api.setTaintRegister(TRITON_X86_REG_DX, expr1->isTainted, inst);
 
           /* Upate the symbolic control flow */
           triton::arch::x86::semantics::controlFlow_s(inst);
@@ -4733,10 +4809,10 @@ namespace triton {
 
         void lea_s(triton::arch::Instruction& inst) {
           auto& dst                = inst.operands[0].getRegister();
-          auto& srcDisp            = inst.operands[1].getMemory().getDisplacement();
-          auto& srcBase            = inst.operands[1].getMemory().getBaseRegister();
-          auto& srcIndex           = inst.operands[1].getMemory().getIndexRegister();
-          auto& srcScale           = inst.operands[1].getMemory().getScale();
+          auto srcDisp             = inst.operands[1].getMemory().getDisplacement();
+          auto srcBase             = inst.operands[1].getMemory().getBaseRegister();
+          auto srcIndex            = inst.operands[1].getMemory().getIndexRegister();
+          auto srcScale            = inst.operands[1].getMemory().getScale();
           triton::uint32 leaSize   = 0;
 
           /* Setup LEA size */
@@ -444,1367 +444,239 @@ namespace triton {
       };
 
 
-      /* Returns all information about a register from its triton id */
-      std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> registerIdToRegisterInformation(triton::uint32 reg) {
-
-        std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> ret;
-
-        std::get<0>(ret) = "unknown"; /* name           */
-        std::get<1>(ret) = 0;         /* highest bit    */
-        std::get<2>(ret) = 0;         /* lower bit      */
-        std::get<3>(ret) = 0;         /* higest reg id  */
-
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return ret;
-
-        switch (reg) {
-
-          case triton::arch::x86::ID_REG_RAX:
-            std::get<0>(ret) = "rax";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RAX;
-            break;
-
-          case triton::arch::x86::ID_REG_EAX:
-            std::get<0>(ret) = "eax";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
-            break;
-
-          case triton::arch::x86::ID_REG_AX:
-            std::get<0>(ret) = "ax";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
-            break;
-
-          case triton::arch::x86::ID_REG_AH:
-            std::get<0>(ret) = "ah";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = BYTE_SIZE_BIT;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
-            break;
-
-          case triton::arch::x86::ID_REG_AL:
-            std::get<0>(ret) = "al";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX;
-            break;
-
-          case triton::arch::x86::ID_REG_RBX:
-            std::get<0>(ret) = "rbx";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RBX;
-            break;
-
-          case triton::arch::x86::ID_REG_EBX:
-            std::get<0>(ret) = "ebx";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
-            break;
-
-          case triton::arch::x86::ID_REG_BX:
-            std::get<0>(ret) = "bx";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
-            break;
-
-          case triton::arch::x86::ID_REG_BH:
-            std::get<0>(ret) = "bh";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = BYTE_SIZE_BIT;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
-            break;
-
-          case triton::arch::x86::ID_REG_BL:
-            std::get<0>(ret) = "bl";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX;
-            break;
-
-          case triton::arch::x86::ID_REG_RCX:
-            std::get<0>(ret) = "rcx";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RCX;
-            break;
-
-          case triton::arch::x86::ID_REG_ECX:
-            std::get<0>(ret) = "ecx";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
-            break;
-
-          case triton::arch::x86::ID_REG_CX:
-            std::get<0>(ret) = "cx";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
-            break;
-
-          case triton::arch::x86::ID_REG_CH:
-            std::get<0>(ret) = "ch";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = BYTE_SIZE_BIT;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
-            break;
-
-          case triton::arch::x86::ID_REG_CL:
-            std::get<0>(ret) = "cl";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX;
-            break;
-
-          case triton::arch::x86::ID_REG_RDX:
-            std::get<0>(ret) = "rdx";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RDX;
-            break;
-
-          case triton::arch::x86::ID_REG_EDX:
-            std::get<0>(ret) = "edx";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
-            break;
-
-          case triton::arch::x86::ID_REG_DX:
-            std::get<0>(ret) = "dx";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
-            break;
-
-          case triton::arch::x86::ID_REG_DH:
-            std::get<0>(ret) = "dh";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = BYTE_SIZE_BIT;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
-            break;
-
-          case triton::arch::x86::ID_REG_DL:
-            std::get<0>(ret) = "dl";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX;
-            break;
-
-          case triton::arch::x86::ID_REG_RDI:
-            std::get<0>(ret) = "rdi";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RDI;
-            break;
-
-          case triton::arch::x86::ID_REG_EDI:
-            std::get<0>(ret) = "edi";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI;
-            break;
-
-          case triton::arch::x86::ID_REG_DI:
-            std::get<0>(ret) = "di";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI;
-            break;
-
-          case triton::arch::x86::ID_REG_DIL:
-            std::get<0>(ret) = "dil";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI;
-            break;
-
-          case triton::arch::x86::ID_REG_RSI:
-            std::get<0>(ret) = "rsi";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RSI;
-            break;
-
-          case triton::arch::x86::ID_REG_ESI:
-            std::get<0>(ret) = "esi";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI;
-            break;
-
-          case triton::arch::x86::ID_REG_SI:
-            std::get<0>(ret) = "si";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI;
-            break;
-
-          case triton::arch::x86::ID_REG_SIL:
-            std::get<0>(ret) = "sil";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI;
-            break;
-
-          case triton::arch::x86::ID_REG_RBP:
-            std::get<0>(ret) = "rbp";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RBP;
-            break;
-
-          case triton::arch::x86::ID_REG_EBP:
-            std::get<0>(ret) = "ebp";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP;
-            break;
-
-          case triton::arch::x86::ID_REG_BP:
-            std::get<0>(ret) = "bp";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP;
-            break;
-
-          case triton::arch::x86::ID_REG_BPL:
-            std::get<0>(ret) = "bpl";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP;
-            break;
-
-          case triton::arch::x86::ID_REG_RSP:
-            std::get<0>(ret) = "rsp";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RSP;
-            break;
-
-          case triton::arch::x86::ID_REG_ESP:
-            std::get<0>(ret) = "esp";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP;
-            break;
-
-          case triton::arch::x86::ID_REG_SP:
-            std::get<0>(ret) = "sp";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP;
-            break;
-
-          case triton::arch::x86::ID_REG_SPL:
-            std::get<0>(ret) = "spl";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP;
-            break;
-
-          case triton::arch::x86::ID_REG_RIP:
-            std::get<0>(ret) = "rip";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RIP;
-            break;
-
-          case triton::arch::x86::ID_REG_EIP:
-            std::get<0>(ret) = "eip";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP;
-            break;
-
-          case triton::arch::x86::ID_REG_IP:
-            std::get<0>(ret) = "ip";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP;
-            break;
-
-          case triton::arch::x86::ID_REG_EFLAGS:
-            std::get<0>(ret) = "eflags";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_EFLAGS;
-            break;
-
-          case triton::arch::x86::ID_REG_R8:
-            std::get<0>(ret) = "r8";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R8;
-            break;
-
-          case triton::arch::x86::ID_REG_R8D:
-            std::get<0>(ret) = "r8d";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R8;
-            break;
-
-          case triton::arch::x86::ID_REG_R8W:
-            std::get<0>(ret) = "r8w";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R8;
-            break;
-
-          case triton::arch::x86::ID_REG_R8B:
-            std::get<0>(ret) = "r8b";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R8;
-            break;
-
-          case triton::arch::x86::ID_REG_R9:
-            std::get<0>(ret) = "r9";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R9;
-            break;
-
-          case triton::arch::x86::ID_REG_R9D:
-            std::get<0>(ret) = "r9d";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R9;
-            break;
-
-          case triton::arch::x86::ID_REG_R9W:
-            std::get<0>(ret) = "r9w";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R9;
-            break;
-
-          case triton::arch::x86::ID_REG_R9B:
-            std::get<0>(ret) = "r9b";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R9;
-            break;
-
-          case triton::arch::x86::ID_REG_R10:
-            std::get<0>(ret) = "r10";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R10;
-            break;
-
-          case triton::arch::x86::ID_REG_R10D:
-            std::get<0>(ret) = "r10d";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R10;
-            break;
-
-          case triton::arch::x86::ID_REG_R10W:
-            std::get<0>(ret) = "r10w";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R10;
-            break;
-
-          case triton::arch::x86::ID_REG_R10B:
-            std::get<0>(ret) = "r10b";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R10;
-            break;
-
-          case triton::arch::x86::ID_REG_R11:
-            std::get<0>(ret) = "r11";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R11;
-            break;
-
-          case triton::arch::x86::ID_REG_R11D:
-            std::get<0>(ret) = "r11d";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R11;
-            break;
-
-          case triton::arch::x86::ID_REG_R11W:
-            std::get<0>(ret) = "r11w";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R11;
-            break;
-
-          case triton::arch::x86::ID_REG_R11B:
-            std::get<0>(ret) = "r11b";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R11;
-            break;
-
-          case triton::arch::x86::ID_REG_R12:
-            std::get<0>(ret) = "r12";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R12;
-            break;
-
-          case triton::arch::x86::ID_REG_R12D:
-            std::get<0>(ret) = "r12d";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R12;
-            break;
-
-          case triton::arch::x86::ID_REG_R12W:
-            std::get<0>(ret) = "r12w";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R12;
-            break;
-
-          case triton::arch::x86::ID_REG_R12B:
-            std::get<0>(ret) = "r12b";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R12;
-            break;
-
-          case triton::arch::x86::ID_REG_R13:
-            std::get<0>(ret) = "r13";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R13;
-            break;
-
-          case triton::arch::x86::ID_REG_R13D:
-            std::get<0>(ret) = "r13d";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R13;
-            break;
-
-          case triton::arch::x86::ID_REG_R13W:
-            std::get<0>(ret) = "r13w";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R13;
-            break;
-
-          case triton::arch::x86::ID_REG_R13B:
-            std::get<0>(ret) = "r13b";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R13;
-            break;
-
-          case triton::arch::x86::ID_REG_R14:
-            std::get<0>(ret) = "r14";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R14;
-            break;
-
-          case triton::arch::x86::ID_REG_R14D:
-            std::get<0>(ret) = "r14d";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R14;
-            break;
-
-          case triton::arch::x86::ID_REG_R14W:
-            std::get<0>(ret) = "r14w";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R14;
-            break;
-
-          case triton::arch::x86::ID_REG_R14B:
-            std::get<0>(ret) = "r14b";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R14;
-            break;
-
-          case triton::arch::x86::ID_REG_R15:
-            std::get<0>(ret) = "r15";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R15;
-            break;
-
-          case triton::arch::x86::ID_REG_R15D:
-            std::get<0>(ret) = "r15d";
-            std::get<1>(ret) = DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R15;
-            break;
-
-          case triton::arch::x86::ID_REG_R15W:
-            std::get<0>(ret) = "r15w";
-            std::get<1>(ret) = WORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R15;
-            break;
-
-          case triton::arch::x86::ID_REG_R15B:
-            std::get<0>(ret) = "r15b";
-            std::get<1>(ret) = BYTE_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_R15;
-            break;
-
-          case triton::arch::x86::ID_REG_MM0:
-            std::get<0>(ret) = "mm0";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_MM0;
-            break;
-
-          case triton::arch::x86::ID_REG_MM1:
-            std::get<0>(ret) = "mm1";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_MM1;
-            break;
-
-          case triton::arch::x86::ID_REG_MM2:
-            std::get<0>(ret) = "mm2";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_MM2;
-            break;
-
-          case triton::arch::x86::ID_REG_MM3:
-            std::get<0>(ret) = "mm3";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_MM3;
-            break;
-
-          case triton::arch::x86::ID_REG_MM4:
-            std::get<0>(ret) = "mm4";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_MM4;
-            break;
-
-          case triton::arch::x86::ID_REG_MM5:
-            std::get<0>(ret) = "mm5";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_MM5;
-            break;
-
-          case triton::arch::x86::ID_REG_MM6:
-            std::get<0>(ret) = "mm6";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_MM6;
-            break;
-
-          case triton::arch::x86::ID_REG_MM7:
-            std::get<0>(ret) = "mm7";
-            std::get<1>(ret) = QWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_MM7;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM0:
-            std::get<0>(ret) = "xmm0";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM0;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM1:
-            std::get<0>(ret) = "xmm1";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM1;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM2:
-            std::get<0>(ret) = "xmm2";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM2;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM3:
-            std::get<0>(ret) = "xmm3";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM3;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM4:
-            std::get<0>(ret) = "xmm4";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM4;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM5:
-            std::get<0>(ret) = "xmm5";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM5;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM6:
-            std::get<0>(ret) = "xmm6";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM6;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM7:
-            std::get<0>(ret) = "xmm7";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM7;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM8:
-            std::get<0>(ret) = "xmm8";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM8;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM9:
-            std::get<0>(ret) = "xmm9";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM9;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM10:
-            std::get<0>(ret) = "xmm10";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM10;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM11:
-            std::get<0>(ret) = "xmm11";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM11;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM12:
-            std::get<0>(ret) = "xmm12";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM12;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM13:
-            std::get<0>(ret) = "xmm13";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM13;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM14:
-            std::get<0>(ret) = "xmm14";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM14;
-            break;
-
-          case triton::arch::x86::ID_REG_XMM15:
-            std::get<0>(ret) = "xmm15";
-            std::get<1>(ret) = DQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_XMM15;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM0:
-            std::get<0>(ret) = "ymm0";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM0;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM1:
-            std::get<0>(ret) = "ymm1";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM1;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM2:
-            std::get<0>(ret) = "ymm2";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM2;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM3:
-            std::get<0>(ret) = "ymm3";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM3;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM4:
-            std::get<0>(ret) = "ymm4";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM4;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM5:
-            std::get<0>(ret) = "ymm5";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM5;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM6:
-            std::get<0>(ret) = "ymm6";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM6;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM7:
-            std::get<0>(ret) = "ymm7";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM7;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM8:
-            std::get<0>(ret) = "ymm8";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM8;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM9:
-            std::get<0>(ret) = "ymm9";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM9;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM10:
-            std::get<0>(ret) = "ymm10";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM10;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM11:
-            std::get<0>(ret) = "ymm11";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM11;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM12:
-            std::get<0>(ret) = "ymm12";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM12;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM13:
-            std::get<0>(ret) = "ymm13";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM13;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM14:
-            std::get<0>(ret) = "ymm14";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM14;
-            break;
-
-          case triton::arch::x86::ID_REG_YMM15:
-            std::get<0>(ret) = "ymm15";
-            std::get<1>(ret) = QQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_YMM15;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM0:
-            std::get<0>(ret) = "zmm0";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM0;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM1:
-            std::get<0>(ret) = "zmm1";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM1;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM2:
-            std::get<0>(ret) = "zmm2";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM2;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM3:
-            std::get<0>(ret) = "zmm3";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM3;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM4:
-            std::get<0>(ret) = "zmm4";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM4;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM5:
-            std::get<0>(ret) = "zmm5";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM5;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM6:
-            std::get<0>(ret) = "zmm6";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM6;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM7:
-            std::get<0>(ret) = "zmm7";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM7;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM8:
-            std::get<0>(ret) = "zmm8";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM8;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM9:
-            std::get<0>(ret) = "zmm9";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM9;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM10:
-            std::get<0>(ret) = "zmm10";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM10;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM11:
-            std::get<0>(ret) = "zmm11";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM11;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM12:
-            std::get<0>(ret) = "zmm12";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM12;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM13:
-            std::get<0>(ret) = "zmm13";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM13;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM14:
-            std::get<0>(ret) = "zmm14";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM14;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM15:
-            std::get<0>(ret) = "zmm15";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM15;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM16:
-            std::get<0>(ret) = "zmm16";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM16;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM17:
-            std::get<0>(ret) = "zmm17";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM17;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM18:
-            std::get<0>(ret) = "zmm18";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM18;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM19:
-            std::get<0>(ret) = "zmm19";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM19;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM20:
-            std::get<0>(ret) = "zmm20";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM20;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM21:
-            std::get<0>(ret) = "zmm21";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM21;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM22:
-            std::get<0>(ret) = "zmm22";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM22;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM23:
-            std::get<0>(ret) = "zmm23";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM23;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM24:
-            std::get<0>(ret) = "zmm24";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM24;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM25:
-            std::get<0>(ret) = "zmm25";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM25;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM26:
-            std::get<0>(ret) = "zmm26";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM26;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM27:
-            std::get<0>(ret) = "zmm27";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM27;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM28:
-            std::get<0>(ret) = "zmm28";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM28;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM29:
-            std::get<0>(ret) = "zmm29";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM29;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM30:
-            std::get<0>(ret) = "zmm30";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM30;
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM31:
-            std::get<0>(ret) = "zmm31";
-            std::get<1>(ret) = DQQWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZMM31;
-            break;
-
-          case triton::arch::x86::ID_REG_MXCSR:
-            std::get<0>(ret) = "mxcsr";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_MXCSR;
-            break;
-
-          case triton::arch::x86::ID_REG_CR0:
-            std::get<0>(ret) = "cr0";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR0;
-            break;
-
-          case triton::arch::x86::ID_REG_CR1:
-            std::get<0>(ret) = "cr1";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR1;
-            break;
-
-          case triton::arch::x86::ID_REG_CR2:
-            std::get<0>(ret) = "cr2";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR2;
-            break;
-
-          case triton::arch::x86::ID_REG_CR3:
-            std::get<0>(ret) = "cr3";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR3;
-            break;
-
-          case triton::arch::x86::ID_REG_CR4:
-            std::get<0>(ret) = "cr4";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR4;
-            break;
-
-          case triton::arch::x86::ID_REG_CR5:
-            std::get<0>(ret) = "cr5";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR5;
-            break;
-
-          case triton::arch::x86::ID_REG_CR6:
-            std::get<0>(ret) = "cr6";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR6;
-            break;
-
-          case triton::arch::x86::ID_REG_CR7:
-            std::get<0>(ret) = "cr7";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR7;
-            break;
-
-          case triton::arch::x86::ID_REG_CR8:
-            std::get<0>(ret) = "cr8";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR8;
-            break;
-
-          case triton::arch::x86::ID_REG_CR9:
-            std::get<0>(ret) = "cr9";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR9;
-            break;
-
-          case triton::arch::x86::ID_REG_CR10:
-            std::get<0>(ret) = "cr10";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR10;
-            break;
-
-          case triton::arch::x86::ID_REG_CR11:
-            std::get<0>(ret) = "cr11";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR11;
-            break;
-
-          case triton::arch::x86::ID_REG_CR12:
-            std::get<0>(ret) = "cr12";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR12;
-            break;
-
-          case triton::arch::x86::ID_REG_CR13:
-            std::get<0>(ret) = "cr13";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR13;
-            break;
-
-          case triton::arch::x86::ID_REG_CR14:
-            std::get<0>(ret) = "cr14";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR14;
-            break;
-
-          case triton::arch::x86::ID_REG_CR15:
-            std::get<0>(ret) = "cr15";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CR15;
-            break;
-
-          case triton::arch::x86::ID_REG_IE:
-            std::get<0>(ret) = "ie";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_IE;
-            break;
-
-          case triton::arch::x86::ID_REG_DE:
-            std::get<0>(ret) = "de";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_DE;
-            break;
-
-          case triton::arch::x86::ID_REG_ZE:
-            std::get<0>(ret) = "ze";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZE;
-            break;
-
-          case triton::arch::x86::ID_REG_OE:
-            std::get<0>(ret) = "oe";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_OE;
-            break;
-
-          case triton::arch::x86::ID_REG_UE:
-            std::get<0>(ret) = "ue";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_UE;
-            break;
-
-          case triton::arch::x86::ID_REG_PE:
-            std::get<0>(ret) = "pe";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_PE;
-            break;
-
-          case triton::arch::x86::ID_REG_DAZ:
-            std::get<0>(ret) = "da";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_DAZ;
-            break;
-
-          case triton::arch::x86::ID_REG_IM:
-            std::get<0>(ret) = "im";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_IM;
-            break;
-
-          case triton::arch::x86::ID_REG_DM:
-            std::get<0>(ret) = "dm";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_DM;
-            break;
-
-          case triton::arch::x86::ID_REG_ZM:
-            std::get<0>(ret) = "zm";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZM;
-            break;
-
-          case triton::arch::x86::ID_REG_OM:
-            std::get<0>(ret) = "om";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_OM;
-            break;
-
-          case triton::arch::x86::ID_REG_UM:
-            std::get<0>(ret) = "um";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_UM;
-            break;
-
-          case triton::arch::x86::ID_REG_PM:
-            std::get<0>(ret) = "pm";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_PM;
-            break;
-
-          case triton::arch::x86::ID_REG_RL:
-            std::get<0>(ret) = "rl";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RL;
-            break;
-
-          case triton::arch::x86::ID_REG_RH:
-            std::get<0>(ret) = "rh";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_RH;
-            break;
-
-          case triton::arch::x86::ID_REG_FZ:
-            std::get<0>(ret) = "fz";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_FZ;
-            break;
-
-          case triton::arch::x86::ID_REG_AF:
-            std::get<0>(ret) = "af";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_AF;
-            break;
-
-          case triton::arch::x86::ID_REG_CF:
-            std::get<0>(ret) = "cf";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CF;
-            break;
-
-          case triton::arch::x86::ID_REG_DF:
-            std::get<0>(ret) = "df";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_DF;
-            break;
-
-          case triton::arch::x86::ID_REG_IF:
-            std::get<0>(ret) = "if";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_IF;
-            break;
-
-          case triton::arch::x86::ID_REG_OF:
-            std::get<0>(ret) = "of";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_OF;
-            break;
-
-          case triton::arch::x86::ID_REG_PF:
-            std::get<0>(ret) = "pf";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_PF;
-            break;
+      /* The specification of a register according to the architecture (x86 or x86-64) */
+      struct x86RegisterEntry {
+        const char*    name;
+        triton::uint32 high32;
+        triton::uint32 high64;
+        triton::uint32 low;
+        triton::uint32 parent32;
+        triton::uint32 parent64;
+      };
 
-          case triton::arch::x86::ID_REG_SF:
-            std::get<0>(ret) = "sf";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_SF;
-            break;
 
-          case triton::arch::x86::ID_REG_TF:
-            std::get<0>(ret) = "tf";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_TF;
-            break;
+      /* Register specifications indexed by register id */
+      static const x86RegisterEntry x86RegisterEntries[triton::arch::x86::ID_REG_LAST_ITEM] = {
+        /* name         high (x86)          high (x86-64)       low              parent (x86)       parent (x86-64) */
+        {"unknown",   0,                  0,                  0,               ID_REG_INVALID,    ID_REG_INVALID},
+        {"rax",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_RAX,        ID_REG_RAX},
+        {"rbx",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_RBX,        ID_REG_RBX},
+        {"rcx",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_RCX,        ID_REG_RCX},
+        {"rdx",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_RDX,        ID_REG_RDX},
+        {"rdi",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_RDI,        ID_REG_RDI},
+        {"rsi",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_RSI,        ID_REG_RSI},
+        {"rbp",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_RBP,        ID_REG_RBP},
+        {"rsp",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_RSP,        ID_REG_RSP},
+        {"rip",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_RIP,        ID_REG_RIP},
+        {"r8",        QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_R8,         ID_REG_R8},
+        {"r8d",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_R8,         ID_REG_R8},
+        {"r8w",       WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_R8,         ID_REG_R8},
+        {"r8b",       BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_R8,         ID_REG_R8},
+        {"r9",        QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_R9,         ID_REG_R9},
+        {"r9d",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_R9,         ID_REG_R9},
+        {"r9w",       WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_R9,         ID_REG_R9},
+        {"r9b",       BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_R9,         ID_REG_R9},
+        {"r10",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_R10,        ID_REG_R10},
+        {"r10d",      DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_R10,        ID_REG_R10},
+        {"r10w",      WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_R10,        ID_REG_R10},
+        {"r10b",      BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_R10,        ID_REG_R10},
+        {"r11",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_R11,        ID_REG_R11},
+        {"r11d",      DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_R11,        ID_REG_R11},
+        {"r11w",      WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_R11,        ID_REG_R11},
+        {"r11b",      BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_R11,        ID_REG_R11},
+        {"r12",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_R12,        ID_REG_R12},
+        {"r12d",      DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_R12,        ID_REG_R12},
+        {"r12w",      WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_R12,        ID_REG_R12},
+        {"r12b",      BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_R12,        ID_REG_R12},
+        {"r13",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_R13,        ID_REG_R13},
+        {"r13d",      DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_R13,        ID_REG_R13},
+        {"r13w",      WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_R13,        ID_REG_R13},
+        {"r13b",      BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_R13,        ID_REG_R13},
+        {"r14",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_R14,        ID_REG_R14},
+        {"r14d",      DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_R14,        ID_REG_R14},
+        {"r14w",      WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_R14,        ID_REG_R14},
+        {"r14b",      BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_R14,        ID_REG_R14},
+        {"r15",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_R15,        ID_REG_R15},
+        {"r15d",      DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_R15,        ID_REG_R15},
+        {"r15w",      WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_R15,        ID_REG_R15},
+        {"r15b",      BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_R15,        ID_REG_R15},
+        {"eax",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_EAX,        ID_REG_RAX},
+        {"ax",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_EAX,        ID_REG_RAX},
+        {"ah",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    BYTE_SIZE_BIT,   ID_REG_EAX,        ID_REG_RAX},
+        {"al",        BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_EAX,        ID_REG_RAX},
+        {"ebx",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_EBX,        ID_REG_RBX},
+        {"bx",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_EBX,        ID_REG_RBX},
+        {"bh",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    BYTE_SIZE_BIT,   ID_REG_EBX,        ID_REG_RBX},
+        {"bl",        BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_EBX,        ID_REG_RBX},
+        {"ecx",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_ECX,        ID_REG_RCX},
+        {"cx",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_ECX,        ID_REG_RCX},
+        {"ch",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    BYTE_SIZE_BIT,   ID_REG_ECX,        ID_REG_RCX},
+        {"cl",        BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_ECX,        ID_REG_RCX},
+        {"edx",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_EDX,        ID_REG_RDX},
+        {"dx",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_EDX,        ID_REG_RDX},
+        {"dh",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    BYTE_SIZE_BIT,   ID_REG_EDX,        ID_REG_RDX},
+        {"dl",        BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_EDX,        ID_REG_RDX},
+        {"edi",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_EDI,        ID_REG_RDI},
+        {"di",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_EDI,        ID_REG_RDI},
+        {"dil",       BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_EDI,        ID_REG_RDI},
+        {"esi",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_ESI,        ID_REG_RSI},
+        {"si",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_ESI,        ID_REG_RSI},
+        {"sil",       BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_ESI,        ID_REG_RSI},
+        {"ebp",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_EBP,        ID_REG_RBP},
+        {"bp",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_EBP,        ID_REG_RBP},
+        {"bpl",       BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_EBP,        ID_REG_RBP},
+        {"esp",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_ESP,        ID_REG_RSP},
+        {"sp",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_ESP,        ID_REG_RSP},
+        {"spl",       BYTE_SIZE_BIT-1,    BYTE_SIZE_BIT-1,    0,               ID_REG_ESP,        ID_REG_RSP},
+        {"eip",       DWORD_SIZE_BIT-1,   DWORD_SIZE_BIT-1,   0,               ID_REG_EIP,        ID_REG_RIP},
+        {"ip",        WORD_SIZE_BIT-1,    WORD_SIZE_BIT-1,    0,               ID_REG_EIP,        ID_REG_RIP},
+        {"eflags",    DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_EFLAGS,     ID_REG_EFLAGS},
+        {"mm0",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_MM0,        ID_REG_MM0},
+        {"mm1",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_MM1,        ID_REG_MM1},
+        {"mm2",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_MM2,        ID_REG_MM2},
+        {"mm3",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_MM3,        ID_REG_MM3},
+        {"mm4",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_MM4,        ID_REG_MM4},
+        {"mm5",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_MM5,        ID_REG_MM5},
+        {"mm6",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_MM6,        ID_REG_MM6},
+        {"mm7",       QWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_MM7,        ID_REG_MM7},
+        {"mxcsr",     DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_MXCSR,      ID_REG_MXCSR},
+        {"xmm0",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM0,       ID_REG_XMM0},
+        {"xmm1",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM1,       ID_REG_XMM1},
+        {"xmm2",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM2,       ID_REG_XMM2},
+        {"xmm3",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM3,       ID_REG_XMM3},
+        {"xmm4",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM4,       ID_REG_XMM4},
+        {"xmm5",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM5,       ID_REG_XMM5},
+        {"xmm6",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM6,       ID_REG_XMM6},
+        {"xmm7",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM7,       ID_REG_XMM7},
+        {"xmm8",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM8,       ID_REG_XMM8},
+        {"xmm9",      DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM9,       ID_REG_XMM9},
+        {"xmm10",     DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM10,      ID_REG_XMM10},
+        {"xmm11",     DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM11,      ID_REG_XMM11},
+        {"xmm12",     DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM12,      ID_REG_XMM12},
+        {"xmm13",     DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM13,      ID_REG_XMM13},
+        {"xmm14",     DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM14,      ID_REG_XMM14},
+        {"xmm15",     DQWORD_SIZE_BIT-1,  DQWORD_SIZE_BIT-1,  0,               ID_REG_XMM15,      ID_REG_XMM15},
+        {"ymm0",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM0,       ID_REG_YMM0},
+        {"ymm1",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM1,       ID_REG_YMM1},
+        {"ymm2",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM2,       ID_REG_YMM2},
+        {"ymm3",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM3,       ID_REG_YMM3},
+        {"ymm4",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM4,       ID_REG_YMM4},
+        {"ymm5",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM5,       ID_REG_YMM5},
+        {"ymm6",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM6,       ID_REG_YMM6},
+        {"ymm7",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM7,       ID_REG_YMM7},
+        {"ymm8",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM8,       ID_REG_YMM8},
+        {"ymm9",      QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM9,       ID_REG_YMM9},
+        {"ymm10",     QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM10,      ID_REG_YMM10},
+        {"ymm11",     QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM11,      ID_REG_YMM11},
+        {"ymm12",     QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM12,      ID_REG_YMM12},
+        {"ymm13",     QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM13,      ID_REG_YMM13},
+        {"ymm14",     QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM14,      ID_REG_YMM14},
+        {"ymm15",     QQWORD_SIZE_BIT-1,  QQWORD_SIZE_BIT-1,  0,               ID_REG_YMM15,      ID_REG_YMM15},
+        {"zmm0",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM0,       ID_REG_ZMM0},
+        {"zmm1",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM1,       ID_REG_ZMM1},
+        {"zmm2",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM2,       ID_REG_ZMM2},
+        {"zmm3",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM3,       ID_REG_ZMM3},
+        {"zmm4",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM4,       ID_REG_ZMM4},
+        {"zmm5",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM5,       ID_REG_ZMM5},
+        {"zmm6",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM6,       ID_REG_ZMM6},
+        {"zmm7",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM7,       ID_REG_ZMM7},
+        {"zmm8",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM8,       ID_REG_ZMM8},
+        {"zmm9",      DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM9,       ID_REG_ZMM9},
+        {"zmm10",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM10,      ID_REG_ZMM10},
+        {"zmm11",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM11,      ID_REG_ZMM11},
+        {"zmm12",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM12,      ID_REG_ZMM12},
+        {"zmm13",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM13,      ID_REG_ZMM13},
+        {"zmm14",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM14,      ID_REG_ZMM14},
+        {"zmm15",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM15,      ID_REG_ZMM15},
+        {"zmm16",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM16,      ID_REG_ZMM16},
+        {"zmm17",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM17,      ID_REG_ZMM17},
+        {"zmm18",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM18,      ID_REG_ZMM18},
+        {"zmm19",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM19,      ID_REG_ZMM19},
+        {"zmm20",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM20,      ID_REG_ZMM20},
+        {"zmm21",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM21,      ID_REG_ZMM21},
+        {"zmm22",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM22,      ID_REG_ZMM22},
+        {"zmm23",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM23,      ID_REG_ZMM23},
+        {"zmm24",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM24,      ID_REG_ZMM24},
+        {"zmm25",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM25,      ID_REG_ZMM25},
+        {"zmm26",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM26,      ID_REG_ZMM26},
+        {"zmm27",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM27,      ID_REG_ZMM27},
+        {"zmm28",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM28,      ID_REG_ZMM28},
+        {"zmm29",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM29,      ID_REG_ZMM29},
+        {"zmm30",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM30,      ID_REG_ZMM30},
+        {"zmm31",     DQQWORD_SIZE_BIT-1, DQQWORD_SIZE_BIT-1, 0,               ID_REG_ZMM31,      ID_REG_ZMM31},
+        {"cr0",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR0,        ID_REG_CR0},
+        {"cr1",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR1,        ID_REG_CR1},
+        {"cr2",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR2,        ID_REG_CR2},
+        {"cr3",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR3,        ID_REG_CR3},
+        {"cr4",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR4,        ID_REG_CR4},
+        {"cr5",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR5,        ID_REG_CR5},
+        {"cr6",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR6,        ID_REG_CR6},
+        {"cr7",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR7,        ID_REG_CR7},
+        {"cr8",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR8,        ID_REG_CR8},
+        {"cr9",       DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR9,        ID_REG_CR9},
+        {"cr10",      DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR10,       ID_REG_CR10},
+        {"cr11",      DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR11,       ID_REG_CR11},
+        {"cr12",      DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR12,       ID_REG_CR12},
+        {"cr13",      DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR13,       ID_REG_CR13},
+        {"cr14",      DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR14,       ID_REG_CR14},
+        {"cr15",      DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CR15,       ID_REG_CR15},
+        {"af",        0,                  0,                  0,               ID_REG_AF,         ID_REG_AF},
+        {"cf",        0,                  0,                  0,               ID_REG_CF,         ID_REG_CF},
+        {"df",        0,                  0,                  0,               ID_REG_DF,         ID_REG_DF},
+        {"if",        0,                  0,                  0,               ID_REG_IF,         ID_REG_IF},
+        {"of",        0,                  0,                  0,               ID_REG_OF,         ID_REG_OF},
+        {"pf",        0,                  0,                  0,               ID_REG_PF,         ID_REG_PF},
+        {"sf",        0,                  0,                  0,               ID_REG_SF,         ID_REG_SF},
+        {"tf",        0,                  0,                  0,               ID_REG_TF,         ID_REG_TF},
+        {"zf",        0,                  0,                  0,               ID_REG_ZF,         ID_REG_ZF},
+        {"ie",        0,                  0,                  0,               ID_REG_IE,         ID_REG_IE},
+        {"de",        0,                  0,                  0,               ID_REG_DE,         ID_REG_DE},
+        {"ze",        0,                  0,                  0,               ID_REG_ZE,         ID_REG_ZE},
+        {"oe",        0,                  0,                  0,               ID_REG_OE,         ID_REG_OE},
+        {"ue",        0,                  0,                  0,               ID_REG_UE,         ID_REG_UE},
+        {"pe",        0,                  0,                  0,               ID_REG_PE,         ID_REG_PE},
+        {"da",        0,                  0,                  0,               ID_REG_DAZ,        ID_REG_DAZ},
+        {"im",        0,                  0,                  0,               ID_REG_IM,         ID_REG_IM},
+        {"dm",        0,                  0,                  0,               ID_REG_DM,         ID_REG_DM},
+        {"zm",        0,                  0,                  0,               ID_REG_ZM,         ID_REG_ZM},
+        {"om",        0,                  0,                  0,               ID_REG_OM,         ID_REG_OM},
+        {"um",        0,                  0,                  0,               ID_REG_UM,         ID_REG_UM},
+        {"pm",        0,                  0,                  0,               ID_REG_PM,         ID_REG_PM},
+        {"rl",        0,                  0,                  0,               ID_REG_RL,         ID_REG_RL},
+        {"rh",        0,                  0,                  0,               ID_REG_RH,         ID_REG_RH},
+        {"fz",        0,                  0,                  0,               ID_REG_FZ,         ID_REG_FZ},
+        {"cs",        DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_CS,         ID_REG_CS},
+        {"ds",        DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_DS,         ID_REG_DS},
+        {"es",        DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_ES,         ID_REG_ES},
+        {"fs",        DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_FS,         ID_REG_FS},
+        {"gs",        DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_GS,         ID_REG_GS},
+        {"ss",        DWORD_SIZE_BIT-1,   QWORD_SIZE_BIT-1,   0,               ID_REG_SS,         ID_REG_SS}
+      };
 
-          case triton::arch::x86::ID_REG_ZF:
-            std::get<0>(ret) = "zf";
-            std::get<1>(ret) = 0;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ZF;
-            break;
 
-          case triton::arch::x86::ID_REG_CS:
-            std::get<0>(ret) = "cs";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_CS;
-            break;
+      /* Returns the specification of a register from its triton id */
+      triton::arch::RegisterSpecification registerIdToRegisterSpecification(triton::uint32 reg) {
+        triton::arch::RegisterSpecification ret = {"unknown", 0, 0, triton::arch::x86::ID_REG_INVALID};
+        triton::uint32 arch = triton::api.getArchitecture();
 
-          case triton::arch::x86::ID_REG_DS:
-            std::get<0>(ret) = "ds";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_DS;
-            break;
+        if (arch == triton::arch::ARCH_INVALID || reg >= triton::arch::x86::ID_REG_LAST_ITEM)
+          return ret;
 
-          case triton::arch::x86::ID_REG_ES:
-            std::get<0>(ret) = "es";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_ES;
-            break;
+        const x86RegisterEntry& entry = triton::arch::x86::x86RegisterEntries[reg];
 
-          case triton::arch::x86::ID_REG_FS:
-            std::get<0>(ret) = "fs";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_FS;
-            break;
+        ret.name   = entry.name;
+        ret.high   = (arch == triton::arch::ARCH_X86_64) ? entry.high64 : entry.high32;
+        ret.low    = entry.low;
+        ret.parent = (arch == triton::arch::ARCH_X86_64) ? entry.parent64 : entry.parent32;
 
-          case triton::arch::x86::ID_REG_GS:
-            std::get<0>(ret) = "gs";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_GS;
-            break;
+        return ret;
+      }
 
-          case triton::arch::x86::ID_REG_SS:
-            std::get<0>(ret) = "ss";
-            std::get<1>(ret) = (triton::api.getArchitecture() == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1;
-            std::get<2>(ret) = 0;
-            std::get<3>(ret) = triton::arch::x86::ID_REG_SS;
-            break;
 
-        }
-        return ret;
+      /* Returns all information about a register from its triton id */
+      std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> registerIdToRegisterInformation(triton::uint32 reg) {
+        triton::arch::RegisterSpecification spec = triton::arch::x86::registerIdToRegisterSpecification(reg);
+        return std::make_tuple(std::string(spec.name), spec.high, spec.low, spec.parent);
       }
 
 
@@ -0,0 +1,445 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <vector>
+
+#include <api.hpp>
+#include <x86Semantics.hpp>
+#include <x86Specifications.hpp>
+
+
+
+/*! \page taint_only_page Taint-only semantics
+    \brief [**internal**] The taint-only mode of the x86 semantics.
+
+\tableofcontents
+
+\section taint_only_description Description
+<hr>
+
+When the triton::engines::symbolic::TAINT_ONLY optimization is enabled, the x86 semantics only spread the taint.
+The propagation is driven by a table indexed by the triton::arch::x86::instructions_e ids which tells, for each
+supported instruction, how its operands are read and written and which flags are read and written. No AST node,
+no symbolic expression and no concrete value is computed; the addresses of memory operands are computed from the
+concrete values of their registers.
+
+As the concrete state is not updated, this mode is designed to replay recorded traces where each instruction comes
+with its context (see `Instruction::updateContext()`). Instructions which are not in the table go through the
+symbolic semantics.
+
+*/
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+      namespace semantics {
+
+        /* The flags of a propagation rule */
+        enum taint_flag_e {
+          TAINT_CF = (1 << 0),
+          TAINT_PF = (1 << 1),
+          TAINT_AF = (1 << 2),
+          TAINT_ZF = (1 << 3),
+          TAINT_SF = (1 << 4),
+          TAINT_OF = (1 << 5),
+          TAINT_ALL_FLAGS = (TAINT_CF | TAINT_PF | TAINT_AF | TAINT_ZF | TAINT_SF | TAINT_OF),
+          TAINT_LOGIC_FLAGS = (TAINT_PF | TAINT_ZF | TAINT_SF), /* The flags computed by and, or, xor and test, CF and OF are cleared */
+        };
+
+
+        /* The kinds of propagation rule */
+        enum taint_rule_e {
+          TAINT_RULE_UNDEFINED = 0, /* Goes through the symbolic semantics */
+          TAINT_RULE_NONE,          /* No operand is written, only flags */
+          TAINT_RULE_ASSIGN,        /* op0 = op1 | op2 | ... | read flags */
+          TAINT_RULE_UNION,         /* op0 = op0 | op1 | ... | read flags */
+          TAINT_RULE_MUL,           /* Union with two operands, assignment with three */
+          TAINT_RULE_LEA,           /* op0 = base | index */
+          TAINT_RULE_XCHG,          /* op0 <-> op1 */
+          TAINT_RULE_PUSH,          /* [sp - size] = op0 */
+          TAINT_RULE_POP,           /* op0 = [sp] */
+          TAINT_RULE_CALL,          /* [sp - size] = untainted, pc = op0 */
+          TAINT_RULE_RET,           /* pc = [sp] */
+          TAINT_RULE_JUMP,          /* pc = op0 | read flags */
+        };
+
+
+        /* A propagation rule */
+        struct x86TaintRule {
+          triton::uint32 id;
+          taint_rule_e   rule;
+          triton::uint32 readFlags;
+          triton::uint32 writeFlags;
+          triton::uint32 clearFlags;
+        };
+
+
+        /* The propagation rules of the supported instructions */
+        static const x86TaintRule x86TaintRules[] = {
+          {ID_INS_ADC,        TAINT_RULE_UNION,  TAINT_CF,                      TAINT_ALL_FLAGS,             0},
+          {ID_INS_ADD,        TAINT_RULE_UNION,  0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_AND,        TAINT_RULE_UNION,  0,                             TAINT_LOGIC_FLAGS,           TAINT_CF | TAINT_OF},
+          {ID_INS_ANDNPD,     TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_ANDNPS,     TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_ANDPD,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_ANDPS,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_BSF,        TAINT_RULE_UNION,  0,                             TAINT_ZF,                    0},
+          {ID_INS_BSR,        TAINT_RULE_UNION,  0,                             TAINT_ZF,                    0},
+          {ID_INS_BSWAP,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_BT,         TAINT_RULE_NONE,   0,                             TAINT_CF,                    0},
+          {ID_INS_BTC,        TAINT_RULE_UNION,  0,                             TAINT_CF,                    0},
+          {ID_INS_BTR,        TAINT_RULE_UNION,  0,                             TAINT_CF,                    0},
+          {ID_INS_BTS,        TAINT_RULE_UNION,  0,                             TAINT_CF,                    0},
+          {ID_INS_CALL,       TAINT_RULE_CALL,   0,                             0,                           0},
+          {ID_INS_CMOVA,      TAINT_RULE_UNION,  TAINT_CF | TAINT_ZF,           0,                           0},
+          {ID_INS_CMOVAE,     TAINT_RULE_UNION,  TAINT_CF,                      0,                           0},
+          {ID_INS_CMOVB,      TAINT_RULE_UNION,  TAINT_CF,                      0,                           0},
+          {ID_INS_CMOVBE,     TAINT_RULE_UNION,  TAINT_CF | TAINT_ZF,           0,                           0},
+          {ID_INS_CMOVE,      TAINT_RULE_UNION,  TAINT_ZF,                      0,                           0},
+          {ID_INS_CMOVG,      TAINT_RULE_UNION,  TAINT_ZF | TAINT_SF | TAINT_OF, 0,                           0},
+          {ID_INS_CMOVGE,     TAINT_RULE_UNION,  TAINT_SF | TAINT_OF,           0,                           0},
+          {ID_INS_CMOVL,      TAINT_RULE_UNION,  TAINT_SF | TAINT_OF,           0,                           0},
+          {ID_INS_CMOVLE,     TAINT_RULE_UNION,  TAINT_ZF | TAINT_SF | TAINT_OF, 0,                           0},
+          {ID_INS_CMOVNE,     TAINT_RULE_UNION,  TAINT_ZF,                      0,                           0},
+          {ID_INS_CMOVNO,     TAINT_RULE_UNION,  TAINT_OF,                      0,                           0},
+          {ID_INS_CMOVNP,     TAINT_RULE_UNION,  TAINT_PF,                      0,                           0},
+          {ID_INS_CMOVNS,     TAINT_RULE_UNION,  TAINT_SF,                      0,                           0},
+          {ID_INS_CMOVO,      TAINT_RULE_UNION,  TAINT_OF,                      0,                           0},
+          {ID_INS_CMOVP,      TAINT_RULE_UNION,  TAINT_PF,                      0,                           0},
+          {ID_INS_CMOVS,      TAINT_RULE_UNION,  TAINT_SF,                      0,                           0},
+          {ID_INS_CMP,        TAINT_RULE_NONE,   0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_DEC,        TAINT_RULE_UNION,  0,                             TAINT_ALL_FLAGS & ~TAINT_CF, 0},
+          {ID_INS_IMUL,       TAINT_RULE_MUL,    0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_INC,        TAINT_RULE_UNION,  0,                             TAINT_ALL_FLAGS & ~TAINT_CF, 0},
+          {ID_INS_JA,         TAINT_RULE_JUMP,   TAINT_CF | TAINT_ZF,           0,                           0},
+          {ID_INS_JAE,        TAINT_RULE_JUMP,   TAINT_CF,                      0,                           0},
+          {ID_INS_JB,         TAINT_RULE_JUMP,   TAINT_CF,                      0,                           0},
+          {ID_INS_JBE,        TAINT_RULE_JUMP,   TAINT_CF | TAINT_ZF,           0,                           0},
+          {ID_INS_JE,         TAINT_RULE_JUMP,   TAINT_ZF,                      0,                           0},
+          {ID_INS_JG,         TAINT_RULE_JUMP,   TAINT_ZF | TAINT_SF | TAINT_OF, 0,                           0},
+          {ID_INS_JGE,        TAINT_RULE_JUMP,   TAINT_SF | TAINT_OF,           0,                           0},
+          {ID_INS_JL,         TAINT_RULE_JUMP,   TAINT_SF | TAINT_OF,           0,                           0},
+          {ID_INS_JLE,        TAINT_RULE_JUMP,   TAINT_ZF | TAINT_SF | TAINT_OF, 0,                           0},
+          {ID_INS_JMP,        TAINT_RULE_JUMP,   0,                             0,                           0},
+          {ID_INS_JNE,        TAINT_RULE_JUMP,   TAINT_ZF,                      0,                           0},
+          {ID_INS_JNO,        TAINT_RULE_JUMP,   TAINT_OF,                      0,                           0},
+          {ID_INS_JNP,        TAINT_RULE_JUMP,   TAINT_PF,                      0,                           0},
+          {ID_INS_JNS,        TAINT_RULE_JUMP,   TAINT_SF,                      0,                           0},
+          {ID_INS_JO,         TAINT_RULE_JUMP,   TAINT_OF,                      0,                           0},
+          {ID_INS_JP,         TAINT_RULE_JUMP,   TAINT_PF,                      0,                           0},
+          {ID_INS_JS,         TAINT_RULE_JUMP,   TAINT_SF,                      0,                           0},
+          {ID_INS_LDDQU,      TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_LEA,        TAINT_RULE_LEA,    0,                             0,                           0},
+          {ID_INS_MOV,        TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVABS,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVAPD,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVAPS,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVD,       TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVDQA,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVDQU,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVNTDQ,    TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVNTI,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVNTPD,    TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVNTPS,    TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVQ,       TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVSX,      TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVSXD,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVUPD,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVUPS,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_MOVZX,      TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_NEG,        TAINT_RULE_UNION,  0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_NOP,        TAINT_RULE_NONE,   0,                             0,                           0},
+          {ID_INS_NOT,        TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_OR,         TAINT_RULE_UNION,  0,                             TAINT_LOGIC_FLAGS,           TAINT_CF | TAINT_OF},
+          {ID_INS_ORPD,       TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_ORPS,       TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PADDB,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PADDD,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PADDQ,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PADDW,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PAND,       TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PANDN,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PCMPEQB,    TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PCMPEQD,    TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PCMPEQW,    TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PCMPGTB,    TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PCMPGTD,    TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PCMPGTW,    TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PMOVSXBD,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVSXBQ,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVSXBW,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVSXDQ,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVSXWD,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVSXWQ,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVZXBD,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVZXBQ,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVZXBW,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVZXDQ,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVZXWD,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PMOVZXWQ,   TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_POP,        TAINT_RULE_POP,    0,                             0,                           0},
+          {ID_INS_POR,        TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PSHUFD,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_PSUBB,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PSUBD,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PSUBQ,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PSUBW,      TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PTEST,      TAINT_RULE_NONE,   0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_PUNPCKHBW,  TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PUNPCKHDQ,  TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PUNPCKHQDQ, TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PUNPCKHWD,  TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PUNPCKLBW,  TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PUNPCKLDQ,  TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PUNPCKLQDQ, TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PUNPCKLWD,  TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_PUSH,       TAINT_RULE_PUSH,   0,                             0,                           0},
+          {ID_INS_PXOR,       TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_RCL,        TAINT_RULE_UNION,  TAINT_CF,                      TAINT_CF | TAINT_OF,         0},
+          {ID_INS_RCR,        TAINT_RULE_UNION,  TAINT_CF,                      TAINT_CF | TAINT_OF,         0},
+          {ID_INS_RET,        TAINT_RULE_RET,    0,                             0,                           0},
+          {ID_INS_ROL,        TAINT_RULE_UNION,  0,                             TAINT_CF | TAINT_OF,         0},
+          {ID_INS_ROR,        TAINT_RULE_UNION,  0,                             TAINT_CF | TAINT_OF,         0},
+          {ID_INS_SAL,        TAINT_RULE_UNION,  0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_SAR,        TAINT_RULE_UNION,  0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_SBB,        TAINT_RULE_UNION,  TAINT_CF,                      TAINT_ALL_FLAGS,             0},
+          {ID_INS_SETA,       TAINT_RULE_ASSIGN, TAINT_CF | TAINT_ZF,           0,                           0},
+          {ID_INS_SETAE,      TAINT_RULE_ASSIGN, TAINT_CF,                      0,                           0},
+          {ID_INS_SETB,       TAINT_RULE_ASSIGN, TAINT_CF,                      0,                           0},
+          {ID_INS_SETBE,      TAINT_RULE_ASSIGN, TAINT_CF | TAINT_ZF,           0,                           0},
+          {ID_INS_SETE,       TAINT_RULE_ASSIGN, TAINT_ZF,                      0,                           0},
+          {ID_INS_SETG,       TAINT_RULE_ASSIGN, TAINT_ZF | TAINT_SF | TAINT_OF, 0,                           0},
+          {ID_INS_SETGE,      TAINT_RULE_ASSIGN, TAINT_SF | TAINT_OF,           0,                           0},
+          {ID_INS_SETL,       TAINT_RULE_ASSIGN, TAINT_SF | TAINT_OF,           0,                           0},
+          {ID_INS_SETLE,      TAINT_RULE_ASSIGN, TAINT_ZF | TAINT_SF | TAINT_OF, 0,                           0},
+          {ID_INS_SETNE,      TAINT_RULE_ASSIGN, TAINT_ZF,                      0,                           0},
+          {ID_INS_SETNO,      TAINT_RULE_ASSIGN, TAINT_OF,                      0,                           0},
+          {ID_INS_SETNP,      TAINT_RULE_ASSIGN, TAINT_PF,                      0,                           0},
+          {ID_INS_SETNS,      TAINT_RULE_ASSIGN, TAINT_SF,                      0,                           0},
+          {ID_INS_SETO,       TAINT_RULE_ASSIGN, TAINT_OF,                      0,                           0},
+          {ID_INS_SETP,       TAINT_RULE_ASSIGN, TAINT_PF,                      0,                           0},
+          {ID_INS_SETS,       TAINT_RULE_ASSIGN, TAINT_SF,                      0,                           0},
+          {ID_INS_SHL,        TAINT_RULE_UNION,  0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_SHR,        TAINT_RULE_UNION,  0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_SUB,        TAINT_RULE_UNION,  0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_TEST,       TAINT_RULE_NONE,   0,                             TAINT_LOGIC_FLAGS,           TAINT_CF | TAINT_OF},
+          {ID_INS_UNPCKHPD,   TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_UNPCKHPS,   TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_UNPCKLPD,   TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_UNPCKLPS,   TAINT_RULE_UNION,  0,                             0,                           0},
+          {ID_INS_VMOVDQA,    TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_VPAND,      TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_VPANDN,     TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_VPOR,       TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_VPSHUFD,    TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_VPTEST,     TAINT_RULE_NONE,   0,                             TAINT_ALL_FLAGS,             0},
+          {ID_INS_VPXOR,      TAINT_RULE_ASSIGN, 0,                             0,                           0},
+          {ID_INS_XCHG,       TAINT_RULE_XCHG,   0,                             0,                           0},
+          {ID_INS_XOR,        TAINT_RULE_UNION,  0,                             TAINT_LOGIC_FLAGS,           TAINT_CF | TAINT_OF},
+        };
+
+
+        /* Returns the rule of an instruction. The sparse table is indexed by instruction id on the first call */
+        static const x86TaintRule& getTaintRule(triton::uint32 id) {
+          static std::vector<x86TaintRule> index;
+          static const x86TaintRule undefined = {ID_INST_INVALID, TAINT_RULE_UNDEFINED, 0, 0, 0};
+
+          if (index.empty()) {
+            index.resize(ID_INST_LAST_ITEM, undefined);
+            for (triton::uint32 i = 0; i < sizeof(x86TaintRules) / sizeof(x86TaintRule); i++)
+              index[x86TaintRules[i].id] = x86TaintRules[i];
+          }
+
+          if (id >= ID_INST_LAST_ITEM)
+            return undefined;
+
+          return index[id];
+        }
+
+
+        /* Returns the flag register of a taint flag */
+        static const triton::arch::Register& getTaintFlag(triton::uint32 flag) {
+          switch (flag) {
+            case TAINT_CF: return TRITON_X86_REG_CF;
+            case TAINT_PF: return TRITON_X86_REG_PF;
+            case TAINT_AF: return TRITON_X86_REG_AF;
+            case TAINT_ZF: return TRITON_X86_REG_ZF;
+            case TAINT_SF: return TRITON_X86_REG_SF;
+            default:       return TRITON_X86_REG_OF;
+          }
+        }
+
+
+        /* Spreads the sources into dst. If assign is true, the first source replaces dst */
+        static bool spreadTaint(const triton::arch::OperandWrapper& dst, const std::vector<triton::arch::OperandWrapper>& srcs, bool assign) {
+          bool tainted = triton::api.isTainted(dst);
+
+          for (triton::usize i = 0; i < srcs.size(); i++) {
+            if (assign && i == 0)
+              tainted = triton::api.taintAssignment(dst, srcs[i]);
+            else
+              tainted = triton::api.taintUnion(dst, srcs[i]);
+          }
+
+          return tainted;
+        }
+
+
+        bool buildTaint(triton::arch::Instruction& inst) {
+          const x86TaintRule& rule = getTaintRule(inst.getType());
+          std::vector<triton::arch::OperandWrapper> srcs;
+          triton::arch::Register stack = TRITON_X86_REG_SP.getParent();
+          triton::arch::Register pc    = TRITON_X86_REG_PC;
+          auto& operands               = inst.operands;
+          bool tainted                 = false;
+          taint_rule_e kind            = rule.rule;
+
+          if (kind == TAINT_RULE_UNDEFINED)
+            return false;
+
+          /* imul has implicit operands in its one operand form */
+          if (kind == TAINT_RULE_MUL) {
+            if (operands.size() == 2)
+              kind = TAINT_RULE_UNION;
+            else if (operands.size() == 3)
+              kind = TAINT_RULE_ASSIGN;
+            else
+              return false;
+          }
+
+          /* Check the operands' shape */
+          switch (kind) {
+            case TAINT_RULE_ASSIGN:
+            case TAINT_RULE_UNION:
+            case TAINT_RULE_POP:
+              if (operands.size() < 1 || operands[0].getType() == triton::arch::OP_IMM)
+                return false;
+              if (kind == TAINT_RULE_ASSIGN && operands.size() < 2 && rule.readFlags == 0)
+                return false;
+              break;
+            case TAINT_RULE_PUSH:
+            case TAINT_RULE_CALL:
+            case TAINT_RULE_JUMP:
+              if (operands.size() < 1)
+                return false;
+              break;
+            case TAINT_RULE_LEA:
+            case TAINT_RULE_XCHG:
+              if (operands.size() != 2)
+                return false;
+              break;
+            default:
+              break;
+          }
+
+          /* Memory operands addresses */
+          if (kind != TAINT_RULE_LEA) {
+            for (triton::usize i = 0; i < operands.size(); i++) {
+              if (operands[i].getType() == triton::arch::OP_MEM)
+                operands[i].getMemory().initConcreteAddress();
+            }
+          }
+
+          /* Read flags are sources */
+          for (triton::uint32 flag = TAINT_CF; flag <= TAINT_OF; flag <<= 1) {
+            if (rule.readFlags & flag)
+              srcs.push_back(triton::arch::OperandWrapper(getTaintFlag(flag)));
+          }
+
+          switch (kind) {
+            case TAINT_RULE_NONE:
+              for (triton::usize i = 0; i < operands.size(); i++)
+                tainted |= triton::api.isTainted(operands[i]);
+              break;
+
+            case TAINT_RULE_ASSIGN:
+            case TAINT_RULE_UNION:
+              srcs.insert(srcs.begin(), operands.begin() + 1, operands.end());
+              tainted = spreadTaint(operands[0], srcs, (kind == TAINT_RULE_ASSIGN));
+              break;
+
+            case TAINT_RULE_LEA: {
+              auto& mem = operands[1].getMemory();
+              if (mem.getConstBaseRegister().isValid())
+                srcs.push_back(triton::arch::OperandWrapper(mem.getConstBaseRegister()));
+              if (mem.getConstIndexRegister().isValid())
+                srcs.push_back(triton::arch::OperandWrapper(mem.getConstIndexRegister()));
+              if (srcs.empty())
+                tainted = triton::api.setTaint(operands[0], triton::engines::taint::UNTAINTED);
+              else
+                tainted = spreadTaint(operands[0], srcs, true);
+              break;
+            }
+
+            case TAINT_RULE_XCHG: {
+              bool flag = triton::api.isTainted(operands[0]);
+              tainted   = triton::api.taintAssignment(operands[0], operands[1]);
+              tainted  |= triton::api.setTaint(operands[1], flag);
+              break;
+            }
+
+            case TAINT_RULE_PUSH: {
+              triton::uint64 sp = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+              triton::arch::OperandWrapper dst(triton::arch::MemoryAccess(sp - operands[0].getSize(), operands[0].getSize()));
+              tainted = triton::api.taintAssignment(dst, operands[0]);
+              break;
+            }
+
+            case TAINT_RULE_POP: {
+              triton::uint64 sp = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+              triton::arch::OperandWrapper src(triton::arch::MemoryAccess(sp, operands[0].getSize()));
+              tainted = triton::api.taintAssignment(operands[0], src);
+              break;
+            }
+
+            case TAINT_RULE_CALL: {
+              triton::uint64 sp = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+              triton::api.taintAssignmentMemoryImmediate(triton::arch::MemoryAccess(sp - stack.getSize(), stack.getSize()));
+              tainted = triton::api.taintAssignment(triton::arch::OperandWrapper(pc), operands[0]);
+              break;
+            }
+
+            case TAINT_RULE_RET: {
+              triton::uint64 sp = triton::api.getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+              tainted = triton::api.taintAssignmentRegisterMemory(pc, triton::arch::MemoryAccess(sp, stack.getSize()));
+              break;
+            }
+
+            case TAINT_RULE_JUMP:
+              srcs.insert(srcs.begin(), operands[0]);
+              tainted = spreadTaint(triton::arch::OperandWrapper(pc), srcs, true);
+              break;
+
+            default:
+              return false;
+          }
+
+          /* Written flags take the taint of the result and the labels of the operands */
+          if (rule.writeFlags) {
+            srcs.insert(srcs.end(), operands.begin(), operands.end());
+            for (triton::uint32 flag = TAINT_CF; flag <= TAINT_OF; flag <<= 1) {
+              if (rule.writeFlags & flag)
+                triton::api.setTaintRegister(getTaintFlag(flag), tainted, srcs);
+            }
+          }
+
+          /* Cleared flags are untainted, as in the semantics */
+          for (triton::uint32 flag = TAINT_CF; flag <= TAINT_OF; flag <<= 1) {
+            if (rule.clearFlags & flag)
+              triton::api.setTaintRegister(getTaintFlag(flag), triton::engines::taint::UNTAINTED);
+          }
+
+          inst.setTaint(tainted);
+          return true;
+        }
+
+      }; /* semantics namespace */
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -5,7 +5,11 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 #include <api.hpp>
 #include <ast.hpp>
@@ -43,8 +47,8 @@ namespace triton {
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
-      for (triton::uint32 index = 0; index < copy.childs.size(); index++)
-        this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+      /* The childs are shared, newInstance() replaces them by their copies */
+      this->childs      = copy.childs;
     }
 
 
@@ -185,11 +189,7 @@ namespace triton {
 
 
     triton::uint512 AssertNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -241,11 +241,7 @@ namespace triton {
 
 
     triton::uint512 BvaddNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -297,11 +293,7 @@ namespace triton {
 
 
     triton::uint512 BvandNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -386,11 +378,7 @@ namespace triton {
 
 
     triton::uint512 BvashrNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -450,11 +438,7 @@ namespace triton {
 
 
     triton::uint512 BvdeclNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -506,11 +490,7 @@ namespace triton {
 
 
     triton::uint512 BvlshrNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -562,11 +542,7 @@ namespace triton {
 
 
     triton::uint512 BvmulNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -618,11 +594,7 @@ namespace triton {
 
 
     triton::uint512 BvnandNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -670,11 +642,7 @@ namespace triton {
 
 
     triton::uint512 BvnegNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -726,11 +694,7 @@ namespace triton {
 
 
     triton::uint512 BvnorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -778,11 +742,7 @@ namespace triton {
 
 
     triton::uint512 BvnotNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -834,11 +794,7 @@ namespace triton {
 
 
     triton::uint512 BvorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -906,11 +862,7 @@ namespace triton {
 
 
     triton::uint512 BvrolNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -977,11 +929,7 @@ namespace triton {
 
 
     triton::uint512 BvrorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1046,11 +994,7 @@ namespace triton {
 
 
     triton::uint512 BvsdivNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1109,11 +1053,7 @@ namespace triton {
 
 
     triton::uint512 BvsgeNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1172,11 +1112,7 @@ namespace triton {
 
 
     triton::uint512 BvsgtNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1228,11 +1164,7 @@ namespace triton {
 
 
     triton::uint512 BvshlNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1291,11 +1223,7 @@ namespace triton {
 
 
     triton::uint512 BvsleNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1354,11 +1282,7 @@ namespace triton {
 
 
     triton::uint512 BvsltNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1421,11 +1345,7 @@ namespace triton {
 
 
     triton::uint512 BvsmodNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1488,11 +1408,7 @@ namespace triton {
 
 
     triton::uint512 BvsremNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1544,11 +1460,7 @@ namespace triton {
 
 
     triton::uint512 BvsubNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1604,11 +1516,7 @@ namespace triton {
 
 
     triton::uint512 BvudivNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1660,11 +1568,7 @@ namespace triton {
 
 
     triton::uint512 BvugeNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1716,11 +1620,7 @@ namespace triton {
 
 
     triton::uint512 BvugtNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1772,11 +1672,7 @@ namespace triton {
 
 
     triton::uint512 BvuleNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1828,11 +1724,7 @@ namespace triton {
 
 
     triton::uint512 BvultNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1888,11 +1780,7 @@ namespace triton {
 
 
     triton::uint512 BvuremNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -1944,11 +1832,7 @@ namespace triton {
 
 
     triton::uint512 BvxnorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2000,11 +1884,7 @@ namespace triton {
 
 
     triton::uint512 BvxorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2068,11 +1948,7 @@ namespace triton {
 
 
     triton::uint512 BvNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2121,11 +1997,7 @@ namespace triton {
 
 
     triton::uint512 CompoundNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2199,11 +2071,7 @@ namespace triton {
 
 
     triton::uint512 ConcatNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2305,11 +2173,7 @@ namespace triton {
 
 
     triton::uint512 DeclareFunctionNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2358,11 +2222,7 @@ namespace triton {
 
 
     triton::uint512 DistinctNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2411,11 +2271,7 @@ namespace triton {
 
 
     triton::uint512 EqualNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2480,11 +2336,7 @@ namespace triton {
 
 
     triton::uint512 ExtractNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2537,11 +2389,7 @@ namespace triton {
 
 
     triton::uint512 IteNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2590,11 +2438,7 @@ namespace triton {
 
 
     triton::uint512 LandNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2647,11 +2491,7 @@ namespace triton {
 
 
     triton::uint512 LetNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2699,11 +2539,7 @@ namespace triton {
 
 
     triton::uint512 LnotNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2752,11 +2588,7 @@ namespace triton {
 
 
     triton::uint512 LorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -2921,11 +2753,7 @@ namespace triton {
 
 
     triton::uint512 SxNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
 
@@ -3040,11 +2868,7 @@ namespace triton {
 
 
     triton::uint512 ZxNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+      return triton::ast::hashAst(this, deep);
     }
 
   }; /* ast namespace */
@@ -3115,6 +2939,179 @@ namespace triton {
 
 
 
+/* ====== Traversals */
+
+namespace triton {
+  namespace ast {
+
+    /* The leaves are hashed by their own hash() */
+    static bool isHashLeaf(AbstractNode* node) {
+      switch (node->getKind()) {
+        case DECIMAL_NODE:
+        case REFERENCE_NODE:
+        case STRING_NODE:
+        case VARIABLE_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    /* The nodes whose childs are hashed without their position */
+    static bool isHashUnordered(AbstractNode* node) {
+      switch (node->getKind()) {
+        case ASSERT_NODE:
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNEG_NODE:
+        case BVNOR_NODE:
+        case BVNOT_NODE:
+        case BVOR_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case COMPOUND_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case LAND_NODE:
+        case LNOT_NODE:
+        case LOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    /* A node being hashed by hashAst() */
+    struct HashFrame {
+      AbstractNode* node;
+      triton::uint32 deep;
+      triton::uint32 index;
+      triton::uint512 hash;
+    };
+
+
+    /* Hashes a (node, depth) pair */
+    struct HashFrameKey {
+      std::size_t operator()(const std::pair<AbstractNode*, triton::uint32>& key) const {
+        return std::hash<AbstractNode*>()(key.first) ^ (static_cast<std::size_t>(key.second) * 0x9e3779b9);
+      }
+    };
+
+
+    std::vector<AbstractNode*> nodesExtraction(AbstractNode* root, bool unroll) {
+      std::unordered_set<AbstractNode*> visited;
+      std::vector<std::pair<AbstractNode*, bool>> worklist;
+      std::vector<AbstractNode*> nodes;
+
+      if (root == nullptr)
+        throw triton::exceptions::Ast("triton::ast::nodesExtraction(): root cannot be null.");
+
+      worklist.push_back(std::make_pair(root, false));
+      while (!worklist.empty()) {
+        AbstractNode* node = worklist.back().first;
+
+        /* All the childs are extracted */
+        if (worklist.back().second) {
+          nodes.push_back(node);
+          worklist.pop_back();
+          continue;
+        }
+
+        if (visited.insert(node).second == false) {
+          worklist.pop_back();
+          continue;
+        }
+
+        /* A reference is replaced by the AST it points to */
+        if (unroll && node->getKind() == REFERENCE_NODE) {
+          worklist.back().first = triton::api.getAstFromId(reinterpret_cast<ReferenceNode*>(node)->getValue());
+          continue;
+        }
+
+        worklist.back().second = true;
+        std::vector<AbstractNode*>& childs = node->getChilds();
+        for (triton::usize index = childs.size(); index > 0; index--) {
+          if (visited.find(childs[index - 1]) == visited.end())
+            worklist.push_back(std::make_pair(childs[index - 1], false));
+        }
+      }
+
+      return nodes;
+    }
+
+
+    triton::uint512 hashAst(AbstractNode* node, triton::uint32 deep) {
+      std::unordered_map<std::pair<AbstractNode*, triton::uint32>, triton::uint512, HashFrameKey> hashes;
+      std::vector<HashFrame> stack;
+      triton::uint512 value = 0;
+
+      if (isHashLeaf(node))
+        return node->hash(deep);
+
+      /* h = kind * size * child1 * child2^2 * ... rotated by the depth, see AbstractNode::hash() */
+      stack.push_back(HashFrame());
+      stack.back().node  = node;
+      stack.back().deep  = deep;
+      stack.back().index = 0;
+      stack.back().hash  = node->getKind();
+      if (node->getChilds().size())
+        stack.back().hash = stack.back().hash * node->getChilds().size();
+
+      while (!stack.empty()) {
+        HashFrame& frame = stack.back();
+        std::vector<AbstractNode*>& childs = frame.node->getChilds();
+
+        if (frame.index < childs.size()) {
+          AbstractNode* child = childs[frame.index];
+
+          if (isHashLeaf(child)) {
+            value = child->hash(frame.deep + 1);
+          }
+          else {
+            std::unordered_map<std::pair<AbstractNode*, triton::uint32>, triton::uint512, HashFrameKey>::const_iterator it = hashes.find(std::make_pair(child, frame.deep + 1));
+            if (it == hashes.end()) {
+              HashFrame next;
+              next.node  = child;
+              next.deep  = frame.deep + 1;
+              next.index = 0;
+              next.hash  = child->getKind();
+              if (child->getChilds().size())
+                next.hash = next.hash * child->getChilds().size();
+              stack.push_back(next);
+              continue;
+            }
+            value = it->second;
+          }
+        }
+        else {
+          /* All the childs are hashed */
+          value = triton::ast::rotl(frame.hash, frame.deep);
+          hashes[std::make_pair(frame.node, frame.deep)] = value;
+          stack.pop_back();
+          if (stack.empty())
+            break;
+        }
+
+        HashFrame& parent = stack.back();
+        if (isHashUnordered(parent.node))
+          parent.hash = parent.hash * value;
+        else
+          parent.hash = parent.hash * triton::ast::pow(value, parent.index + 1);
+        parent.index++;
+      }
+
+      return value;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
+
+
+
 /* ====== Node builders */
 
 namespace triton {
@@ -3563,7 +3560,8 @@ namespace triton {
     }
 
 
-    AbstractNode* newInstance(AbstractNode* node) {
+    /* Copies a node without its childs */
+    static AbstractNode* copyNode(AbstractNode* node) {
       AbstractNode* newNode = nullptr;
       switch (node->getKind()) {
         case ASSERT_NODE:               newNode = new AssertNode(*reinterpret_cast<AssertNode*>(node)); break;
@@ -3623,6 +3621,104 @@ namespace triton {
       return newNode;
     }
 
+
+    AbstractNode* newInstance(AbstractNode* node) {
+      std::unordered_map<AbstractNode*, AbstractNode*> copies;
+
+      /* The childs are copied before their parents, a shared node is copied once */
+      for (AbstractNode* original : nodesExtraction(node, false)) {
+        AbstractNode* copy = copyNode(original);
+        for (AbstractNode*& child : copy->getChilds())
+          child = copies[child];
+        copies[original] = copy;
+      }
+
+      return copies[node];
+    }
+
+
+    /* Returns the value of a DECIMAL_NODE child */
+    static triton::uint32 getDecimalChild(const std::vector<AbstractNode*>& c, triton::uint32 index) {
+      if (c[index]->getKind() != DECIMAL_NODE)
+        throw triton::exceptions::Ast("triton::ast::buildNode(): Expects a DECIMAL_NODE child.");
+      return reinterpret_cast<DecimalNode*>(c[index])->getValue().convert_to<triton::uint32>();
+    }
+
+
+    bool isOperator(enum kind_e kind) {
+      switch (kind) {
+        case BVADD_NODE:  case BVAND_NODE:  case BVASHR_NODE: case BVLSHR_NODE: case BVMUL_NODE:  case BVNAND_NODE:
+        case BVNEG_NODE:  case BVNOR_NODE:  case BVNOT_NODE:  case BVOR_NODE:   case BVROL_NODE:  case BVROR_NODE:
+        case BVSDIV_NODE: case BVSGE_NODE:  case BVSGT_NODE:  case BVSHL_NODE:  case BVSLE_NODE:  case BVSLT_NODE:
+        case BVSMOD_NODE: case BVSREM_NODE: case BVSUB_NODE:  case BVUDIV_NODE: case BVUGE_NODE:  case BVUGT_NODE:
+        case BVULE_NODE:  case BVULT_NODE:  case BVUREM_NODE: case BVXNOR_NODE: case BVXOR_NODE:  case CONCAT_NODE:
+        case DISTINCT_NODE: case EQUAL_NODE: case EXTRACT_NODE: case ITE_NODE: case LAND_NODE:   case LNOT_NODE:
+        case LOR_NODE:    case SX_NODE:     case ZX_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    AbstractNode* buildNode(enum kind_e kind, const std::vector<AbstractNode*>& c) {
+      triton::usize expected = 2;
+
+      switch (kind) {
+        case BVNEG_NODE: case BVNOT_NODE: case LNOT_NODE:   expected = 1; break;
+        case EXTRACT_NODE: case ITE_NODE:                   expected = 3; break;
+        case CONCAT_NODE:                                   expected = std::max<triton::usize>(c.size(), 2); break;
+        default:                                            break;
+      }
+
+      if (c.size() != expected)
+        throw triton::exceptions::Ast("triton::ast::buildNode(): Invalid number of childs.");
+
+      switch (kind) {
+        case BVADD_NODE:                return bvadd(c[0], c[1]);
+        case BVAND_NODE:                return bvand(c[0], c[1]);
+        case BVASHR_NODE:               return bvashr(c[0], c[1]);
+        case BVLSHR_NODE:               return bvlshr(c[0], c[1]);
+        case BVMUL_NODE:                return bvmul(c[0], c[1]);
+        case BVNAND_NODE:               return bvnand(c[0], c[1]);
+        case BVNEG_NODE:                return bvneg(c[0]);
+        case BVNOR_NODE:                return bvnor(c[0], c[1]);
+        case BVNOT_NODE:                return bvnot(c[0]);
+        case BVOR_NODE:                 return bvor(c[0], c[1]);
+        case BVROL_NODE:                return bvrol(getDecimalChild(c, 0), c[1]);
+        case BVROR_NODE:                return bvror(getDecimalChild(c, 0), c[1]);
+        case BVSDIV_NODE:               return bvsdiv(c[0], c[1]);
+        case BVSGE_NODE:                return bvsge(c[0], c[1]);
+        case BVSGT_NODE:                return bvsgt(c[0], c[1]);
+        case BVSHL_NODE:                return bvshl(c[0], c[1]);
+        case BVSLE_NODE:                return bvsle(c[0], c[1]);
+        case BVSLT_NODE:                return bvslt(c[0], c[1]);
+        case BVSMOD_NODE:               return bvsmod(c[0], c[1]);
+        case BVSREM_NODE:               return bvsrem(c[0], c[1]);
+        case BVSUB_NODE:                return bvsub(c[0], c[1]);
+        case BVUDIV_NODE:               return bvudiv(c[0], c[1]);
+        case BVUGE_NODE:                return bvuge(c[0], c[1]);
+        case BVUGT_NODE:                return bvugt(c[0], c[1]);
+        case BVULE_NODE:                return bvule(c[0], c[1]);
+        case BVULT_NODE:                return bvult(c[0], c[1]);
+        case BVUREM_NODE:               return bvurem(c[0], c[1]);
+        case BVXNOR_NODE:               return bvxnor(c[0], c[1]);
+        case BVXOR_NODE:                return bvxor(c[0], c[1]);
+        case CONCAT_NODE:               return concat(c);
+        case DISTINCT_NODE:             return distinct(c[0], c[1]);
+        case EQUAL_NODE:                return equal(c[0], c[1]);
+        case EXTRACT_NODE:              return extract(getDecimalChild(c, 0), getDecimalChild(c, 1), c[2]);
+        case ITE_NODE:                  return ite(c[0], c[1], c[2]);
+        case LAND_NODE:                 return land(c[0], c[1]);
+        case LNOT_NODE:                 return lnot(c[0]);
+        case LOR_NODE:                  return lor(c[0], c[1]);
+        case SX_NODE:                   return sx(getDecimalChild(c, 0), c[1]);
+        case ZX_NODE:                   return zx(getDecimalChild(c, 0), c[1]);
+        default:
+          throw triton::exceptions::Ast("triton::ast::buildNode(): Invalid kind node.");
+      }
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
 
@@ -0,0 +1,751 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+#endif
+
+#include <api.hpp>
+#include <astBytecode.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the index of the first operand, the previous childs are DECIMAL_NODE parameters */
+    static triton::uint32 getFirstOperand(AbstractNode* node) {
+      switch (node->getKind()) {
+        case BV_NODE:
+          return static_cast<triton::uint32>(node->getChilds().size());
+        case EXTRACT_NODE:
+          return 2;
+        case BVROL_NODE: case BVROR_NODE: case SX_NODE: case ZX_NODE:
+          return 1;
+        default:
+          return 0;
+      }
+    }
+
+
+    /* Returns the number of operands read by an opcode, the others are not used */
+    static triton::uint32 getNumberOfOperands(enum AstBytecode::opcode_e opcode) {
+      switch (opcode) {
+        case AstBytecode::OP_CONSTANT: case AstBytecode::OP_VARIABLE:
+          return 0;
+        case AstBytecode::OP_EXTRACT: case AstBytecode::OP_LNOT: case AstBytecode::OP_NEG: case AstBytecode::OP_NOT:
+        case AstBytecode::OP_ROL: case AstBytecode::OP_ROR: case AstBytecode::OP_SX:
+          return 1;
+        case AstBytecode::OP_ITE:
+          return 3;
+        default:
+          return 2;
+      }
+    }
+
+
+    static triton::uint64 getMask(triton::uint32 size) {
+      if (size >= 64)
+        return static_cast<triton::uint64>(-1);
+      return ((static_cast<triton::uint64>(1) << size) - 1);
+    }
+
+
+    /* Sign extends a value of `size` bits */
+    static triton::sint64 toSigned(triton::uint64 value, triton::uint32 size) {
+      if (size >= 64)
+        return static_cast<triton::sint64>(value);
+      return (static_cast<triton::sint64>(value << (64 - size)) >> (64 - size));
+    }
+
+
+    /* Computes one lane of an instruction, the variables are read by the caller. The result is not masked. */
+    static triton::uint64 execute(const AstBytecode::Instruction& inst, triton::uint64 a, triton::uint64 b, triton::uint64 c) {
+      triton::uint64 value = 0;
+
+      switch (inst.opcode) {
+        case AstBytecode::OP_CONSTANT:   value = inst.immediate; break;
+        case AstBytecode::OP_VARIABLE:   break;
+        case AstBytecode::OP_ADD:        value = a + b; break;
+        case AstBytecode::OP_AND:        value = a & b; break;
+        case AstBytecode::OP_CONCAT:     value = (a << inst.immediate) | b; break;
+        case AstBytecode::OP_DISTINCT:   value = (a != b); break;
+        case AstBytecode::OP_EQUAL:      value = (a == b); break;
+        case AstBytecode::OP_EXTRACT:    value = a >> inst.immediate; break;
+        case AstBytecode::OP_ITE:        value = a ? b : c; break;
+        case AstBytecode::OP_LAND:       value = (a && b); break;
+        case AstBytecode::OP_LNOT:       value = !a; break;
+        case AstBytecode::OP_LOR:        value = (a || b); break;
+        case AstBytecode::OP_LSHR:       value = (b >= inst.size) ? 0 : (a >> b); break;
+        case AstBytecode::OP_MUL:        value = a * b; break;
+        case AstBytecode::OP_NAND:       value = ~(a & b); break;
+        case AstBytecode::OP_NEG:        value = 0 - a; break;
+        case AstBytecode::OP_NOR:        value = ~(a | b); break;
+        case AstBytecode::OP_NOT:        value = ~a; break;
+        case AstBytecode::OP_OR:         value = a | b; break;
+        case AstBytecode::OP_SHL:        value = (b >= inst.size) ? 0 : (a << b); break;
+        case AstBytecode::OP_SUB:        value = a - b; break;
+        case AstBytecode::OP_SX:         value = static_cast<triton::uint64>(toSigned(a, static_cast<triton::uint32>(inst.immediate))); break;
+        case AstBytecode::OP_UDIV:       value = (b == 0) ? inst.mask : (a / b); break;
+        case AstBytecode::OP_UGE:        value = (a >= b); break;
+        case AstBytecode::OP_UGT:        value = (a > b); break;
+        case AstBytecode::OP_ULE:        value = (a <= b); break;
+        case AstBytecode::OP_ULT:        value = (a < b); break;
+        case AstBytecode::OP_UREM:       value = (b == 0) ? a : (a % b); break;
+        case AstBytecode::OP_XNOR:       value = ~(a ^ b); break;
+        case AstBytecode::OP_XOR:        value = a ^ b; break;
+
+        case AstBytecode::OP_ASHR: {
+          triton::sint64 sa = toSigned(a, inst.size);
+          if (b >= inst.size)
+            value = (sa < 0) ? inst.mask : 0;
+          else
+            value = static_cast<triton::uint64>(sa >> b);
+          break;
+        }
+
+        case AstBytecode::OP_ROL:
+          value = (inst.immediate == 0) ? a : ((a << inst.immediate) | (a >> (inst.size - inst.immediate)));
+          break;
+
+        case AstBytecode::OP_ROR:
+          value = (inst.immediate == 0) ? a : ((a >> inst.immediate) | (a << (inst.size - inst.immediate)));
+          break;
+
+        /* Same results as the nodes, INT_MIN / -1 included */
+        case AstBytecode::OP_SDIV: {
+          triton::sint64 sa = toSigned(a, inst.size);
+          triton::sint64 sb = toSigned(b, inst.size);
+          if (sb == 0)
+            value = (sa < 0) ? 1 : inst.mask;
+          else if (sb == -1)
+            value = 0 - a;
+          else
+            value = static_cast<triton::uint64>(sa / sb);
+          break;
+        }
+
+        case AstBytecode::OP_SREM: {
+          triton::sint64 sa = toSigned(a, inst.size);
+          triton::sint64 sb = toSigned(b, inst.size);
+          if (sb == 0)
+            value = a;
+          else if (sb == -1)
+            value = 0;
+          else
+            value = static_cast<triton::uint64>(sa % sb);
+          break;
+        }
+
+        /* ((a % b) + b) % b */
+        case AstBytecode::OP_SMOD: {
+          triton::sint64 sa = toSigned(a, inst.size);
+          triton::sint64 sb = toSigned(b, inst.size);
+          triton::sint64 sr = 0;
+          if (sb == 0) {
+            value = a;
+            break;
+          }
+          if (sb != -1)
+            sr = sa % sb;
+          if (sr != 0 && ((sr < 0) != (sb < 0)))
+            sr += sb;
+          value = static_cast<triton::uint64>(sr);
+          break;
+        }
+
+        case AstBytecode::OP_SGE: value = (toSigned(a, static_cast<triton::uint32>(inst.immediate)) >= toSigned(b, static_cast<triton::uint32>(inst.immediate))); break;
+        case AstBytecode::OP_SGT: value = (toSigned(a, static_cast<triton::uint32>(inst.immediate)) >  toSigned(b, static_cast<triton::uint32>(inst.immediate))); break;
+        case AstBytecode::OP_SLE: value = (toSigned(a, static_cast<triton::uint32>(inst.immediate)) <= toSigned(b, static_cast<triton::uint32>(inst.immediate))); break;
+        case AstBytecode::OP_SLT: value = (toSigned(a, static_cast<triton::uint32>(inst.immediate)) <  toSigned(b, static_cast<triton::uint32>(inst.immediate))); break;
+      }
+
+      return value;
+    }
+
+
+#if defined(__AVX2__)
+    /* Computes an instruction on 4 lanes per step. Returns the number of lanes computed, the others are left to execute(). */
+    static triton::usize executeVector(const AstBytecode::Instruction& inst, const triton::uint64* a, const triton::uint64* b, const triton::uint64* c, triton::uint64* r, triton::usize lanes) {
+      const __m256i mask  = _mm256_set1_epi64x(static_cast<long long>(inst.mask));
+      const __m256i zero  = _mm256_setzero_si256();
+      const __m256i ones  = _mm256_set1_epi64x(-1);
+      const __m256i one   = _mm256_set1_epi64x(1);
+      const __m256i bias  = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+      const __m256i max   = _mm256_set1_epi64x(63);
+      const __m256i bits  = _mm256_set1_epi64x(64);
+      const __m256i imm   = _mm256_set1_epi64x(static_cast<long long>(inst.immediate));
+      const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(inst.immediate % 128));
+      const __m128i back  = _mm_cvtsi32_si128(static_cast<int>(inst.size - (inst.immediate % 64)));
+      /* The sign bit of the operands: the size of the operands for sx and the signed comparisons, the size of the result otherwise */
+      const triton::uint32 width = (inst.opcode == AstBytecode::OP_SX || inst.opcode == AstBytecode::OP_SGE || inst.opcode == AstBytecode::OP_SGT ||
+                                    inst.opcode == AstBytecode::OP_SLE || inst.opcode == AstBytecode::OP_SLT) ? static_cast<triton::uint32>(inst.immediate) : inst.size;
+      const __m256i sign  = _mm256_set1_epi64x(static_cast<long long>(static_cast<triton::uint64>(1) << ((width - 1) & 63)));
+      triton::usize index = 0;
+
+      for (; index + 4 <= lanes; index += 4) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + index));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + index));
+        __m256i vr;
+
+        switch (inst.opcode) {
+          case AstBytecode::OP_CONSTANT:  vr = imm; break;
+          case AstBytecode::OP_ADD:       vr = _mm256_add_epi64(va, vb); break;
+          case AstBytecode::OP_AND:       vr = _mm256_and_si256(va, vb); break;
+          case AstBytecode::OP_CONCAT:    vr = _mm256_or_si256(_mm256_sll_epi64(va, shift), vb); break;
+          case AstBytecode::OP_DISTINCT:  vr = _mm256_andnot_si256(_mm256_cmpeq_epi64(va, vb), one); break;
+          case AstBytecode::OP_EQUAL:     vr = _mm256_and_si256(_mm256_cmpeq_epi64(va, vb), one); break;
+          case AstBytecode::OP_EXTRACT:   vr = _mm256_srl_epi64(va, shift); break;
+          case AstBytecode::OP_LAND:      vr = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpeq_epi64(va, zero), _mm256_cmpeq_epi64(vb, zero)), one); break;
+          case AstBytecode::OP_LNOT:      vr = _mm256_and_si256(_mm256_cmpeq_epi64(va, zero), one); break;
+          case AstBytecode::OP_LOR:       vr = _mm256_andnot_si256(_mm256_and_si256(_mm256_cmpeq_epi64(va, zero), _mm256_cmpeq_epi64(vb, zero)), one); break;
+          case AstBytecode::OP_NAND:      vr = _mm256_xor_si256(_mm256_and_si256(va, vb), ones); break;
+          case AstBytecode::OP_NEG:       vr = _mm256_sub_epi64(zero, va); break;
+          case AstBytecode::OP_NOR:       vr = _mm256_xor_si256(_mm256_or_si256(va, vb), ones); break;
+          case AstBytecode::OP_NOT:       vr = _mm256_xor_si256(va, ones); break;
+          case AstBytecode::OP_OR:        vr = _mm256_or_si256(va, vb); break;
+          case AstBytecode::OP_SUB:       vr = _mm256_sub_epi64(va, vb); break;
+          case AstBytecode::OP_XNOR:      vr = _mm256_xor_si256(_mm256_xor_si256(va, vb), ones); break;
+          case AstBytecode::OP_XOR:       vr = _mm256_xor_si256(va, vb); break;
+
+          /* The operands are masked, thus a shift of size bits or more gives zero once masked */
+          case AstBytecode::OP_LSHR:      vr = _mm256_srlv_epi64(va, vb); break;
+          case AstBytecode::OP_SHL:       vr = _mm256_sllv_epi64(va, vb); break;
+
+          /* A shift of 64 bits gives zero, thus a rotation of zero gives the operand */
+          case AstBytecode::OP_ROL:       vr = _mm256_or_si256(_mm256_sll_epi64(va, shift), _mm256_srl_epi64(va, back)); break;
+          case AstBytecode::OP_ROR:       vr = _mm256_or_si256(_mm256_srl_epi64(va, shift), _mm256_sll_epi64(va, back)); break;
+
+          /* lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32) */
+          case AstBytecode::OP_MUL: {
+            __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(va, 32), vb), _mm256_mul_epu32(va, _mm256_srli_epi64(vb, 32)));
+            vr = _mm256_add_epi64(_mm256_mul_epu32(va, vb), _mm256_slli_epi64(cross, 32));
+            break;
+          }
+
+          case AstBytecode::OP_ITE: {
+            __m256i vc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + index));
+            vr = _mm256_blendv_epi8(vb, vc, _mm256_cmpeq_epi64(va, zero));
+            break;
+          }
+
+          /* Sign extension: (a ^ sign) - sign */
+          case AstBytecode::OP_SX:
+            vr = _mm256_sub_epi64(_mm256_xor_si256(va, sign), sign);
+            break;
+
+          /* There is no 64-bits arithmetic shift, the sign is shifted in by hand and the shift is clamped to 63 */
+          case AstBytecode::OP_ASHR: {
+            __m256i sa    = _mm256_sub_epi64(_mm256_xor_si256(va, sign), sign);
+            __m256i count = _mm256_blendv_epi8(vb, max, _mm256_cmpgt_epi64(_mm256_xor_si256(vb, bias), _mm256_xor_si256(max, bias)));
+            __m256i fill  = _mm256_sllv_epi64(_mm256_cmpgt_epi64(zero, sa), _mm256_sub_epi64(bits, count));
+            vr = _mm256_or_si256(_mm256_srlv_epi64(sa, count), fill);
+            break;
+          }
+
+          /* The unsigned comparisons are signed comparisons of the biased operands */
+          case AstBytecode::OP_UGE: vr = _mm256_andnot_si256(_mm256_cmpgt_epi64(_mm256_xor_si256(vb, bias), _mm256_xor_si256(va, bias)), one); break;
+          case AstBytecode::OP_UGT: vr = _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_xor_si256(va, bias), _mm256_xor_si256(vb, bias)), one); break;
+          case AstBytecode::OP_ULE: vr = _mm256_andnot_si256(_mm256_cmpgt_epi64(_mm256_xor_si256(va, bias), _mm256_xor_si256(vb, bias)), one); break;
+          case AstBytecode::OP_ULT: vr = _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_xor_si256(vb, bias), _mm256_xor_si256(va, bias)), one); break;
+
+          /* The signed comparisons are done on the sign extended operands */
+          case AstBytecode::OP_SGE:
+          case AstBytecode::OP_SGT:
+          case AstBytecode::OP_SLE:
+          case AstBytecode::OP_SLT: {
+            __m256i sa = _mm256_sub_epi64(_mm256_xor_si256(va, sign), sign);
+            __m256i sb = _mm256_sub_epi64(_mm256_xor_si256(vb, sign), sign);
+            if (inst.opcode == AstBytecode::OP_SGE)
+              vr = _mm256_andnot_si256(_mm256_cmpgt_epi64(sb, sa), one);
+            else if (inst.opcode == AstBytecode::OP_SGT)
+              vr = _mm256_and_si256(_mm256_cmpgt_epi64(sa, sb), one);
+            else if (inst.opcode == AstBytecode::OP_SLE)
+              vr = _mm256_andnot_si256(_mm256_cmpgt_epi64(sa, sb), one);
+            else
+              vr = _mm256_and_si256(_mm256_cmpgt_epi64(sb, sa), one);
+            break;
+          }
+
+          /* The divisions have no SIMD instruction */
+          default:
+            return index;
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + index), _mm256_and_si256(vr, mask));
+      }
+
+      return index;
+    }
+
+#elif defined(__SSE2__) || defined(_M_X64)
+    /* Computes an instruction on 2 lanes per step. Returns the number of lanes computed, the others are left to execute(). */
+    static triton::usize executeVector(const AstBytecode::Instruction& inst, const triton::uint64* a, const triton::uint64* b, const triton::uint64* c, triton::uint64* r, triton::usize lanes) {
+      const __m128i mask  = _mm_set1_epi64x(static_cast<long long>(inst.mask));
+      const __m128i zero  = _mm_setzero_si128();
+      const __m128i ones  = _mm_set1_epi64x(-1);
+      const __m128i imm   = _mm_set1_epi64x(static_cast<long long>(inst.immediate));
+      const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(inst.immediate % 128));
+      const __m128i back  = _mm_cvtsi32_si128(static_cast<int>(inst.size - (inst.immediate % 64)));
+      const __m128i sign  = _mm_set1_epi64x(static_cast<long long>(static_cast<triton::uint64>(1) << ((inst.immediate - 1) & 63)));
+      triton::usize index = 0;
+
+      for (; index + 2 <= lanes; index += 2) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + index));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + index));
+        __m128i vr;
+
+        switch (inst.opcode) {
+          case AstBytecode::OP_CONSTANT:  vr = imm; break;
+          case AstBytecode::OP_ADD:       vr = _mm_add_epi64(va, vb); break;
+          case AstBytecode::OP_AND:       vr = _mm_and_si128(va, vb); break;
+          case AstBytecode::OP_CONCAT:    vr = _mm_or_si128(_mm_sll_epi64(va, shift), vb); break;
+          case AstBytecode::OP_EXTRACT:   vr = _mm_srl_epi64(va, shift); break;
+          case AstBytecode::OP_NAND:      vr = _mm_xor_si128(_mm_and_si128(va, vb), ones); break;
+          case AstBytecode::OP_NEG:       vr = _mm_sub_epi64(zero, va); break;
+          case AstBytecode::OP_NOR:       vr = _mm_xor_si128(_mm_or_si128(va, vb), ones); break;
+          case AstBytecode::OP_NOT:       vr = _mm_xor_si128(va, ones); break;
+          case AstBytecode::OP_OR:        vr = _mm_or_si128(va, vb); break;
+          case AstBytecode::OP_SUB:       vr = _mm_sub_epi64(va, vb); break;
+          case AstBytecode::OP_XNOR:      vr = _mm_xor_si128(_mm_xor_si128(va, vb), ones); break;
+          case AstBytecode::OP_XOR:       vr = _mm_xor_si128(va, vb); break;
+
+          /* A shift of 64 bits gives zero, thus a rotation of zero gives the operand */
+          case AstBytecode::OP_ROL:       vr = _mm_or_si128(_mm_sll_epi64(va, shift), _mm_srl_epi64(va, back)); break;
+          case AstBytecode::OP_ROR:       vr = _mm_or_si128(_mm_srl_epi64(va, shift), _mm_sll_epi64(va, back)); break;
+
+          /* Sign extension: (a ^ sign) - sign */
+          case AstBytecode::OP_SX:        vr = _mm_sub_epi64(_mm_xor_si128(va, sign), sign); break;
+
+          /* lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32) */
+          case AstBytecode::OP_MUL: {
+            __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(va, 32), vb), _mm_mul_epu32(va, _mm_srli_epi64(vb, 32)));
+            vr = _mm_add_epi64(_mm_mul_epu32(va, vb), _mm_slli_epi64(cross, 32));
+            break;
+          }
+
+          /* SSE2 has neither 64-bits comparisons nor variable shifts */
+          default:
+            return index;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r + index), _mm_and_si128(vr, mask));
+      }
+
+      return index;
+    }
+
+#else
+    /* No SIMD instruction, all the lanes are left to execute(). */
+    static triton::usize executeVector(const AstBytecode::Instruction& inst, const triton::uint64* a, const triton::uint64* b, const triton::uint64* c, triton::uint64* r, triton::usize lanes) {
+      return 0;
+    }
+#endif
+
+
+    AstBytecode::AstBytecode() {
+      this->root              = 0;
+      this->size              = 0;
+      this->numberOfRegisters = 0;
+    }
+
+
+    AstBytecode::AstBytecode(AbstractNode* node) {
+      this->root              = 0;
+      this->size              = 0;
+      this->numberOfRegisters = 0;
+      this->compile(node);
+    }
+
+
+    AstBytecode::AstBytecode(const AstBytecode& copy) {
+      this->copy(copy);
+    }
+
+
+    AstBytecode::~AstBytecode() {
+    }
+
+
+    void AstBytecode::copy(const AstBytecode& other) {
+      this->instructions      = other.instructions;
+      this->root              = other.root;
+      this->size              = other.size;
+      this->numberOfRegisters = other.numberOfRegisters;
+      this->variables         = other.variables;
+    }
+
+
+    triton::uint32 AstBytecode::emit(enum opcode_e opcode, triton::uint32 size, triton::uint32 op1, triton::uint32 op2, triton::uint32 op3, triton::uint64 immediate) {
+      Instruction inst;
+
+      inst.opcode       = opcode;
+      inst.size         = size;
+      inst.operands[0]  = op1;
+      inst.operands[1]  = op2;
+      inst.operands[2]  = op3;
+      inst.result       = 0;
+      inst.immediate    = immediate;
+      inst.mask         = getMask(size);
+
+      this->instructions.push_back(inst);
+      return static_cast<triton::uint32>(this->instructions.size() - 1);
+    }
+
+
+    triton::uint32 AstBytecode::compileNode(AbstractNode* node, const std::vector<triton::uint32>& operands, std::map<triton::usize, triton::uint32>& slots) {
+      std::vector<AbstractNode*>& childs = node->getChilds();
+      triton::uint32 first               = getFirstOperand(node);
+      triton::uint32 size                = node->getBitvectorSize();
+      triton::uint32 ret                 = 0;
+
+      if (size == 0 || size > BYTECODE_MAX_BITS)
+        throw triton::exceptions::Ast("AstBytecode::compile(): Only the nodes of 1 to 64 bits are supported.");
+
+      switch (node->getKind()) {
+        case BV_NODE:
+          return this->emit(OP_CONSTANT, size, 0, 0, 0, node->evaluate().convert_to<triton::uint64>());
+
+        case VARIABLE_NODE: {
+          triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromName(reinterpret_cast<VariableNode*>(node)->getValue());
+          if (symVar == nullptr)
+            throw triton::exceptions::Ast("AstBytecode::compile(): Unknown symbolic variable.");
+          if (slots.find(symVar->getId()) == slots.end()) {
+            slots[symVar->getId()] = static_cast<triton::uint32>(this->variables.size());
+            this->variables.push_back(symVar->getId());
+          }
+          return this->emit(OP_VARIABLE, size, 0, 0, 0, slots[symVar->getId()]);
+        }
+
+        case BVADD_NODE:    return this->emit(OP_ADD,   size, operands[0], operands[1]);
+        case BVAND_NODE:    return this->emit(OP_AND,   size, operands[0], operands[1]);
+        case BVASHR_NODE:   return this->emit(OP_ASHR,  size, operands[0], operands[1]);
+        case BVLSHR_NODE:   return this->emit(OP_LSHR,  size, operands[0], operands[1]);
+        case BVMUL_NODE:    return this->emit(OP_MUL,   size, operands[0], operands[1]);
+        case BVNAND_NODE:   return this->emit(OP_NAND,  size, operands[0], operands[1]);
+        case BVNEG_NODE:    return this->emit(OP_NEG,   size, operands[0]);
+        case BVNOR_NODE:    return this->emit(OP_NOR,   size, operands[0], operands[1]);
+        case BVNOT_NODE:    return this->emit(OP_NOT,   size, operands[0]);
+        case BVOR_NODE:     return this->emit(OP_OR,    size, operands[0], operands[1]);
+        case BVSDIV_NODE:   return this->emit(OP_SDIV,  size, operands[0], operands[1]);
+        case BVSHL_NODE:    return this->emit(OP_SHL,   size, operands[0], operands[1]);
+        case BVSMOD_NODE:   return this->emit(OP_SMOD,  size, operands[0], operands[1]);
+        case BVSREM_NODE:   return this->emit(OP_SREM,  size, operands[0], operands[1]);
+        case BVSUB_NODE:    return this->emit(OP_SUB,   size, operands[0], operands[1]);
+        case BVUDIV_NODE:   return this->emit(OP_UDIV,  size, operands[0], operands[1]);
+        case BVUGE_NODE:    return this->emit(OP_UGE,   size, operands[0], operands[1]);
+        case BVUGT_NODE:    return this->emit(OP_UGT,   size, operands[0], operands[1]);
+        case BVULE_NODE:    return this->emit(OP_ULE,   size, operands[0], operands[1]);
+        case BVULT_NODE:    return this->emit(OP_ULT,   size, operands[0], operands[1]);
+        case BVUREM_NODE:   return this->emit(OP_UREM,  size, operands[0], operands[1]);
+        case BVXNOR_NODE:   return this->emit(OP_XNOR,  size, operands[0], operands[1]);
+        case BVXOR_NODE:    return this->emit(OP_XOR,   size, operands[0], operands[1]);
+        case DISTINCT_NODE: return this->emit(OP_DISTINCT, size, operands[0], operands[1]);
+        case EQUAL_NODE:    return this->emit(OP_EQUAL, size, operands[0], operands[1]);
+        case ITE_NODE:      return this->emit(OP_ITE,   size, operands[0], operands[1], operands[2]);
+        case LNOT_NODE:     return this->emit(OP_LNOT,  size, operands[0]);
+
+        /* The signed comparisons take the size of their operands */
+        case BVSGE_NODE:    return this->emit(OP_SGE,   size, operands[0], operands[1], 0, childs[0]->getBitvectorSize());
+        case BVSGT_NODE:    return this->emit(OP_SGT,   size, operands[0], operands[1], 0, childs[0]->getBitvectorSize());
+        case BVSLE_NODE:    return this->emit(OP_SLE,   size, operands[0], operands[1], 0, childs[0]->getBitvectorSize());
+        case BVSLT_NODE:    return this->emit(OP_SLT,   size, operands[0], operands[1], 0, childs[0]->getBitvectorSize());
+
+        case BVROL_NODE:
+          return this->emit(OP_ROL, size, operands[0], 0, 0, reinterpret_cast<DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>() % size);
+
+        case BVROR_NODE:
+          return this->emit(OP_ROR, size, operands[0], 0, 0, reinterpret_cast<DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>() % size);
+
+        case EXTRACT_NODE:
+          return this->emit(OP_EXTRACT, size, operands[0], 0, 0, reinterpret_cast<DecimalNode*>(childs[1])->getValue().convert_to<triton::uint32>());
+
+        case SX_NODE:
+          return this->emit(OP_SX, size, operands[0], 0, 0, childs[1]->getBitvectorSize());
+
+        /* A zero extension does not change the value */
+        case ZX_NODE:
+          return operands[0];
+
+        /* The n-ary nodes are chained */
+        case CONCAT_NODE: {
+          triton::uint32 width = childs[first]->getBitvectorSize();
+          ret = operands[0];
+          for (triton::usize index = 1; index < operands.size(); index++) {
+            triton::uint32 partSize = childs[first + index]->getBitvectorSize();
+            width += partSize;
+            ret = this->emit(OP_CONCAT, width, ret, operands[index], 0, partSize);
+          }
+          return ret;
+        }
+
+        case LAND_NODE:
+        case LOR_NODE: {
+          ret = operands[0];
+          for (triton::usize index = 1; index < operands.size(); index++)
+            ret = this->emit(node->getKind() == LAND_NODE ? OP_LAND : OP_LOR, size, ret, operands[index]);
+          return ret;
+        }
+
+        default:
+          throw triton::exceptions::Ast("AstBytecode::compile(): Unsupported node.");
+      }
+    }
+
+
+    void AstBytecode::compile(AbstractNode* node) {
+      std::unordered_map<AbstractNode*, triton::uint32> registers;
+      std::map<triton::usize, triton::uint32> slots;
+      std::vector<std::pair<AbstractNode*, bool>> worklist;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstBytecode::compile(): node cannot be null.");
+
+      this->instructions.clear();
+      this->variables.clear();
+      this->root              = 0;
+      this->size              = 0;
+      this->numberOfRegisters = 0;
+
+      /* Post-order walk of the DAG, each node is compiled once */
+      worklist.push_back(std::make_pair(node, false));
+      while (!worklist.empty()) {
+        AbstractNode* current = worklist.back().first;
+        bool expanded         = worklist.back().second;
+
+        if (registers.find(current) != registers.end()) {
+          worklist.pop_back();
+          continue;
+        }
+
+        /* A reference is compiled as the AST it points to */
+        if (current->getKind() == REFERENCE_NODE) {
+          AbstractNode* target = triton::api.getAstFromId(reinterpret_cast<ReferenceNode*>(current)->getValue());
+          if (registers.find(target) != registers.end()) {
+            registers[current] = registers[target];
+            worklist.pop_back();
+          }
+          else {
+            worklist.back().second = true;
+            worklist.push_back(std::make_pair(target, false));
+          }
+          continue;
+        }
+
+        std::vector<AbstractNode*>& childs = current->getChilds();
+        triton::uint32 first = getFirstOperand(current);
+
+        if (!expanded) {
+          worklist.back().second = true;
+          for (triton::usize index = childs.size(); index > first; index--) {
+            if (registers.find(childs[index - 1]) == registers.end())
+              worklist.push_back(std::make_pair(childs[index - 1], false));
+          }
+          continue;
+        }
+
+        std::vector<triton::uint32> operands;
+        for (triton::usize index = first; index < childs.size(); index++)
+          operands.push_back(registers[childs[index]]);
+
+        registers[current] = this->compileNode(current, operands, slots);
+        worklist.pop_back();
+      }
+
+      this->root = registers[node];
+      this->size = node->getBitvectorSize();
+      this->allocateRegisters();
+    }
+
+
+    void AstBytecode::allocateRegisters(void) {
+      std::vector<triton::usize> lastRead(this->instructions.size());
+      std::vector<triton::uint32> registers(this->instructions.size());
+      std::vector<triton::uint32> freed;
+
+      /* The index of the last instruction reading each value, the root is read once the bytecode is run */
+      for (triton::usize index = 0; index < this->instructions.size(); index++) {
+        const Instruction& inst = this->instructions[index];
+        lastRead[index] = index;
+        for (triton::uint32 op = 0; op < getNumberOfOperands(inst.opcode); op++)
+          lastRead[inst.operands[op]] = index;
+      }
+      lastRead[this->root] = this->instructions.size();
+
+      this->numberOfRegisters = 0;
+      for (triton::usize index = 0; index < this->instructions.size(); index++) {
+        Instruction& inst        = this->instructions[index];
+        triton::uint32 operands  = getNumberOfOperands(inst.opcode);
+        triton::uint32 values[3] = {0, 0, 0};
+
+        for (triton::uint32 op = 0; op < operands; op++) {
+          values[op] = inst.operands[op];
+          inst.operands[op] = registers[values[op]];
+        }
+
+        /* The lanes are computed in place, thus the result may be written in a register read for the last time */
+        for (triton::uint32 op = 0; op < operands; op++) {
+          if (lastRead[values[op]] == index && std::find(values, values + op, values[op]) == values + op)
+            freed.push_back(registers[values[op]]);
+        }
+
+        /* The unused operands read a valid register */
+        for (triton::uint32 op = operands; op < 3; op++)
+          inst.operands[op] = 0;
+
+        if (freed.empty()) {
+          registers[index] = this->numberOfRegisters++;
+        }
+        else {
+          registers[index] = freed.back();
+          freed.pop_back();
+        }
+        inst.result = registers[index];
+      }
+
+      this->root = registers[this->root];
+    }
+
+
+    const std::vector<AstBytecode::Instruction>& AstBytecode::getInstructions(void) const {
+      return this->instructions;
+    }
+
+
+    const std::vector<triton::usize>& AstBytecode::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    triton::uint32 AstBytecode::getBitvectorSize(void) const {
+      return this->size;
+    }
+
+
+    triton::uint32 AstBytecode::getNumberOfRegisters(void) const {
+      return this->numberOfRegisters;
+    }
+
+
+    triton::uint64 AstBytecode::run(const std::vector<triton::uint64>& values) const {
+      if (this->instructions.empty())
+        throw triton::exceptions::Ast("AstBytecode::run(): Nothing compiled.");
+
+      if (values.size() < this->variables.size())
+        throw triton::exceptions::Ast("AstBytecode::run(): Expects a value for each variable.");
+
+      std::vector<triton::uint64> r(this->numberOfRegisters);
+
+      for (const Instruction& inst : this->instructions) {
+        if (inst.opcode == OP_VARIABLE)
+          r[inst.result] = values[inst.immediate] & inst.mask;
+        else
+          r[inst.result] = execute(inst, r[inst.operands[0]], r[inst.operands[1]], r[inst.operands[2]]) & inst.mask;
+      }
+
+      return r[this->root];
+    }
+
+
+    void AstBytecode::runBatch(const triton::uint64* values, triton::usize count, triton::uint64* results) const {
+      if (this->instructions.empty())
+        throw triton::exceptions::Ast("AstBytecode::runBatch(): Nothing compiled.");
+
+      if (count == 0)
+        return;
+
+      if ((values == nullptr && !this->variables.empty()) || results == nullptr)
+        throw triton::exceptions::Ast("AstBytecode::runBatch(): values and results cannot be null.");
+
+      /* The register i of the lane j is r[i * BYTECODE_BATCH_LANES + j] */
+      std::vector<triton::uint64> r(this->numberOfRegisters * BYTECODE_BATCH_LANES);
+
+      for (triton::usize base = 0; base < count; base += BYTECODE_BATCH_LANES) {
+        triton::usize lanes = std::min<triton::usize>(BYTECODE_BATCH_LANES, count - base);
+
+        for (const Instruction& inst : this->instructions) {
+          triton::uint64* out = &r[inst.result * BYTECODE_BATCH_LANES];
+
+          if (inst.opcode == OP_VARIABLE) {
+            const triton::uint64* column = values + inst.immediate * count + base;
+            for (triton::usize lane = 0; lane < lanes; lane++)
+              out[lane] = column[lane] & inst.mask;
+            continue;
+          }
+
+          const triton::uint64* a = &r[inst.operands[0] * BYTECODE_BATCH_LANES];
+          const triton::uint64* b = &r[inst.operands[1] * BYTECODE_BATCH_LANES];
+          const triton::uint64* c = &r[inst.operands[2] * BYTECODE_BATCH_LANES];
+
+          for (triton::usize lane = executeVector(inst, a, b, c, out, lanes); lane < lanes; lane++)
+            out[lane] = execute(inst, a[lane], b[lane], c[lane]) & inst.mask;
+        }
+
+        std::copy(r.begin() + this->root * BYTECODE_BATCH_LANES, r.begin() + this->root * BYTECODE_BATCH_LANES + lanes, results + base);
+      }
+    }
+
+
+    std::vector<triton::uint64> AstBytecode::runBatch(const std::vector<triton::uint64>& values, triton::usize count) const {
+      std::vector<triton::uint64> results(count);
+
+      if (values.size() < this->variables.size() * count)
+        throw triton::exceptions::Ast("AstBytecode::runBatch(): Expects count values for each variable.");
+
+      this->runBatch(values.data(), count, results.data());
+      return results;
+    }
+
+
+    triton::uint64 AstBytecode::run(const std::map<triton::usize, triton::uint64>& values) const {
+      std::vector<triton::uint64> slots(this->variables.size());
+
+      for (triton::usize index = 0; index < this->variables.size(); index++) {
+        std::map<triton::usize, triton::uint64>::const_iterator it = values.find(this->variables[index]);
+        if (it != values.end())
+          slots[index] = it->second;
+        else
+          slots[index] = (triton::api.getSymbolicVariableFromId(this->variables[index])->getConcreteValue() & getMask(BYTECODE_MAX_BITS)).convert_to<triton::uint64>();
+      }
+
+      return this->run(slots);
+    }
+
+
+    void AstBytecode::operator=(const AstBytecode& other) {
+      this->copy(other);
+    }
+
+
+    AstBytecode compile(AbstractNode* node) {
+      return AstBytecode(node);
+    }
+
+
+    triton::uint64 run(const AstBytecode& compiled, const std::vector<triton::uint64>& values) {
+      return compiled.run(values);
+    }
+
+
+    triton::uint64 run(const AstBytecode& compiled, const std::map<triton::usize, triton::uint64>& values) {
+      return compiled.run(values);
+    }
+
+
+    std::vector<triton::uint64> runBatch(const AstBytecode& compiled, const std::vector<triton::uint64>& values, triton::usize count) {
+      return compiled.runBatch(values, count);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
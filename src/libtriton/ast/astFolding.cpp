@@ -0,0 +1,545 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include <astFolding.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* An entry of the worklist */
+    struct FoldingItem {
+      //! The node to fold.
+      AbstractNode* node;
+
+      //! The rewritten node whose folding is waited for, nullptr if none.
+      AbstractNode* pending;
+
+      //! True if the childs have been pushed.
+      bool expanded;
+    };
+
+
+    /* Returns true if the node is a Boolean, it cannot be replaced by a bitvector */
+    static bool isBoolean(enum kind_e kind) {
+      switch (kind) {
+        case BVSGE_NODE: case BVSGT_NODE: case BVSLE_NODE: case BVSLT_NODE: case BVUGE_NODE: case BVUGT_NODE:
+        case BVULE_NODE: case BVULT_NODE: case DISTINCT_NODE: case EQUAL_NODE: case LAND_NODE: case LNOT_NODE:
+        case LOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    /* Returns the number of DECIMAL_NODE childs before the operands */
+    static triton::uint32 getNumberOfIndexes(enum kind_e kind) {
+      switch (kind) {
+        case EXTRACT_NODE:
+          return 2;
+        case BVROL_NODE: case BVROR_NODE: case SX_NODE: case ZX_NODE:
+          return 1;
+        default:
+          return 0;
+      }
+    }
+
+
+    static triton::uint32 getIndex(AbstractNode* node, triton::uint32 index) {
+      return reinterpret_cast<DecimalNode*>(node->getChilds()[index])->getValue().convert_to<triton::uint32>();
+    }
+
+
+    static bool isConstant(AbstractNode* node) {
+      return (node->getKind() == BV_NODE);
+    }
+
+
+    static bool isValue(AbstractNode* node, triton::uint512 value) {
+      return (node->getKind() == BV_NODE && node->evaluate() == value);
+    }
+
+
+    static bool isMax(AbstractNode* node) {
+      return (node->getKind() == BV_NODE && node->evaluate() == node->getBitvectorMask());
+    }
+
+
+    /* Returns true if both nodes are the same leaf. Operators are only compared by pointer, which is enough with the AST_DICTIONARIES optimization */
+    static bool isSame(AbstractNode* node1, AbstractNode* node2) {
+      if (node1 == node2)
+        return true;
+
+      if (node1->getKind() != node2->getKind() || node1->getBitvectorSize() != node2->getBitvectorSize())
+        return false;
+
+      switch (node1->getKind()) {
+        case BV_NODE:
+          return (node1->evaluate() == node2->evaluate());
+        case REFERENCE_NODE:
+          return (reinterpret_cast<ReferenceNode*>(node1)->getValue() == reinterpret_cast<ReferenceNode*>(node2)->getValue());
+        case VARIABLE_NODE:
+          return (reinterpret_cast<VariableNode*>(node1)->getValue() == reinterpret_cast<VariableNode*>(node2)->getValue());
+        default:
+          return false;
+      }
+    }
+
+
+    /* Returns true if `node` is a `kind` node with an operand equal to `operand` */
+    static bool hasOperand(AbstractNode* node, enum kind_e kind, AbstractNode* operand) {
+      if (node->getKind() != kind)
+        return false;
+      return (isSame(node->getChilds()[0], operand) || isSame(node->getChilds()[1], operand));
+    }
+
+
+    static bool isCommutative(enum kind_e kind) {
+      switch (kind) {
+        case BVADD_NODE: case BVAND_NODE: case BVMUL_NODE: case BVNAND_NODE: case BVNOR_NODE: case BVOR_NODE:
+        case BVXNOR_NODE: case BVXOR_NODE: case DISTINCT_NODE: case EQUAL_NODE: case LAND_NODE: case LOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    /* Returns the rank of an operand in the canonical order: references, variables, operators and constants */
+    static triton::uint32 getRank(AbstractNode* node) {
+      switch (node->getKind()) {
+        case REFERENCE_NODE:  return 0;
+        case VARIABLE_NODE:   return 1;
+        case BV_NODE:         return 3;
+        default:              return 2;
+      }
+    }
+
+
+    /* Returns true if node1 comes before node2 in the canonical order. Operators keep their order. */
+    static bool isBefore(AbstractNode* node1, AbstractNode* node2) {
+      triton::uint32 rank1 = getRank(node1);
+      triton::uint32 rank2 = getRank(node2);
+
+      if (rank1 != rank2)
+        return (rank1 < rank2);
+
+      switch (node1->getKind()) {
+        case REFERENCE_NODE:
+          return (reinterpret_cast<ReferenceNode*>(node1)->getValue() < reinterpret_cast<ReferenceNode*>(node2)->getValue());
+        case VARIABLE_NODE:
+          return (reinterpret_cast<VariableNode*>(node1)->getValue() < reinterpret_cast<VariableNode*>(node2)->getValue());
+        case BV_NODE:
+          return (node1->evaluate() < node2->evaluate());
+        default:
+          return false;
+      }
+    }
+
+
+    /* Extracts the bits [high:low] of a concatenation */
+    static AbstractNode* foldExtractConcat(triton::uint32 high, triton::uint32 low, AbstractNode* node) {
+      std::vector<AbstractNode*>& parts = node->getChilds();
+      std::vector<AbstractNode*> pieces;
+      triton::uint32 offset = 0;
+
+      /* The last part holds the least significant bits */
+      for (triton::usize index = parts.size(); index > 0 && offset <= high; index--) {
+        AbstractNode* part = parts[index - 1];
+        triton::uint32 partHigh = offset + part->getBitvectorSize() - 1;
+        if (partHigh >= low) {
+          triton::uint32 h = std::min(high, partHigh) - offset;
+          triton::uint32 l = std::max(low, offset) - offset;
+          if (l == 0 && h + 1 == part->getBitvectorSize())
+            pieces.push_back(part);
+          else
+            pieces.push_back(extract(h, l, part));
+        }
+        offset += part->getBitvectorSize();
+      }
+
+      if (pieces.size() == 1)
+        return pieces[0];
+
+      std::reverse(pieces.begin(), pieces.end());
+      return concat(pieces);
+    }
+
+
+    /* Merges the adjacent constants and the adjacent extractions of a same node */
+    static AbstractNode* foldConcat(AbstractNode* node) {
+      std::vector<AbstractNode*>& parts = node->getChilds();
+      std::vector<AbstractNode*> merged;
+      bool changed = false;
+
+      for (triton::usize index = 0; index < parts.size(); index++) {
+        AbstractNode* part = parts[index];
+
+        if (!merged.empty()) {
+          AbstractNode* last = merged.back();
+
+          if (isConstant(last) && isConstant(part)) {
+            merged.back() = bv((last->evaluate() << part->getBitvectorSize()) | part->evaluate(), last->getBitvectorSize() + part->getBitvectorSize());
+            changed = true;
+            continue;
+          }
+
+          if (last->getKind() == EXTRACT_NODE && part->getKind() == EXTRACT_NODE &&
+              isSame(last->getChilds()[2], part->getChilds()[2]) && getIndex(last, 1) == getIndex(part, 0) + 1) {
+            merged.back() = extract(getIndex(last, 0), getIndex(part, 1), part->getChilds()[2]);
+            changed = true;
+            continue;
+          }
+        }
+
+        merged.push_back(part);
+      }
+
+      if (changed)
+        return (merged.size() == 1) ? merged[0] : concat(merged);
+
+      /* (concat (_ bv0 n) x) -> ((_ zero_extend n) x) */
+      if (parts.size() == 2 && isValue(parts[0], 0))
+        return zx(parts[0]->getBitvectorSize(), parts[1]);
+
+      return node;
+    }
+
+
+    AstFolding::AstFolding() {
+    }
+
+
+    AstFolding::AstFolding(const AstFolding& copy) {
+      this->copy(copy);
+    }
+
+
+    AstFolding::~AstFolding() {
+    }
+
+
+    void AstFolding::copy(const AstFolding& other) {
+      this->foldedNodes = other.foldedNodes;
+      this->foldedFrom  = other.foldedFrom;
+    }
+
+
+    AbstractNode* AstFolding::foldNode(AbstractNode* node) const {
+      enum kind_e kind                  = node->getKind();
+      std::vector<AbstractNode*>& c     = node->getChilds();
+      triton::uint32 size               = node->getBitvectorSize();
+      triton::uint32 indexes            = getNumberOfIndexes(kind);
+
+      /* Constant folding. A Boolean has no constant form. */
+      if (!isBoolean(kind)) {
+        bool constant = true;
+        for (triton::uint32 index = indexes; index < c.size() && constant; index++)
+          constant = isConstant(c[index]);
+        if (constant)
+          return bv(node->evaluate(), size);
+      }
+
+      switch (kind) {
+        case BVADD_NODE:
+          if (isValue(c[0], 0)) return c[1];
+          if (isValue(c[1], 0)) return c[0];
+          break;
+
+        case BVSUB_NODE:
+          if (isValue(c[1], 0)) return c[0];
+          if (isSame(c[0], c[1])) return bv(0, size);
+          break;
+
+        case BVMUL_NODE:
+          if (isValue(c[0], 0) || isValue(c[1], 0)) return bv(0, size);
+          if (isValue(c[0], 1)) return c[1];
+          if (isValue(c[1], 1)) return c[0];
+          break;
+
+        case BVAND_NODE:
+          if (isValue(c[0], 0) || isValue(c[1], 0)) return bv(0, size);
+          if (isMax(c[0])) return c[1];
+          if (isMax(c[1]) || isSame(c[0], c[1])) return c[0];
+          /* Absorption: x & (x | y) -> x */
+          if (hasOperand(c[1], BVOR_NODE, c[0])) return c[0];
+          if (hasOperand(c[0], BVOR_NODE, c[1])) return c[1];
+          break;
+
+        case BVOR_NODE:
+          if (isValue(c[0], 0)) return c[1];
+          if (isValue(c[1], 0) || isSame(c[0], c[1])) return c[0];
+          if (isMax(c[0]) || isMax(c[1])) return bv(node->getBitvectorMask(), size);
+          /* Absorption: x | (x & y) -> x */
+          if (hasOperand(c[1], BVAND_NODE, c[0])) return c[0];
+          if (hasOperand(c[0], BVAND_NODE, c[1])) return c[1];
+          break;
+
+        case BVXOR_NODE:
+          if (isValue(c[0], 0)) return c[1];
+          if (isValue(c[1], 0)) return c[0];
+          if (isSame(c[0], c[1])) return bv(0, size);
+          break;
+
+        case BVASHR_NODE:
+        case BVLSHR_NODE:
+        case BVSHL_NODE:
+          if (isValue(c[1], 0)) return c[0];
+          if (isValue(c[0], 0)) return bv(0, size);
+          break;
+
+        case BVSDIV_NODE:
+        case BVUDIV_NODE:
+          if (isValue(c[1], 1)) return c[0];
+          break;
+
+        /* Double negations */
+        case BVNEG_NODE:
+        case BVNOT_NODE:
+        case LNOT_NODE:
+          if (c[0]->getKind() == kind) return c[0]->getChilds()[0];
+          break;
+
+        case LAND_NODE:
+        case LOR_NODE:
+          if (isSame(c[0], c[1])) return c[0];
+          break;
+
+        case ITE_NODE: {
+          if (isSame(c[1], c[2])) return c[1];
+          /* A comparison of constants */
+          std::vector<AbstractNode*>& cond = c[0]->getChilds();
+          if (isBoolean(c[0]->getKind()) && cond.size() == 2 && isConstant(cond[0]) && isConstant(cond[1]))
+            return c[0]->evaluate() ? c[1] : c[2];
+          break;
+        }
+
+        case EXTRACT_NODE: {
+          triton::uint32 high = getIndex(node, 0);
+          triton::uint32 low  = getIndex(node, 1);
+          AbstractNode* x     = c[2];
+
+          if (low == 0 && high + 1 == x->getBitvectorSize())
+            return x;
+
+          switch (x->getKind()) {
+            case CONCAT_NODE:
+              return foldExtractConcat(high, low, x);
+
+            case EXTRACT_NODE:
+              return extract(high + getIndex(x, 1), low + getIndex(x, 1), x->getChilds()[2]);
+
+            case SX_NODE:
+              if (high < x->getChilds()[1]->getBitvectorSize())
+                return extract(high, low, x->getChilds()[1]);
+              break;
+
+            case ZX_NODE:
+              if (high < x->getChilds()[1]->getBitvectorSize())
+                return extract(high, low, x->getChilds()[1]);
+              if (low >= x->getChilds()[1]->getBitvectorSize())
+                return bv(0, size);
+              break;
+
+            default:
+              break;
+          }
+          break;
+        }
+
+        case SX_NODE:
+          if (getIndex(node, 0) == 0) return c[1];
+          if (c[1]->getKind() == SX_NODE) return sx(getIndex(node, 0) + getIndex(c[1], 0), c[1]->getChilds()[1]);
+          /* The sign of a zero extension is 0 */
+          if (c[1]->getKind() == ZX_NODE && getIndex(c[1], 0) > 0) return zx(getIndex(node, 0) + getIndex(c[1], 0), c[1]->getChilds()[1]);
+          break;
+
+        case ZX_NODE:
+          if (getIndex(node, 0) == 0) return c[1];
+          if (c[1]->getKind() == ZX_NODE) return zx(getIndex(node, 0) + getIndex(c[1], 0), c[1]->getChilds()[1]);
+          break;
+
+        case CONCAT_NODE:
+          return foldConcat(node);
+
+        default:
+          break;
+      }
+
+      return node;
+    }
+
+
+    void AstFolding::setFoldedNode(AbstractNode* node, AbstractNode* folded) {
+      this->foldedNodes[node] = folded;
+      if (folded != node)
+        this->foldedFrom[folded].insert(node);
+    }
+
+
+    AbstractNode* AstFolding::foldAst(AbstractNode* node) {
+      std::unordered_map<AbstractNode*, AbstractNode*>::iterator it;
+      std::vector<FoldingItem> worklist;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstFolding::foldAst(): node cannot be null.");
+
+      worklist.push_back({node, nullptr, false});
+
+      /*
+       * Post-order walk of the DAG. Once its childs are folded, a node is rebuilt and rewritten. A rewritten
+       * node goes back to the worklist until a fixed point, and its original node waits for its result.
+       */
+      while (!worklist.empty()) {
+        FoldingItem& item = worklist.back();
+        AbstractNode* current = item.node;
+
+        if (this->foldedNodes.find(current) != this->foldedNodes.end()) {
+          worklist.pop_back();
+          continue;
+        }
+
+        if (item.pending != nullptr) {
+          this->setFoldedNode(current, this->foldedNodes[item.pending]);
+          worklist.pop_back();
+          continue;
+        }
+
+        std::vector<AbstractNode*>& childs = current->getChilds();
+        triton::uint32 indexes = getNumberOfIndexes(current->getKind());
+
+        /* References are not followed, and the other leaves are already folded */
+        if (!isOperator(current->getKind())) {
+          this->setFoldedNode(current, current);
+          worklist.pop_back();
+          continue;
+        }
+
+        if (!item.expanded) {
+          item.expanded = true;
+          for (triton::usize index = childs.size(); index > indexes; index--) {
+            if (this->foldedNodes.find(childs[index - 1]) == this->foldedNodes.end())
+              worklist.push_back({childs[index - 1], nullptr, false});
+          }
+          continue;
+        }
+
+        /* Rebuilds the node with its folded childs */
+        std::vector<AbstractNode*> folded = childs;
+        bool changed = false;
+        for (triton::usize index = indexes; index < folded.size(); index++) {
+          folded[index] = this->foldedNodes[folded[index]];
+          changed |= (folded[index] != childs[index]);
+        }
+
+        AbstractNode* rebuilt = changed ? buildNode(current->getKind(), folded) : current;
+
+        /* The rebuilt node may already exist with the AST_DICTIONARIES optimization */
+        it = this->foldedNodes.find(rebuilt);
+        if (it != this->foldedNodes.end()) {
+          this->setFoldedNode(current, it->second);
+          worklist.pop_back();
+          continue;
+        }
+
+        AbstractNode* rewritten = this->foldNode(rebuilt);
+
+        if (rewritten == rebuilt) {
+          this->setFoldedNode(current, rebuilt);
+          this->setFoldedNode(rebuilt, rebuilt);
+          worklist.pop_back();
+          continue;
+        }
+
+        it = this->foldedNodes.find(rewritten);
+        if (it != this->foldedNodes.end()) {
+          this->setFoldedNode(current, it->second);
+          worklist.pop_back();
+          continue;
+        }
+
+        item.pending = rewritten;
+        worklist.push_back({rewritten, nullptr, false});
+      }
+
+      return this->foldedNodes[node];
+    }
+
+
+    AbstractNode* AstFolding::canonicalizeAstNode(AbstractNode* node) const {
+      std::vector<AbstractNode*>& childs = node->getChilds();
+
+      if (!isOperator(node->getKind()))
+        return node;
+
+      /* The operands are swapped in place, the value of the node does not change */
+      if (isCommutative(node->getKind()) && childs.size() == 2 && isBefore(childs[1], childs[0]))
+        std::swap(childs[0], childs[1]);
+
+      /* The childs are already canonical, one rule is enough. The nodes built by the rule are canonicalized as well. */
+      AbstractNode* ret = this->foldNode(node);
+      if (ret != node) {
+        for (triton::usize index = 0; index < childs.size(); index++)
+          childs[index]->removeParent(node);
+        delete node;
+      }
+
+      return ret;
+    }
+
+
+    triton::usize AstFolding::getNumberOfFoldedNodes(void) const {
+      return this->foldedNodes.size();
+    }
+
+
+    void AstFolding::clearFoldedNodes(void) {
+      this->foldedNodes.clear();
+      this->foldedFrom.clear();
+    }
+
+
+    void AstFolding::evictFoldedNodes(const std::set<AbstractNode*>& nodes) {
+      std::unordered_map<AbstractNode*, AbstractNode*>::iterator it;
+      std::unordered_map<AbstractNode*, std::unordered_set<AbstractNode*>>::iterator from;
+
+      for (AbstractNode* node : nodes) {
+        /* The freed node as a key */
+        it = this->foldedNodes.find(node);
+        if (it != this->foldedNodes.end()) {
+          from = this->foldedFrom.find(it->second);
+          if (it->second != node && from != this->foldedFrom.end()) {
+            from->second.erase(node);
+            if (from->second.empty())
+              this->foldedFrom.erase(from);
+          }
+          this->foldedNodes.erase(it);
+        }
+
+        /* The freed node as the result of other nodes */
+        from = this->foldedFrom.find(node);
+        if (from != this->foldedFrom.end()) {
+          for (AbstractNode* origin : from->second)
+            this->foldedNodes.erase(origin);
+          this->foldedFrom.erase(from);
+        }
+      }
+    }
+
+
+    void AstFolding::operator=(const AstFolding& other) {
+      this->copy(other);
+    }
+
+  }; /* ast namespace */
+}; /*triton namespace */
@@ -57,14 +57,19 @@ namespace triton {
 
 
     void AstGarbageCollector::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
-      std::vector<triton::ast::AbstractNode*>::const_iterator it;
-      uniqueNodes.insert(root);
-      for (it = root->getChilds().begin(); it != root->getChilds().end(); it++)
-        this->extractUniqueAstNodes(uniqueNodes, *it);
+      std::vector<triton::ast::AbstractNode*> nodes = triton::ast::nodesExtraction(root, false);
+      uniqueNodes.insert(nodes.begin(), nodes.end());
     }
 
 
     triton::ast::AbstractNode* AstGarbageCollector::recordAstNode(triton::ast::AbstractNode* node) {
+      /* Check if the AST_CANONICALIZATION is enabled. The returned node is already recorded. */
+      if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_CANONICALIZATION)) {
+        triton::ast::AbstractNode* ret = triton::api.canonicalizeAstNode(node);
+        if (ret != node)
+          return ret;
+      }
+
       /* Check if the AST_DICTIONARIES is enabled. */
       if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
         triton::ast::AbstractNode* ret = triton::api.browseAstDictionaries(node);
@@ -0,0 +1,399 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include <api.hpp>
+#include <astSerialization.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Writes a 32-bits or 64-bits little-endian integer */
+    static void writeFixed(std::ostream& stream, triton::uint64 value, triton::uint32 bytes) {
+      for (triton::uint32 index = 0; index < bytes; index++)
+        stream.put(static_cast<char>((value >> (index * 8)) & 0xff));
+    }
+
+
+    static triton::uint64 readFixed(std::istream& stream, triton::uint32 bytes) {
+      triton::uint64 value = 0;
+
+      for (triton::uint32 index = 0; index < bytes; index++) {
+        int byte = stream.get();
+        if (byte == std::char_traits<char>::eof())
+          throw triton::exceptions::Ast("triton::ast::readFixed(): Unexpected end of file.");
+        value |= (static_cast<triton::uint64>(byte & 0xff) << (index * 8));
+      }
+
+      return value;
+    }
+
+
+    /* Returns the value of a DECIMAL_NODE child */
+    static triton::uint512 getDecimal(AbstractNode* node) {
+      if (node->getKind() != DECIMAL_NODE)
+        throw triton::exceptions::Ast("triton::ast::readNodeTable(): Expects a DECIMAL_NODE as parameter.");
+      return reinterpret_cast<DecimalNode*>(node)->getValue();
+    }
+
+
+    /* Returns the value of a STRING_NODE child */
+    static std::string getString(AbstractNode* node) {
+      if (node->getKind() != STRING_NODE)
+        throw triton::exceptions::Ast("triton::ast::readNodeTable(): Expects a STRING_NODE as parameter.");
+      return reinterpret_cast<StringNode*>(node)->getValue();
+    }
+
+
+    static void checkChilds(const std::vector<AbstractNode*>& childs, triton::usize expected) {
+      if (childs.size() != expected)
+        throw triton::exceptions::Ast("triton::ast::readNodeTable(): Invalid number of childs.");
+    }
+
+
+    /* Rebuilds a node from its kind, its childs and the value of a leaf */
+    static AbstractNode* rebuildNode(enum kind_e kind, const std::vector<AbstractNode*>& c, std::istream& stream) {
+      switch (kind) {
+        case DECIMAL_NODE:
+          return decimal(readVarint512(stream));
+
+        case REFERENCE_NODE:
+          return reference(readVarint(stream));
+
+        case STRING_NODE:
+          return string(readString(stream));
+
+        case VARIABLE_NODE: {
+          triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromName(readString(stream));
+          if (symVar == nullptr)
+            throw triton::exceptions::Ast("triton::ast::readNodeTable(): Variable not found.");
+          return variable(*symVar);
+        }
+
+        case ASSERT_NODE:
+          checkChilds(c, 1);
+          return assert_(c[0]);
+
+        case BV_NODE:
+          checkChilds(c, 2);
+          return bv(getDecimal(c[0]), getDecimal(c[1]).convert_to<triton::uint32>());
+
+        case BVDECL_NODE:
+          checkChilds(c, 1);
+          return bvdecl(getDecimal(c[0]).convert_to<triton::uint32>());
+
+        case COMPOUND_NODE:
+          return compound(c);
+
+        case DECLARE_FUNCTION_NODE:
+          checkChilds(c, 2);
+          return declareFunction(getString(c[0]), c[1]);
+
+        case LET_NODE:
+          checkChilds(c, 3);
+          return let(getString(c[0]), c[1], c[2]);
+
+        default:
+          return buildNode(kind, c);
+      }
+    }
+
+
+    void writeVarint(std::ostream& stream, triton::uint64 value) {
+      char buffer[10];
+      triton::uint32 size = 0;
+
+      while (value >= 0x80) {
+        buffer[size++] = static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+      }
+      buffer[size++] = static_cast<char>(value);
+      stream.write(buffer, size);
+    }
+
+
+    void writeVarint(std::ostream& stream, triton::uint512 value) {
+      /* Most of the constants fit in 64 bits */
+      while (value > std::numeric_limits<triton::uint64>::max()) {
+        stream.put(static_cast<char>((value & 0x7f).convert_to<triton::uint8>() | 0x80));
+        value >>= 7;
+      }
+      writeVarint(stream, value.convert_to<triton::uint64>());
+    }
+
+
+    triton::uint64 readVarint(std::istream& stream) {
+      triton::uint64 value = 0;
+
+      for (triton::uint32 shift = 0; shift < 64; shift += 7) {
+        int byte = stream.get();
+        if (byte == std::char_traits<char>::eof())
+          throw triton::exceptions::Ast("triton::ast::readVarint(): Unexpected end of file.");
+        if (shift == 63 && (byte & 0x7e))
+          break;
+        value |= (static_cast<triton::uint64>(byte & 0x7f) << shift);
+        if ((byte & 0x80) == 0)
+          return value;
+      }
+
+      throw triton::exceptions::Ast("triton::ast::readVarint(): The value does not fit in 64 bits.");
+    }
+
+
+    triton::uint512 readVarint512(std::istream& stream) {
+      triton::uint512 value = 0;
+
+      for (triton::uint32 shift = 0; shift < 512; shift += 7) {
+        int byte = stream.get();
+        if (byte == std::char_traits<char>::eof())
+          throw triton::exceptions::Ast("triton::ast::readVarint512(): Unexpected end of file.");
+        if (shift == 511 && (byte & 0x7e))
+          break;
+        value |= (triton::uint512(byte & 0x7f) << shift);
+        if ((byte & 0x80) == 0)
+          return value;
+      }
+
+      throw triton::exceptions::Ast("triton::ast::readVarint512(): The value does not fit in 512 bits.");
+    }
+
+
+    void writeString(std::ostream& stream, const std::string& value) {
+      writeVarint(stream, static_cast<triton::uint64>(value.size()));
+      stream.write(value.data(), value.size());
+    }
+
+
+    std::string readString(std::istream& stream) {
+      triton::uint64 size = readVarint(stream);
+      std::string value;
+
+      /* The size is not trusted, the string grows with the bytes really read */
+      while (value.size() < size) {
+        char buffer[4096];
+        triton::uint64 chunk = std::min<triton::uint64>(sizeof(buffer), size - value.size());
+        stream.read(buffer, chunk);
+        if (static_cast<triton::uint64>(stream.gcount()) != chunk)
+          throw triton::exceptions::Ast("triton::ast::readString(): Unexpected end of file.");
+        value.append(buffer, chunk);
+      }
+
+      return value;
+    }
+
+
+    void writeHeader(std::ostream& stream) {
+      writeFixed(stream, SERIALIZATION_MAGIC, 4);
+      writeFixed(stream, SERIALIZATION_VERSION, 4);
+    }
+
+
+    void readHeader(std::istream& stream) {
+      if (readFixed(stream, 4) != SERIALIZATION_MAGIC)
+        throw triton::exceptions::Ast("triton::ast::readHeader(): Invalid magic.");
+
+      if (readFixed(stream, 4) != SERIALIZATION_VERSION)
+        throw triton::exceptions::Ast("triton::ast::readHeader(): Unsupported version.");
+    }
+
+
+    void writeSection(std::ostream& stream, enum serialization_section_e kind, const std::string& payload) {
+      stream.put(static_cast<char>(kind));
+      if (kind == SECTION_END)
+        return;
+      writeFixed(stream, payload.size(), 8);
+      stream.write(payload.data(), payload.size());
+    }
+
+
+    enum serialization_section_e readSection(std::istream& stream, std::string& payload) {
+      enum serialization_section_e kind = static_cast<enum serialization_section_e>(readFixed(stream, 1));
+      triton::uint64 size = 0;
+
+      payload.clear();
+      if (kind == SECTION_END)
+        return kind;
+
+      size = readFixed(stream, 8);
+      while (payload.size() < size) {
+        char buffer[65536];
+        triton::uint64 chunk = std::min<triton::uint64>(sizeof(buffer), size - payload.size());
+        stream.read(buffer, chunk);
+        if (static_cast<triton::uint64>(stream.gcount()) != chunk)
+          throw triton::exceptions::Ast("triton::ast::readSection(): Unexpected end of file.");
+        payload.append(buffer, chunk);
+      }
+
+      return kind;
+    }
+
+
+    /* Writes the record of a node whose childs are written */
+    static void writeNode(std::ostream& stream, AbstractNode* node, triton::usize index, const std::unordered_map<AbstractNode*, triton::usize>& indexes) {
+      std::vector<AbstractNode*>& childs = node->getChilds();
+
+      writeVarint(stream, static_cast<triton::uint64>(node->getKind()));
+      writeVarint(stream, static_cast<triton::uint64>(childs.size()));
+      for (AbstractNode* child : childs)
+        writeVarint(stream, static_cast<triton::uint64>(index - indexes.find(child)->second));
+
+      switch (node->getKind()) {
+        case DECIMAL_NODE:
+          writeVarint(stream, reinterpret_cast<DecimalNode*>(node)->getValue());
+          break;
+        case REFERENCE_NODE:
+          writeVarint(stream, static_cast<triton::uint64>(reinterpret_cast<ReferenceNode*>(node)->getValue()));
+          break;
+        case STRING_NODE:
+          writeString(stream, reinterpret_cast<StringNode*>(node)->getValue());
+          break;
+        case VARIABLE_NODE:
+          writeString(stream, reinterpret_cast<VariableNode*>(node)->getValue());
+          break;
+        default:
+          break;
+      }
+    }
+
+
+    void writeNodeTable(std::ostream& stream, const std::vector<AbstractNode*>& roots) {
+      std::unordered_map<AbstractNode*, triton::usize> indexes;
+      std::vector<std::pair<AbstractNode*, bool>> worklist;
+      std::ostringstream records;
+      triton::usize numberOfNodes = 0;
+
+      /* Post-order of the unique nodes of all the roots, a node is written once its childs are */
+      for (AbstractNode* root : roots) {
+        if (root == nullptr)
+          throw triton::exceptions::Ast("triton::ast::writeNodeTable(): root cannot be null.");
+
+        worklist.push_back(std::make_pair(root, false));
+        while (!worklist.empty()) {
+          AbstractNode* node = worklist.back().first;
+
+          if (worklist.back().second) {
+            worklist.pop_back();
+            if (indexes.emplace(node, numberOfNodes).second)
+              writeNode(records, node, numberOfNodes++, indexes);
+            continue;
+          }
+
+          if (indexes.find(node) != indexes.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          worklist.back().second = true;
+          std::vector<AbstractNode*>& childs = node->getChilds();
+          for (triton::usize index = childs.size(); index > 0; index--) {
+            if (indexes.find(childs[index - 1]) == indexes.end())
+              worklist.push_back(std::make_pair(childs[index - 1], false));
+          }
+        }
+      }
+
+      writeVarint(stream, static_cast<triton::uint64>(roots.size()));
+      for (AbstractNode* root : roots)
+        writeVarint(stream, static_cast<triton::uint64>(indexes[root]));
+
+      writeVarint(stream, static_cast<triton::uint64>(numberOfNodes));
+      const std::string& data = records.str();
+      stream.write(data.data(), data.size());
+    }
+
+
+    std::vector<AbstractNode*> readNodeTable(std::istream& stream, const std::function<void(triton::usize, AbstractNode*)>& onRoot) {
+      std::vector<std::pair<triton::uint64, triton::usize>> pending;
+      std::vector<AbstractNode*> nodes;
+      std::vector<AbstractNode*> childs;
+      std::vector<AbstractNode*> roots;
+      triton::uint64 numberOfRoots = readVarint(stream);
+      triton::uint64 numberOfNodes = 0;
+      triton::usize next = 0;
+
+      /* The roots are given back by order of their nodes */
+      for (triton::uint64 position = 0; position < numberOfRoots; position++)
+        pending.push_back(std::make_pair(readVarint(stream), static_cast<triton::usize>(position)));
+      std::sort(pending.begin(), pending.end());
+
+      /* The counts are not trusted, the tables grow with the records really read */
+      numberOfNodes = readVarint(stream);
+      nodes.reserve(std::min<triton::uint64>(numberOfNodes, 0x100000));
+      for (triton::uint64 index = 0; index < numberOfNodes; index++) {
+        enum kind_e kind = static_cast<enum kind_e>(readVarint(stream));
+        triton::uint64 numberOfChilds = readVarint(stream);
+
+        childs.clear();
+        for (triton::uint64 child = 0; child < numberOfChilds; child++) {
+          triton::uint64 distance = readVarint(stream);
+          if (distance == 0 || distance > index)
+            throw triton::exceptions::Ast("triton::ast::readNodeTable(): Invalid child index.");
+          childs.push_back(nodes[index - distance]);
+        }
+
+        nodes.push_back(rebuildNode(kind, childs, stream));
+
+        for (; next < pending.size() && pending[next].first == index; next++) {
+          if (onRoot)
+            onRoot(pending[next].second, nodes.back());
+        }
+      }
+
+      if (next != pending.size())
+        throw triton::exceptions::Ast("triton::ast::readNodeTable(): Invalid root index.");
+
+      roots.resize(pending.size());
+      for (const std::pair<triton::uint64, triton::usize>& root : pending)
+        roots[root.second] = nodes[root.first];
+
+      return roots;
+    }
+
+
+    void serialize(std::ostream& stream, const std::vector<AbstractNode*>& roots) {
+      std::ostringstream payload;
+
+      writeNodeTable(payload, roots);
+      writeHeader(stream);
+      writeSection(stream, SECTION_AST, payload.str());
+      writeSection(stream, SECTION_END, "");
+    }
+
+
+    std::vector<AbstractNode*> deserialize(std::istream& stream) {
+      std::vector<AbstractNode*> roots;
+      std::string payload;
+      bool found = false;
+
+      readHeader(stream);
+      for (enum serialization_section_e kind = readSection(stream, payload); kind != SECTION_END; kind = readSection(stream, payload)) {
+        /* The other sections belong to a symbolic state */
+        if (kind != SECTION_AST)
+          continue;
+        std::istringstream section(payload);
+        std::vector<AbstractNode*> nodes = readNodeTable(section, nullptr);
+        roots.insert(roots.end(), nodes.begin(), nodes.end());
+        found = true;
+      }
+
+      if (!found)
+        throw triton::exceptions::Ast("triton::ast::deserialize(): No node table found.");
+
+      return roots;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -0,0 +1,635 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cctype>
+#include <sstream>
+
+#include <api.hpp>
+#include <astSmtParser.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* A term being parsed */
+    struct ParseFrame {
+      //! The kinds of frame.
+      enum type_e {
+        APPLY,    /*!< (op args...) */
+        LET,      /*!< (let ((name term)...) body) */
+        MACRO,    /*!< the body of a define-fun applied */
+      };
+
+      //! The kind of frame.
+      enum type_e type;
+
+      //! APPLY: the operator and its indices `((_ extract 7 0) x)`.
+      std::string head;
+
+      //! APPLY: the indices of the operator.
+      std::vector<triton::uint32> indices;
+
+      //! APPLY: the operands parsed.
+      std::vector<AbstractNode*> args;
+
+      //! LET and MACRO: the names bound.
+      std::vector<std::pair<std::string, AbstractNode*>> bindings;
+
+      //! LET: true once the bindings are bound and the body is parsed.
+      bool body;
+
+      //! MACRO: the tokens and the position of the caller.
+      const std::vector<std::string>* source;
+
+      //! MACRO: the position after the application in the caller.
+      triton::usize position;
+
+      //! Constructor.
+      ParseFrame(enum type_e type, const std::string& head="")
+        : type(type), head(head), body(false), source(nullptr), position(0) {
+      }
+    };
+
+
+    /* The symbols bound by let and by the parameters of the macros. The level is the depth of macro applications. */
+    typedef std::unordered_map<std::string, std::vector<std::pair<AbstractNode*, triton::usize>>> ScopedSymbols;
+
+
+    static const std::string& nextToken(const std::vector<std::string>& tokens, triton::usize& index) {
+      if (index >= tokens.size())
+        throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Unexpected end of command.");
+      return tokens[index++];
+    }
+
+
+    static void expectToken(const std::vector<std::string>& tokens, triton::usize& index, const char* expected) {
+      if (nextToken(tokens, index) != expected)
+        throw triton::exceptions::AstTranslations(std::string("AstSmtParser::parse(): Expects '") + expected + "' at token " + std::to_string(index) + ".");
+    }
+
+
+    static bool isNumeral(const std::string& token) {
+      if (token.empty())
+        return false;
+      for (char c : token) {
+        if (!std::isdigit(static_cast<unsigned char>(c)))
+          return false;
+      }
+      return true;
+    }
+
+
+    static triton::uint32 parseIndex(const std::string& token) {
+      if (!isNumeral(token) || token.size() > 9)
+        throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid index " + token + ".");
+      return static_cast<triton::uint32>(std::stoul(token));
+    }
+
+
+    /* Parses the sort (_ BitVec n), the only one supported */
+    static triton::uint32 parseSort(const std::vector<std::string>& tokens, triton::usize& index) {
+      if (tokens.size() > index && tokens[index] == "Bool")
+        throw triton::exceptions::AstTranslations("AstSmtParser::parse(): The Bool variables are not supported.");
+
+      expectToken(tokens, index, "(");
+      expectToken(tokens, index, "_");
+      expectToken(tokens, index, "BitVec");
+      triton::uint32 size = parseIndex(nextToken(tokens, index));
+      expectToken(tokens, index, ")");
+
+      if (size == 0 || size > MAX_BITS_SUPPORTED)
+        throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid size of bitvector.");
+
+      return size;
+    }
+
+
+    /* Parses #b, #x and (_ bvN size) */
+    static AbstractNode* parseBitvector(const std::string& token) {
+      triton::uint512 value = 0;
+      triton::uint32 size = 0;
+
+      if (token.size() > 2 && token[1] == 'b') {
+        for (triton::usize index = 2; index < token.size(); index++) {
+          if (token[index] != '0' && token[index] != '1')
+            throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid binary constant " + token + ".");
+          value = (value << 1) | (token[index] - '0');
+        }
+        size = static_cast<triton::uint32>(token.size() - 2);
+      }
+
+      else if (token.size() > 2 && token[1] == 'x') {
+        for (triton::usize index = 2; index < token.size(); index++) {
+          if (!std::isxdigit(static_cast<unsigned char>(token[index])))
+            throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid hexadecimal constant " + token + ".");
+          value = (value << 4) | std::stoul(token.substr(index, 1), nullptr, 16);
+        }
+        size = static_cast<triton::uint32>((token.size() - 2) * 4);
+      }
+
+      if (size == 0 || size > MAX_BITS_SUPPORTED)
+        throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid constant " + token + ".");
+
+      return bv(value, size);
+    }
+
+
+    /* The operators without index, the associative ones are chained */
+    static bool getOperator(const std::string& name, enum kind_e& kind, bool& associative) {
+      static const std::unordered_map<std::string, std::pair<enum kind_e, bool>> operators = {
+        {"=",         {EQUAL_NODE,    false}},
+        {"and",       {LAND_NODE,     true}},
+        {"bvadd",     {BVADD_NODE,    true}},
+        {"bvand",     {BVAND_NODE,    true}},
+        {"bvashr",    {BVASHR_NODE,   false}},
+        {"bvlshr",    {BVLSHR_NODE,   false}},
+        {"bvmul",     {BVMUL_NODE,    true}},
+        {"bvnand",    {BVNAND_NODE,   false}},
+        {"bvneg",     {BVNEG_NODE,    false}},
+        {"bvnor",     {BVNOR_NODE,    false}},
+        {"bvnot",     {BVNOT_NODE,    false}},
+        {"bvor",      {BVOR_NODE,     true}},
+        {"bvsdiv",    {BVSDIV_NODE,   false}},
+        {"bvsge",     {BVSGE_NODE,    false}},
+        {"bvsgt",     {BVSGT_NODE,    false}},
+        {"bvshl",     {BVSHL_NODE,    false}},
+        {"bvsle",     {BVSLE_NODE,    false}},
+        {"bvslt",     {BVSLT_NODE,    false}},
+        {"bvsmod",    {BVSMOD_NODE,   false}},
+        {"bvsrem",    {BVSREM_NODE,   false}},
+        {"bvsub",     {BVSUB_NODE,    false}},
+        {"bvudiv",    {BVUDIV_NODE,   false}},
+        {"bvuge",     {BVUGE_NODE,    false}},
+        {"bvugt",     {BVUGT_NODE,    false}},
+        {"bvule",     {BVULE_NODE,    false}},
+        {"bvult",     {BVULT_NODE,    false}},
+        {"bvurem",    {BVUREM_NODE,   false}},
+        {"bvxnor",    {BVXNOR_NODE,   false}},
+        {"bvxor",     {BVXOR_NODE,    true}},
+        {"concat",    {CONCAT_NODE,   false}},
+        {"distinct",  {DISTINCT_NODE, false}},
+        {"ite",       {ITE_NODE,      false}},
+        {"not",       {LNOT_NODE,     false}},
+        {"or",        {LOR_NODE,      true}},
+      };
+
+      std::unordered_map<std::string, std::pair<enum kind_e, bool>>::const_iterator it = operators.find(name);
+      if (it == operators.end())
+        return false;
+
+      kind        = it->second.first;
+      associative = it->second.second;
+      return true;
+    }
+
+
+    /* The commands which do not change the nodes */
+    static bool isIgnoredCommand(const std::string& name) {
+      return (name == "check-sat" || name == "echo" || name == "exit" || name == "get-info" || name == "get-model" ||
+              name == "get-value" || name == "pop" || name == "push" || name == "set-info" || name == "set-logic" ||
+              name == "set-option");
+    }
+
+
+    AstSmtParser::AstSmtParser() {
+    }
+
+
+    AstSmtParser::AstSmtParser(const AstSmtParser& copy) {
+      this->copy(copy);
+    }
+
+
+    AstSmtParser::~AstSmtParser() {
+    }
+
+
+    void AstSmtParser::copy(const AstSmtParser& other) {
+      this->symbols = other.symbols;
+      this->macros  = other.macros;
+    }
+
+
+    /* Splits the next s-expression into tokens. A ';' starts a comment up to the end of the line. */
+    bool AstSmtParser::readCommand(std::istream& stream, std::vector<std::string>& tokens) const {
+      std::streambuf* buffer = stream.rdbuf();
+      triton::usize depth = 0;
+      std::string token;
+
+      tokens.clear();
+      while (true) {
+        int c = buffer->sbumpc();
+
+        if (c == std::char_traits<char>::eof() || std::isspace(c) || c == '(' || c == ')' || c == ';') {
+          if (!token.empty()) {
+            tokens.push_back(token);
+            token.clear();
+            if (depth == 0)
+              return true;
+          }
+        }
+
+        if (c == std::char_traits<char>::eof()) {
+          if (!tokens.empty())
+            throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Unexpected end of file.");
+          return false;
+        }
+
+        else if (c == ';') {
+          while (c != '\n' && c != std::char_traits<char>::eof())
+            c = buffer->sbumpc();
+        }
+
+        else if (c == '(') {
+          tokens.push_back("(");
+          depth++;
+        }
+
+        else if (c == ')') {
+          if (depth == 0)
+            throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Unexpected ')'.");
+          tokens.push_back(")");
+          if (--depth == 0)
+            return true;
+        }
+
+        /* |quoted symbol| and "string" are kept in one token */
+        else if (c == '|' || c == '"') {
+          int end = c;
+          token += static_cast<char>(c);
+          do {
+            c = buffer->sbumpc();
+            if (c == std::char_traits<char>::eof())
+              throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Unexpected end of file.");
+            token += static_cast<char>(c);
+          } while (c != end);
+
+          /* |x| and x are the same symbol */
+          if (end == '|' && token.find_first_of("() \t\r\n;") == std::string::npos)
+            token = token.substr(1, token.size() - 2);
+        }
+
+        else if (!std::isspace(c))
+          token += static_cast<char>(c);
+      }
+    }
+
+
+    AbstractNode* AstSmtParser::apply(const std::string& head, const std::vector<triton::uint32>& indices, const std::vector<AbstractNode*>& args) const {
+      enum kind_e kind = UNDEFINED_NODE;
+      bool associative = false;
+      AbstractNode* node = nullptr;
+
+      if (!indices.empty()) {
+        if (args.size() != 1)
+          throw triton::exceptions::AstTranslations("AstSmtParser::parse(): " + head + " takes one operand.");
+
+        if (head == "extract" && indices.size() == 2)
+          return extract(indices[0], indices[1], args[0]);
+        if (head == "rotate_left" && indices.size() == 1)
+          return bvrol(indices[0], args[0]);
+        if (head == "rotate_right" && indices.size() == 1)
+          return bvror(indices[0], args[0]);
+        if (head == "sign_extend" && indices.size() == 1)
+          return sx(indices[0], args[0]);
+        if (head == "zero_extend" && indices.size() == 1)
+          return zx(indices[0], args[0]);
+
+        throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Unsupported indexed operator " + head + ".");
+      }
+
+      if (head == "=>") {
+        if (args.size() != 2)
+          throw triton::exceptions::AstTranslations("AstSmtParser::parse(): => takes two operands.");
+        return lor(lnot(args[0]), args[1]);
+      }
+
+      if (!getOperator(head, kind, associative))
+        throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Unsupported operator " + head + ".");
+
+      if (associative && args.size() > 2) {
+        node = args[0];
+        for (triton::usize index = 1; index < args.size(); index++)
+          node = buildNode(kind, {node, args[index]});
+        return node;
+      }
+
+      /* (= a b c) is (and (= a b) (= b c)), (distinct a b c) holds if all the pairs are distinct */
+      if ((kind == EQUAL_NODE || kind == DISTINCT_NODE) && args.size() > 2) {
+        for (triton::usize i = 0; i + 1 < args.size(); i++) {
+          for (triton::usize j = i + 1; j < args.size(); j++) {
+            AbstractNode* pair = buildNode(kind, {args[i], args[j]});
+            node = (node == nullptr) ? pair : land(node, pair);
+            if (kind == EQUAL_NODE)
+              break;
+          }
+        }
+        return node;
+      }
+
+      return buildNode(kind, args);
+    }
+
+
+    AbstractNode* AstSmtParser::parseTerm(const std::vector<std::string>& tokens, triton::usize& index) {
+      const std::vector<std::string>* source = &tokens;
+      std::vector<ParseFrame> frames;
+      triton::usize position = index;
+      triton::usize level = 0;
+      ScopedSymbols bound;
+      AbstractNode* node = nullptr;
+
+      while (true) {
+        /* The end of an application */
+        if (!frames.empty() && frames.back().type == ParseFrame::APPLY && position < source->size() && (*source)[position] == ")") {
+          ParseFrame& frame = frames.back();
+          position++;
+
+          std::unordered_map<std::string, Macro>::const_iterator macro = this->macros.find(frame.head);
+          if (frame.indices.empty() && macro != this->macros.end()) {
+            if (frame.args.size() != macro->second.parameters.size())
+              throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid number of arguments for " + frame.head + ".");
+
+            /* The body is parsed with its parameters bound, it does not see the let of the caller */
+            frame.type      = ParseFrame::MACRO;
+            frame.source    = source;
+            frame.position  = position;
+            level++;
+            for (triton::usize i = 0; i < frame.args.size(); i++) {
+              frame.bindings.push_back(std::make_pair(macro->second.parameters[i], frame.args[i]));
+              bound[macro->second.parameters[i]].push_back(std::make_pair(frame.args[i], level));
+            }
+            source    = &macro->second.body;
+            position  = 0;
+            continue;
+          }
+
+          node = this->apply(frame.head, frame.indices, frame.args);
+          frames.pop_back();
+        }
+
+        else {
+          /* The bindings of a let, they are bound once they are all parsed */
+          if (!frames.empty() && frames.back().type == ParseFrame::LET && !frames.back().body) {
+            ParseFrame& frame = frames.back();
+            const std::string& token = nextToken(*source, position);
+            if (token == "(")
+              frame.head = nextToken(*source, position);
+            else if (token == ")") {
+              for (const std::pair<std::string, AbstractNode*>& binding : frame.bindings)
+                bound[binding.first].push_back(std::make_pair(binding.second, level));
+              frame.body = true;
+            }
+            else
+              throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid let binding.");
+          }
+
+          const std::string& token = nextToken(*source, position);
+
+          if (token == "(") {
+            const std::string& head = nextToken(*source, position);
+
+            if (head == "let") {
+              expectToken(*source, position, "(");
+              frames.push_back(ParseFrame(ParseFrame::LET));
+              continue;
+            }
+
+            else if (head == "_") {
+              const std::string& value = nextToken(*source, position);
+              const std::string& size  = nextToken(*source, position);
+              expectToken(*source, position, ")");
+              if (value.size() < 3 || value.compare(0, 2, "bv") != 0 || !isNumeral(value.substr(2)))
+                throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid constant (_ " + value + " " + size + ").");
+              triton::uint512 decimal = 0;
+              for (triton::usize index = 2; index < value.size(); index++)
+                decimal = decimal * 10 + (value[index] - '0');
+              node = bv(decimal, parseIndex(size));
+            }
+
+            else if (head == "(") {
+              expectToken(*source, position, "_");
+              frames.push_back(ParseFrame(ParseFrame::APPLY, nextToken(*source, position)));
+              for (const std::string* item = &nextToken(*source, position); *item != ")"; item = &nextToken(*source, position))
+                frames.back().indices.push_back(parseIndex(*item));
+              continue;
+            }
+
+            else if (head == ")")
+              throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Unexpected ().");
+
+            else {
+              frames.push_back(ParseFrame(ParseFrame::APPLY, head));
+              continue;
+            }
+          }
+
+          else if (token == ")")
+            throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Unexpected ')'.");
+
+          else if (token[0] == '#')
+            node = parseBitvector(token);
+
+          else if (token == "true")
+            node = equal(bvtrue(), bvtrue());
+
+          else if (token == "false")
+            node = equal(bvtrue(), bvfalse());
+
+          else {
+            ScopedSymbols::const_iterator local = bound.find(token);
+            std::unordered_map<std::string, AbstractNode*>::const_iterator global = this->symbols.find(token);
+
+            if (local != bound.end() && !local->second.empty() && local->second.back().second == level)
+              node = local->second.back().first;
+
+            else if (global != this->symbols.end())
+              node = global->second;
+
+            /* The names printed by the SMT representation */
+            else if (token.compare(0, 4, "ref!") == 0 && isNumeral(token.substr(4)) && triton::api.isSymbolicExpressionIdExists(std::stoull(token.substr(4))))
+              node = reference(std::stoull(token.substr(4)));
+
+            else if (triton::api.getSymbolicVariableFromName(token) != nullptr) {
+              node = variable(*triton::api.getSymbolicVariableFromName(token));
+              this->symbols[token] = node;
+            }
+
+            else
+              throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Unknown symbol " + token + ".");
+          }
+        }
+
+        /* A term is complete, it is given to the frame which waits for it */
+        while (true) {
+          if (frames.empty()) {
+            index = position;
+            return node;
+          }
+
+          ParseFrame& frame = frames.back();
+
+          if (frame.type == ParseFrame::APPLY) {
+            frame.args.push_back(node);
+            break;
+          }
+
+          if (frame.type == ParseFrame::LET && !frame.body) {
+            frame.bindings.push_back(std::make_pair(frame.head, node));
+            expectToken(*source, position, ")");
+            break;
+          }
+
+          if (frame.type == ParseFrame::LET)
+            expectToken(*source, position, ")");
+
+          else {
+            if (position != source->size())
+              throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid body of " + frame.head + ".");
+            source    = frame.source;
+            position  = frame.position;
+          }
+
+          for (const std::pair<std::string, AbstractNode*>& binding : frame.bindings)
+            bound[binding.first].pop_back();
+          if (frame.type == ParseFrame::MACRO)
+            level--;
+          frames.pop_back();
+        }
+      }
+    }
+
+
+    void AstSmtParser::declare(const std::string& name, triton::uint32 size) {
+      triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromName(name);
+
+      /* A name already declared is bound to the variable whose name or comment is the same */
+      if (symVar == nullptr) {
+        for (const std::pair<const triton::usize, triton::engines::symbolic::SymbolicVariable*>& item : triton::api.getSymbolicVariables()) {
+          if (item.second->getComment() == name && item.second->getSize() == size) {
+            symVar = item.second;
+            break;
+          }
+        }
+      }
+
+      if (symVar == nullptr)
+        symVar = triton::api.newSymbolicVariable(size, name);
+
+      if (symVar->getSize() != size)
+        throw triton::exceptions::AstTranslations("AstSmtParser::parse(): The size of " + name + " does not match its symbolic variable.");
+
+      this->symbols[name] = variable(*symVar);
+    }
+
+
+    AbstractNode* AstSmtParser::parseNext(std::istream& stream) {
+      std::vector<std::string> tokens;
+
+      while (this->readCommand(stream, tokens)) {
+        triton::usize index = 0;
+
+        /* A top-level term, as printed by the SMT representation */
+        if (tokens[0] != "(" || tokens.size() < 3 || tokens[1] == "(" || tokens[1] == "_" || tokens[1] == "let")
+          return this->parseTerm(tokens, index);
+
+        const std::string& command = tokens[1];
+        index = 2;
+
+        if (command == "assert") {
+          AbstractNode* node = this->parseTerm(tokens, index);
+          expectToken(tokens, index, ")");
+          return node;
+        }
+
+        else if (command == "declare-const") {
+          const std::string& name = nextToken(tokens, index);
+          this->declare(name, parseSort(tokens, index));
+        }
+
+        else if (command == "declare-fun") {
+          const std::string& name = nextToken(tokens, index);
+          expectToken(tokens, index, "(");
+          if (nextToken(tokens, index) != ")")
+            throw triton::exceptions::AstTranslations("AstSmtParser::parse(): The functions with arguments are not supported, only define-fun.");
+          this->declare(name, parseSort(tokens, index));
+        }
+
+        else if (command == "define-fun") {
+          const std::string& name = nextToken(tokens, index);
+          Macro macro;
+
+          expectToken(tokens, index, "(");
+          for (const std::string* token = &nextToken(tokens, index); *token != ")"; token = &nextToken(tokens, index)) {
+            if (*token != "(")
+              throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Invalid parameter of " + name + ".");
+            macro.parameters.push_back(nextToken(tokens, index));
+            if (index < tokens.size() && tokens[index] == "Bool")
+              index++;
+            else
+              parseSort(tokens, index);
+            expectToken(tokens, index, ")");
+          }
+
+          /* The sort of the result is checked by the node builders */
+          if (index < tokens.size() && tokens[index] == "Bool")
+            index++;
+          else
+            parseSort(tokens, index);
+
+          if (macro.parameters.empty()) {
+            this->symbols[name] = this->parseTerm(tokens, index);
+            expectToken(tokens, index, ")");
+          }
+          else {
+            if (tokens.size() < index + 2)
+              throw triton::exceptions::AstTranslations("AstSmtParser::parse(): Missing body of " + name + ".");
+            macro.body.assign(tokens.begin() + index, tokens.end() - 1);
+            this->macros[name] = macro;
+          }
+        }
+
+        else if (!isIgnoredCommand(command)) {
+          index = 0;
+          return this->parseTerm(tokens, index);
+        }
+      }
+
+      return nullptr;
+    }
+
+
+    std::vector<AbstractNode*> AstSmtParser::parse(std::istream& stream) {
+      std::vector<AbstractNode*> nodes;
+
+      for (AbstractNode* node = this->parseNext(stream); node != nullptr; node = this->parseNext(stream))
+        nodes.push_back(node);
+
+      return nodes;
+    }
+
+
+    std::vector<AbstractNode*> AstSmtParser::parse(const std::string& script) {
+      std::istringstream stream(script);
+      return this->parse(stream);
+    }
+
+
+    void AstSmtParser::operator=(const AstSmtParser& other) {
+      this->copy(other);
+    }
+
+
+    std::vector<AbstractNode*> parseSmtLib2(std::istream& stream) {
+      AstSmtParser parser;
+      return parser.parse(stream);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -5,6 +5,10 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <sstream>
+#include <unordered_set>
+
 #include <api.hpp>
 #include <astRepresentation.hpp>
 #include <exceptions.hpp>
@@ -15,6 +19,39 @@ namespace triton {
   namespace ast {
     namespace representations {
 
+      /* The slot of the streams which holds the frame of the node being printed */
+      static const int printFrameSlot = std::ios_base::xalloc();
+
+
+      /* The nodes which are not terms, they are printed outside of the let bindings */
+      static bool isCommand(AbstractNode* node) {
+        switch (node->getKind()) {
+          case ASSERT_NODE:
+          case BVDECL_NODE:
+          case COMPOUND_NODE:
+          case DECLARE_FUNCTION_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* The shared nodes which are bound by let. The atoms are cheaper to print than to bind, and the decimals are not terms. */
+      static bool isBindable(AbstractNode* node) {
+        switch (node->getKind()) {
+          case BV_NODE:
+          case DECIMAL_NODE:
+          case REFERENCE_NODE:
+          case STRING_NODE:
+          case VARIABLE_NODE:
+            return false;
+          default:
+            return !isCommand(node);
+        }
+      }
+
+
       AstRepresentation::AstRepresentation() {
         /* Set the default representation */
         this->mode = triton::ast::representations::SMT_REPRESENTATION;
@@ -23,6 +60,9 @@ namespace triton {
         this->representations[triton::ast::representations::SMT_REPRESENTATION] = new triton::ast::representations::AstSmtRepresentation();
         this->representations[triton::ast::representations::PYTHON_REPRESENTATION] = new triton::ast::representations::AstPythonRepresentation();
 
+        /* The DAG mode prints each node as the SMT mode */
+        this->representations[triton::ast::representations::SMT_DAG_REPRESENTATION] = this->representations[triton::ast::representations::SMT_REPRESENTATION];
+
         if (this->representations[triton::ast::representations::SMT_REPRESENTATION] == nullptr)
           throw triton::exceptions::AstRepresentation("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
 
@@ -49,8 +89,148 @@ namespace triton {
       }
 
 
+      void AstRepresentation::printNode(const std::ostream& stream, AbstractNode* node, PrintFrame& frame) {
+        std::ostringstream text;
+
+        text.copyfmt(stream);
+        text.pword(printFrameSlot) = &frame;
+        this->representations[this->mode]->print(text, node);
+        text.pword(printFrameSlot) = nullptr;
+
+        frame.text   = text.str();
+        frame.index  = 0;
+        frame.offset = 0;
+      }
+
+
+      std::ostream& AstRepresentation::printTree(std::ostream& stream, AbstractNode* node, const std::unordered_map<AbstractNode*, std::string>* bindings) {
+        std::vector<PrintFrame> stack;
+
+        stack.push_back(PrintFrame());
+        this->printNode(stream, node, stack.back());
+
+        while (!stack.empty()) {
+          PrintFrame& frame = stack.back();
+
+          /* All the childs are printed */
+          if (frame.index == frame.childs.size()) {
+            stream.write(frame.text.data() + frame.offset, frame.text.size() - frame.offset);
+            stack.pop_back();
+            continue;
+          }
+
+          triton::usize offset = frame.childs[frame.index].first;
+          AbstractNode* child  = frame.childs[frame.index].second;
+          stream.write(frame.text.data() + frame.offset, offset - frame.offset);
+          frame.offset = offset;
+          frame.index++;
+
+          /* A bound node is printed as its name */
+          if (bindings != nullptr) {
+            std::unordered_map<AbstractNode*, std::string>::const_iterator it = bindings->find(child);
+            if (it != bindings->end()) {
+              stream << it->second;
+              continue;
+            }
+          }
+
+          /* The terms of a command have their own bindings */
+          else if (this->mode == SMT_DAG_REPRESENTATION && !isCommand(child)) {
+            this->printDag(stream, child);
+            continue;
+          }
+
+          stack.push_back(PrintFrame());
+          this->printNode(stream, child, stack.back());
+        }
+
+        return stream;
+      }
+
+
+      std::ostream& AstRepresentation::printDag(std::ostream& stream, AbstractNode* node) {
+        std::unordered_map<AbstractNode*, std::string> bindings;
+        std::unordered_map<AbstractNode*, triton::usize> parents;
+        std::unordered_map<AbstractNode*, triton::usize> levels;
+        std::unordered_set<AbstractNode*> scoped;
+        std::vector<std::vector<AbstractNode*>> lets;
+
+        if (isCommand(node))
+          return this->printTree(stream, node, nullptr);
+
+        /* Counts the parents of each node inside this term, the childs come before their parents */
+        std::vector<AbstractNode*> nodes = triton::ast::nodesExtraction(node, false);
+        for (std::vector<AbstractNode*>::const_iterator it = nodes.begin(); it != nodes.end(); it++) {
+          std::vector<AbstractNode*>& childs = (*it)->getChilds();
+          for (triton::usize index = 0; index < childs.size(); index++)
+            parents[childs[index]]++;
+        }
+
+        /*
+         * The nodes below a let may use the names it binds, they cannot be bound above it.
+         * The parents come before their childs in the reverse order.
+         */
+        for (std::vector<AbstractNode*>::const_reverse_iterator it = nodes.rbegin(); it != nodes.rend(); it++) {
+          if ((*it)->getKind() == LET_NODE || scoped.find(*it) != scoped.end()) {
+            std::vector<AbstractNode*>& childs = (*it)->getChilds();
+            scoped.insert(childs.begin(), childs.end());
+          }
+        }
+
+        /*
+         * The level of a node is the number of nested bindings it depends on. A node bound at
+         * the level n only depends on the bindings of lower levels, thus each level is a single
+         * let whose bindings are independent.
+         */
+        for (std::vector<AbstractNode*>::const_iterator it = nodes.begin(); it != nodes.end(); it++) {
+          std::vector<AbstractNode*>& childs = (*it)->getChilds();
+          triton::usize level = 0;
+
+          for (triton::usize index = 0; index < childs.size(); index++)
+            level = std::max(level, levels[childs[index]]);
+
+          if (*it != node && parents[*it] > 1 && isBindable(*it) && scoped.find(*it) == scoped.end()) {
+            if (lets.size() <= level)
+              lets.resize(level + 1);
+            lets[level].push_back(*it);
+            bindings[*it] = "node!" + std::to_string(bindings.size());
+            level++;
+          }
+
+          levels[*it] = level;
+        }
+
+        for (triton::usize level = 0; level < lets.size(); level++) {
+          stream << "(let (";
+          for (triton::usize index = 0; index < lets[level].size(); index++) {
+            stream << (index ? " (" : "(") << bindings[lets[level][index]] << " ";
+            this->printTree(stream, lets[level][index], &bindings);
+            stream << ")";
+          }
+          stream << ") ";
+        }
+
+        this->printTree(stream, node, &bindings);
+
+        for (triton::usize level = 0; level < lets.size(); level++)
+          stream << ")";
+
+        return stream;
+      }
+
+
       std::ostream& AstRepresentation::print(std::ostream& stream, AbstractNode* node) {
-        return this->representations[this->mode]->print(stream, node);
+        /* A child printed by a representation is recorded in the frame of its parent */
+        PrintFrame* parent = reinterpret_cast<PrintFrame*>(stream.pword(printFrameSlot));
+        if (parent != nullptr) {
+          parent->childs.push_back(std::make_pair(static_cast<triton::usize>(stream.tellp()), node));
+          return stream;
+        }
+
+        if (this->mode == SMT_DAG_REPRESENTATION)
+          return this->printDag(stream, node);
+
+        return this->printTree(stream, node, nullptr);
       }
 
     };
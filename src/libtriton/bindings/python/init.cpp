@@ -38,6 +38,9 @@ namespace triton {
         /* Init python */
         Py_Initialize();
 
+        /* Init the GIL, some functions release it while processing */
+        PyEval_InitThreads();
+
         /* Create the triton module ================================================================== */
 
         triton::bindings::python::tritonModule = Py_InitModule("triton", tritonCallbacks);
@@ -7,7 +7,14 @@
 
 #ifdef TRITON_PYTHON_BINDINGS
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
 #include <api.hpp>
+#include <astBytecode.hpp>
+#include <astSerialization.hpp>
+#include <astSmtParser.hpp>
 #include <bitsVector.hpp>
 #include <cpuSize.hpp>
 #include <immediate.hpp>
@@ -16,7 +23,9 @@
 #include <pythonObjects.hpp>
 #include <pythonUtils.hpp>
 #include <pythonXFunctions.hpp>
+#include <traceRecorder.hpp>
 #include <register.hpp>
+#include <x86Specifications.hpp>
 
 
 
@@ -61,6 +70,7 @@ If you want to use the libTriton without Python bindings, recompile the project
 - \ref py_SolverModel_page
 - \ref py_SymbolicExpression_page
 - \ref py_SymbolicVariable_page
+- \ref py_View_page
 
 
 \subsection triton_py_api_modules Modules
@@ -73,6 +83,9 @@ If you want to use the libTriton without Python bindings, recompile the project
 - <b>addCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
 
+- **addSimplificationRule(string rule)**<br>
+Adds a native simplification rule written as `lhs -> rhs` with the SMT2-Lib syntax, e.g: `(bvxor a a) -> 0`. See \ref SMT_simplification_page.
+
 - <b>assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the memory access.
@@ -95,9 +108,23 @@ Builds a symbolic memory cell from a \ref py_MemoryAccess_page and returns a \re
 - **buildSymbolicRegister(\ref py_REG_page reg)**<br>
 Builds a symbolic register from a \ref py_REG_page and returns a \ref py_AstNode_page.
 
+- **clearBlockCache(void)**<br>
+Removes all pre-decoded basic blocks from the cache used by `processBlock()`.
+
 - **clearPathConstraints(void)**<br>
 Clears the logical conjunction vector of path constraints.
 
+- **clearSimplificationRules(void)**<br>
+Removes all native simplification rules.
+
+- **clearTranslationCache(void)**<br>
+Removes all decoded instructions and semantics templates from the translation cache used by `processing()` when the
+`OPTIMIZATION.SEMANTICS_TEMPLATES` optimization is enabled. The cache is bounded and flushed when it is full.
+
+- **compileAst(\ref py_AstNode_page node)**<br>
+Compiles an AST into a bytecode evaluated on native 64-bits integers and returns an \ref py_AstBytecode_page. References are followed.
+The nodes must not be wider than 64 bits.
+
 - **concretizeAllMemory(void)**<br>
 Concretizes all symbolic memory references.
 
@@ -122,6 +149,9 @@ Converts a symbolic memory expression to a symbolic variable. This function retu
 - **convertRegisterToSymbolicVariable(\ref py_REG_page reg, string comment="")**<br>
 Converts a symbolic register expression to a symbolic variable. This function returns the \ref py_SymbolicVariable_page created.
 
+- **countTaintedMemory(integer start, integer end)**<br>
+Returns the number of tainted bytes inside [start, end).
+
 - **cpuInvalidRegister(void)**<br>
  Returns the invalid CPU register id.
 
@@ -143,9 +173,19 @@ Returns the new symbolic register expression as \ref py_SymbolicExpression_page
 - <b>createSymbolicVolatileExpression (\ref py_Instruction_page inst, \ref py_AstNode_page node, string comment="")</b><br>
 Returns the new symbolic volatile expression as \ref py_SymbolicExpression_page and links this expression to the \ref py_Instruction_page.
 
+- **deserializeAst(bytes data)**<br>
+Rebuilds the nodes written by `serializeAst()`. Returns the \ref py_AstNode_page if `data` holds a single root, the list of
+roots otherwise. The symbolic variables used by the nodes must exist.
+
 - **disassembly(\ref py_Instruction_page inst)**<br>
 Disassembles the instruction and setup operands. You must define an architecture before.
 
+- **emulate(integer pc, integer maxCount=0, [integer,] stopAddrs=[])**<br>
+Emulates the code from `pc` in a native loop and returns the number of processed instructions. Instructions are fetched from the
+concrete memory. The emulation stops when the program counter reaches an address of `stopAddrs`, when `maxCount` instructions have
+been processed (0 means no limit), on an unmapped or unsupported instruction (e.g. `hlt`) or after a syscall if no \ref py_CALLBACK_page
+`SYSCALL` callback has returned True. The program counter always holds the address where the emulation has stopped.
+
 - **enableSymbolicEngine(bool flag)**<br>
 Enables or disables the symbolic execution engine.
 
@@ -158,9 +198,23 @@ Enabled, Triton will use the simplification passes of z3 before to call its reco
 - **enableTaintEngine(bool flag)**<br>
 Enables or disables the taint engine.
 
+- **enableTaintLabels(bool flag)**<br>
+Enables or disables the labeled taint mode. Disabling it drops all labels.
+
+- **enableTaintProvenance(bool flag, [integer capacity])**<br>
+Enables or disables the taint provenance recorder. Enabling it starts a new graph which keeps at most `capacity` events
+(65536 by default), the oldest events are dropped first.
+
 - **evaluateAstViaZ3(\ref py_AstNode_page node)**<br>
 Evaluates an AST via Z3 and returns the symbolic value as integer.
 
+- **foldAst(\ref py_AstNode_page node)**<br>
+Folds the constants and the algebraic identities of the whole AST and returns the folded \ref py_AstNode_page.
+Folded nodes are kept, thus the nodes shared with the other folded ASTs are not folded again.
+
+- **foldSymbolicExpressions(void)**<br>
+Folds the symbolic expressions created since the last call and returns the number of expressions changed.
+
 - **getAllRegisters(void)**<br>
 Returns the list of all registers. Each item of this list is a \ref py_Register_page.
 
@@ -177,7 +231,11 @@ Returns the partial AST as \ref py_AstNode_page from a symbolic expression id.
 Returns the AST representation mode as \ref py_AST_REPRESENTATION_page.
 
 - **getConcreteMemoryAreaValue(integer baseAddr, integer size)**<br>
-Returns the concrete value of a memory area.
+Returns the concrete value of a memory area as bytes. The area is copied once, straight into the returned object.
+
+- **getConcreteMemoryAreaValue(integer baseAddr, integer size, buffer)**<br>
+Copies the concrete value of a memory area into a writable buffer (`bytearray`, `memoryview`, ...) of at least `size` bytes.
+No object is allocated, thus a buffer may be reused to dump memory.
 
 - **getConcreteMemoryValue(intger addr)**<br>
 Returns the concrete value of a memory cell.
@@ -194,12 +252,28 @@ Returns the full AST of a root node as \ref py_AstNode_page.
 - **getFullAstFromId(integer symExprId)**<br>
 Returns the full AST as \ref py_AstNode_page from a symbolic expression id.
 
+- **getMemoryTaintLabels(intger addr)**<br>
+Returns the list of labels (integers) which reach the address.
+
+- **getMemoryTaintLabels(\ref py_MemoryAccess_page mem)**<br>
+Returns the list of labels (integers) which reach the memory.
+
+- **getMemoryTaintProvenance(intger addr)**<br>
+Walks back the taint provenance graph from the address. Returns a list of events, the closest first. Each event is a dictionary
+of {'id': integer, 'address': integer instruction address, 'location': \ref py_MemoryAccess_page or \ref py_Register_page, 'parents': list of event ids}.
+
+- **getMemoryTaintProvenance(\ref py_MemoryAccess_page mem)**<br>
+Walks back the taint provenance graph from the memory. Returns a list of events as `getMemoryTaintProvenance(addr)`.
+
 - **getModel(\ref py_AstNode_page node)**<br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
 
 - **getModels(\ref py_AstNode_page node)**<br>
 Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
 
+- **getNextTaintedMemory(integer addr)**<br>
+Returns the address of the first tainted byte at or after `addr` as integer, or None if there is no such byte.
+
 - **getParentRegisters(void)**<br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
 
@@ -209,14 +283,23 @@ Returns the logical conjunction vector of path constraints as list of \ref py_Pa
 - **getPathConstraintsAst(void)**<br>
 Returns the logical conjunction AST of path constraints as \ref py_AstNode_page.
 
+- **getRegisterTaintLabels(\ref py_REG_page reg)**<br>
+Returns the list of labels (integers) which reach the register.
+
+- **getRegisterTaintProvenance(\ref py_REG_page reg)**<br>
+Walks back the taint provenance graph from the register. Returns a list of events as `getMemoryTaintProvenance(addr)`.
+
+- **getSimplificationRules(void)**<br>
+Returns the list of native simplification rules as strings.
+
 - **getSymbolicExpressionFromId(intger symExprId)**<br>
 Returns the symbolic expression as \ref py_SymbolicExpression_page corresponding to the id.
 
 - **getSymbolicExpressions(void)**<br>
-Returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+Returns all symbolic expressions as a lazy \ref py_View_page of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
 - **getSymbolicMemory(void)**<br>
-Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}.
+Returns the map of symbolic memory as a lazy \ref py_View_page of {integer address : \ref py_SymbolicExpression_page expr}.
 
 - **getSymbolicMemoryId(intger addr)**<br>
 Returns the symbolic expression id as integer corresponding to the memory address.
@@ -243,10 +326,14 @@ Returns the symbolic variable as \ref py_SymbolicVariable_page corresponding to
 Returns the symbolic variable as \ref py_SymbolicVariable_page corresponding to the symbolic variable name.
 
 - **getSymbolicVariables(void)**<br>
-Returns all symbolic variable as a dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
+Returns all symbolic variable as a lazy \ref py_View_page of {integer SymVarId : \ref py_SymbolicVariable_page var}.
 
 - **getTaintedMemory(void)**<br>
-Returns the list of all tainted addresses as integer.
+Returns the sorted tainted addresses as a lazy \ref py_View_page. Use `list(getTaintedMemory())` to keep a snapshot.
+
+- **getTaintedMemoryRanges([integer start, integer end])**<br>
+Returns the runs of tainted bytes as a list of (integer start, integer length) tuples. If `start` and `end` are defined,
+only the runs inside [start, end) are returned. This is far cheaper than getTaintedMemory() on large tainted areas.
 
 - **getTaintedRegisters(void)**<br>
 Returns the list of all tainted registers as \ref py_Register_page.
@@ -284,14 +371,58 @@ Returns true if Triton can use the simplification passes of z3.
 - **isTaintEngineEnabled(void)**<br>
 Returns true if the taint engine is enabled.
 
+- **isTaintLabelsEnabled(void)**<br>
+Returns true if the labeled taint mode is enabled.
+
+- **isTaintProvenanceEnabled(void)**<br>
+Returns true if the taint provenance recorder is enabled.
+
+- **loadBinary(\ref py_Elf_page binary)**<br>
+Maps all memory areas of the binary (see `getMemoryMapping()`) into the concrete memory.
+
+- **loadSimplificationPlugin(string path)**<br>
+Loads a shared object which exports the `tritonSimplificationPlugin()` function to register native simplification rules.
+
+- **loadSimplificationRules(string path)**<br>
+Loads native simplification rules from a file, one rule per line. Returns the number of rules loaded.
+
+- **loadSymbolicState(string path)**<br>
+Replaces the symbolic state (variables, expressions, register and memory references, path constraints) by the one
+written by `saveSymbolicState()`. The architecture must be the same.
+
 - **newSymbolicExpression(\ref py_AstNode_page node, string comment="")**<br>
 Returns a new symbolic expression as \ref py_SymbolicExpression_page. Note that if there are simplification passes recorded, simplification will be applied.
 
 - **newSymbolicVariable(intger varSize, string comment="")**<br>
 Returns a new symbolic variable as \ref py_SymbolicVariable_page.
 
+- **parseSmtLib2(string script)**<br>
+Parses an SMT-LIB2 script without Z3 and returns the list of \ref py_AstNode_page of its `assert` and of its top-level terms. The
+symbols of `declare-fun` are bound to the symbolic variables of the same name or comment, new ones are created otherwise. Only the
+bitvector fragment is supported. Note that an assertion must be wrapped by `assert_()` to be given to `getModel()`.
+
+- **processBlock(bytes code, integer addr)**<br>
+Processes a basic block starting at `addr` and updates engines according to the semantics of each instruction. The block ends after the
+first control flow instruction or at the end of `code`. The disassembly of the block is cached by address, so processing the same block
+again only builds semantics. If \ref py_OPTIMIZATION_page `DEAD_FLAGS_ELIMINATION` is enabled, flag expressions overwritten inside the block
+before being read are removed. Returns the list of processed \ref py_Instruction_page. You must define an architecture before.
+
+- **processBatch(list records)**<br>
+Processes a batch of instructions given as a list of `(integer address, bytes opcodes)` tuples. The instructions are processed in C++ with
+the GIL released, Python callbacks take it back when they are called. The processing stops at the first unsupported instruction. Returns a
+summary as dictionary: `count` is the number of processed instructions, `next` is the concrete program counter after the last one, `tainted`
+and `symbolized` are the addresses of the tainted and symbolized instructions. Note that the engines are not thread safe, other threads must
+not use them during the batch. You must define an architecture before.
+
+- **processCodeRegion(bytes code, integer base, integer entry, integer maxCount=0)**<br>
+Processes the code mapped at `base` from `entry`, following the concrete program counter, with the GIL released as `processBatch()`.
+The processing stops when the program counter leaves the region, after `maxCount` instructions (0 means no limit) or at the first unsupported
+instruction. Returns the same summary as `processBatch()`, `next` is then the address where the processing has stopped. You must define an
+architecture before.
+
 - **processing(\ref py_Instruction_page inst)**<br>
 Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
+The decoding of an instruction is cached per address, so an instruction executed several times is disassembled only once.
 
 - <b>removeAllCallbacks(void)</b><br>
 Removes all recorded callbacks.
@@ -299,9 +430,34 @@ Removes all recorded callbacks.
 - <b>removeCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Removes a recorded callback.
 
+- **replayTrace(string path, integer maxCount=0)**<br>
+Replays an execution trace written by `writeTrace()` or by the pintool, and returns the number of processed instructions. Before each
+instruction, the registers and the memory values of its record are set into the concrete state. The replay runs in a native loop without
+the GIL and stops at the end of the trace, after `maxCount` instructions (0 means no limit) or after an unsupported instruction. The
+architecture of the trace is defined if there is none.
+
 - **resetEngines(void)**<br>
 Resets everything.
 
+- **runAst(\ref py_AstBytecode_page compiled, dict values)**<br>
+Evaluates a compiled AST and returns its value as integer. `values` is a dictionary `{symVarId : integer}`, the missing
+variables take their concrete value. `values` may also be a list of integers ordered as `AstBytecode.getVariables()`,
+which is the fastest way.
+
+- **runAstBatch(\ref py_AstBytecode_page compiled, dict values)**<br>
+Evaluates a compiled AST on many inputs and returns the list of its values. `values` is a dictionary `{symVarId : list of integers}`
+holding one column per variable, the missing variables take their concrete value in every input. `values` may also be a list of
+columns ordered as `AstBytecode.getVariables()`. All the columns must have the same length. The inputs are evaluated together with
+the SIMD instructions of the host when possible.
+
+- **saveSymbolicState(string path)**<br>
+Writes the symbolic state into a compact binary file, which may be loaded later or on another machine by `loadSymbolicState()`
+to resume an analysis. The ASTs are written as a node table, a node shared by several expressions is written once.
+
+- **serializeAst(\ref py_AstNode_page node)**<br>
+Returns the DAG of `node` as a compact binary string. `node` may also be a list of \ref py_AstNode_page, their shared nodes are
+written once.
+
 - **setArchitecture(\ref py_ARCH_page arch)**<br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -312,8 +468,9 @@ Sets the AST representation mode.
 Sets the concrete value of a memory area. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
-- **setConcreteMemoryAreaValue(integer baseAddr, bytes opcodes)**<br>
-Sets the concrete value of a memory area. Note that by setting a concrete value will probably imply a desynchronization with
+- **setConcreteMemoryAreaValue(integer baseAddr, buffer values)**<br>
+Sets the concrete value of a memory area from `bytes` or any object with the buffer protocol (`bytearray`, `memoryview`, ...). The buffer
+is read in place, without intermediate copy. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
 - **setConcreteMemoryValue(integer addr, integer value)**<br>
@@ -334,6 +491,9 @@ Sets the targeted memory as tainted or not.
 - **setTaintRegister(\ref py_REG_page reg, bool flag)**<br>
 Sets the targeted register as tainted or not.
 
+- **setupStack(integer base)**<br>
+Sets up a stack by pointing the stack pointer and the base pointer to `base`. Both registers are concretized.
+
 - **simplify(\ref py_AstNode_page node, bool z3=False)**<br>
 Calls all simplification callbacks recorded and returns the simplified node as \ref py_AstNode_page. If the `z3` flag is
 set to True, Triton will use z3 to simplify the given `node` before to call recorded callbacks.
@@ -356,14 +516,14 @@ Taints `regDst` from `MemSrc` with an assignment - `regDst` is tainted if `memSr
 - <b>taintAssignmentRegisterRegister(\ref py_REG_page regDst, \ref py_REG_page regSrc)</b><br>
 Taints `regDst` from `regSrc` with an assignment - `regDst` is tainted if `regSrc` is tainted, otherwise `regDst` is untained.
 
-- **taintMemory(intger addr)**<br>
-Taints an address.
+- **taintMemory(intger addr, integer label=None)**<br>
+Taints an address. If the labeled taint mode is enabled, `label` is added to the labels of the address.
 
-- **taintMemory(\ref py_MemoryAccess_page mem)**<br>
-Taints a memory.
+- **taintMemory(\ref py_MemoryAccess_page mem, integer label=None)**<br>
+Taints a memory. If the labeled taint mode is enabled, `label` is added to the labels of the memory.
 
-- **taintRegister(\ref py_REG_page reg)**<br>
-Taints a register.
+- **taintRegister(\ref py_REG_page reg, integer label=None)**<br>
+Taints a register. If the labeled taint mode is enabled, `label` is added to the labels of the register.
 
 - <b>taintUnionMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an union - `memDst` does not changes.
@@ -395,6 +555,11 @@ Untaints a memory.
 - **untaintRegister(\ref py_REG_page reg)**<br>
 Untaints a register.
 
+- **writeTrace(string path, [(integer addr, bytes opcodes, [\ref py_Register_page,] [\ref py_MemoryAccess_page,]),])**<br>
+Writes an execution trace, one record per executed instruction: its address, its opcodes, the registers to set before it and the memory
+values it reads. Every given register is written, even if its value is the one given before. The records are delta-encoded and
+compressed by blocks. Returns the number of recorded instructions. The file is removed if a record is invalid.
+
 
 \subsection triton_py_api_namespaces Namespaces
 
@@ -485,6 +650,10 @@ instrumentation.
 - **isSnapshotEnabled(void)**<br>
 Returns true if the snapshot engine is enabled.
 
+- **recordTrace(string path)**<br>
+Records the analyzed instructions into an execution trace, with the register and memory values given to Triton. The trace may be
+replayed offline by `replayTrace()`, without Pin. The last block is written at the end of the execution.
+
 - **restoreSnapshot(void)**<br>
 Restores the last snpahost taken. Check the `tracer::pintool::Snapshot::takeSnapshot()` function. Note that this function
 have to execute a new context registers, so `RIP` will be modified and your callback stopped
@@ -731,6 +900,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_addSimplificationRule(PyObject* self, PyObject* rule) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addSimplificationRule(): Architecture is not defined.");
+
+        if (!PyString_Check(rule))
+          return PyErr_Format(PyExc_TypeError, "addSimplificationRule(): Expects a string as argument.");
+
+        try {
+          triton::api.addSimplificationRule(PyString_AsString(rule));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -865,6 +1054,16 @@ namespace triton {
       }
 
 
+      static PyObject* triton_clearBlockCache(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearBlockCache(): Architecture is not defined.");
+        triton::api.clearBlockCache();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_clearPathConstraints(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -875,6 +1074,43 @@ namespace triton {
       }
 
 
+      static PyObject* triton_clearSimplificationRules(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearSimplificationRules(): Architecture is not defined.");
+        triton::api.clearSimplificationRules();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearTranslationCache(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearTranslationCache(): Architecture is not defined.");
+        triton::api.clearTranslationCache();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_compileAst(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "compileAst(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "compileAst(): Expects a AstNode as argument.");
+
+        try {
+          return PyAstBytecode(triton::ast::compile(PyAstNode_AsAstNode(node)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1044,6 +1280,32 @@ namespace triton {
       }
 
 
+      static PyObject* triton_countTaintedMemory(PyObject* self, PyObject* args) {
+        PyObject* start = nullptr;
+        PyObject* end   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &start, &end);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "countTaintedMemory(): Architecture is not defined.");
+
+        if (start == nullptr || (!PyLong_Check(start) && !PyInt_Check(start)))
+          return PyErr_Format(PyExc_TypeError, "countTaintedMemory(): Expects an integer as first argument.");
+
+        if (end == nullptr || (!PyLong_Check(end) && !PyInt_Check(end)))
+          return PyErr_Format(PyExc_TypeError, "countTaintedMemory(): Expects an integer as second argument.");
+
+        try {
+          return PyLong_FromUsize(triton::api.countTaintedMemory(PyLong_AsUint64(start), PyLong_AsUint64(end)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_cpuInvalidRegister(PyObject* self, PyObject* noarg) {
         return PyLong_FromUint32(triton::api.cpuInvalidRegister());
       }
@@ -1222,6 +1484,33 @@ namespace triton {
       }
 
 
+      static PyObject* triton_deserializeAst(PyObject* self, PyObject* data) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "deserializeAst(): Architecture is not defined.");
+
+        if (!PyString_Check(data))
+          return PyErr_Format(PyExc_TypeError, "deserializeAst(): Expects bytes as argument.");
+
+        try {
+          std::istringstream stream(std::string(PyString_AsString(data), PyString_Size(data)));
+          std::vector<triton::ast::AbstractNode*> roots = triton::ast::deserialize(stream);
+
+          if (roots.size() == 1)
+            return PyAstNode(roots[0]);
+
+          PyObject* ret = xPyList_New(roots.size());
+          for (triton::usize index = 0; index < roots.size(); index++)
+            PyList_SetItem(ret, index, PyAstNode(roots[index]));
+
+          return ret;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_disassembly(PyObject* self, PyObject* inst) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1242,6 +1531,47 @@ namespace triton {
       }
 
 
+      static PyObject* triton_emulate(PyObject* self, PyObject* args) {
+        std::set<triton::uint64> stopAddrs;
+        PyObject* pc        = nullptr;
+        PyObject* maxCount  = nullptr;
+        PyObject* stops     = nullptr;
+        triton::usize count = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &pc, &maxCount, &stops);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "emulate(): Architecture is not defined.");
+
+        if (pc == nullptr || (!PyLong_Check(pc) && !PyInt_Check(pc)))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects an integer as first argument.");
+
+        if (maxCount != nullptr && !PyLong_Check(maxCount) && !PyInt_Check(maxCount))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects an integer as second argument.");
+
+        if (stops != nullptr && !PyList_Check(stops))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects a list of integers as third argument.");
+
+        try {
+          if (stops != nullptr) {
+            for (Py_ssize_t i = 0; i < PyList_Size(stops); i++) {
+              PyObject* item = PyList_GetItem(stops, i);
+              if (!PyLong_Check(item) && !PyInt_Check(item))
+                return PyErr_Format(PyExc_TypeError, "emulate(): Each item of the list must be an integer.");
+              stopAddrs.insert(PyLong_AsUint64(item));
+            }
+          }
+          count = triton::api.emulate(PyLong_AsUint64(pc), (maxCount != nullptr ? PyLong_AsUsize(maxCount) : 0), stopAddrs);
+          return PyLong_FromUsize(count);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_enableSymbolicEngine(PyObject* self, PyObject* flag) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1331,6 +1661,58 @@ namespace triton {
       }
 
 
+      static PyObject* triton_enableTaintLabels(PyObject* self, PyObject* flag) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableTaintLabels(): Architecture is not defined.");
+
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableTaintLabels(): Expects an boolean as argument.");
+
+        try {
+          triton::api.enableTaintLabels(PyLong_AsBool(flag));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_enableTaintProvenance(PyObject* self, PyObject* args) {
+        PyObject* flag     = nullptr;
+        PyObject* capacity = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &flag, &capacity);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableTaintProvenance(): Architecture is not defined.");
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableTaintProvenance(): Expects a boolean as first argument.");
+
+        if (capacity != nullptr && (!PyLong_Check(capacity) && !PyInt_Check(capacity)))
+          return PyErr_Format(PyExc_TypeError, "enableTaintProvenance(): Expects an integer as second argument.");
+
+        try {
+          if (capacity == nullptr)
+            triton::api.enableTaintProvenance(PyLong_AsBool(flag));
+          else
+            triton::api.enableTaintProvenance(PyLong_AsBool(flag), PyLong_AsUsize(capacity));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_evaluateAstViaZ3(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1354,6 +1736,37 @@ namespace triton {
       }
 
 
+      static PyObject* triton_foldAst(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "foldAst(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "foldAst(): Expects a AstNode as argument.");
+
+        try {
+          return PyAstNode(triton::api.foldAst(PyAstNode_AsAstNode(node)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_foldSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "foldSymbolicExpressions(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::api.foldSymbolicExpressions());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getAllRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         std::set<triton::arch::Register*> reg;
@@ -1432,36 +1845,64 @@ namespace triton {
 
 
       static PyObject* triton_getConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
-        std::vector<triton::uint8> vv;
-        triton::uint8*  area = nullptr;
-        PyObject*       ret  = nullptr;
-        PyObject*       addr = nullptr;
-        PyObject*       size = nullptr;
+        PyObject* ret    = nullptr;
+        PyObject* addr   = nullptr;
+        PyObject* size   = nullptr;
+        PyObject* buffer = nullptr;
+        Py_buffer view;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &addr, &size);
+        PyArg_ParseTuple(args, "|OOO", &addr, &size, &buffer);
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "getConcreteMemoryAreaValue(): Architecture is not defined.");
 
-        try {
-          vv   = triton::api.getConcreteMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size));
-          area = new triton::uint8[vv.size()];
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryAreaValue(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryAreaValue(): Expects an integer as second argument.");
 
-          for (triton::usize index = 0; index < vv.size(); index++)
-            area[index] = vv[index];
+        /* The area is copied straight into the bytes object */
+        if (buffer == nullptr) {
+          ret = PyBytes_FromStringAndSize(nullptr, PyLong_AsUsize(size));
+          if (ret == nullptr)
+            return nullptr;
+
+          try {
+            triton::api.getConcreteMemoryAreaValue(PyLong_AsUint64(addr), reinterpret_cast<triton::uint8*>(PyBytes_AsString(ret)), PyLong_AsUsize(size));
+          }
+          catch (const std::exception& e) {
+            Py_DECREF(ret);
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
 
-          ret = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(area), vv.size());
-          delete[] area;
           return ret;
+        }
+
+        /* The area is copied into the buffer of the caller */
+        if (!PyObject_CheckBuffer(buffer) || PyObject_GetBuffer(buffer, &view, PyBUF_WRITABLE) != 0) {
+          PyErr_Clear();
+          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryAreaValue(): Expects a writable buffer as third argument.");
+        }
+
+        if (static_cast<triton::usize>(view.len) < PyLong_AsUsize(size)) {
+          PyBuffer_Release(&view);
+          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryAreaValue(): The buffer is smaller than the size.");
+        }
 
+        try {
+          triton::api.getConcreteMemoryAreaValue(PyLong_AsUint64(addr), reinterpret_cast<triton::uint8*>(view.buf), PyLong_AsUsize(size));
         }
         catch (const std::exception& e) {
+          PyBuffer_Release(&view);
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        PyBuffer_Release(&view);
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
@@ -1535,24 +1976,26 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getModel(PyObject* self, PyObject* node) {
+      static PyObject* triton_getMemoryTaintLabels(PyObject* self, PyObject* mem) {
+        std::vector<triton::uint32> labels;
         PyObject* ret = nullptr;
-        std::map<triton::uint32, triton::engines::solver::SolverModel> model;
-        std::map<triton::uint32, triton::engines::solver::SolverModel>::iterator it;
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getModel(): Architecture is not defined.");
+          return PyErr_Format(PyExc_TypeError, "getMemoryTaintLabels(): Architecture is not defined.");
 
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as argument.");
+        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
+          return PyErr_Format(PyExc_TypeError, "getMemoryTaintLabels(): Expects an integer or a Memory as argument.");
 
         try {
-          ret = xPyDict_New();
-          model = triton::api.getModel(PyAstNode_AsAstNode(node));
-          for (it = model.begin(); it != model.end(); it++) {
-            PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
-          }
+          if (PyLong_Check(mem) || PyInt_Check(mem))
+            labels = triton::api.getMemoryTaintLabels(PyLong_AsUint64(mem));
+          else
+            labels = triton::api.getMemoryTaintLabels(*PyMemoryAccess_AsMemoryAccess(mem));
+
+          ret = xPyList_New(labels.size());
+          for (triton::usize index = 0; index < labels.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint32(labels[index]));
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1562,32 +2005,106 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getModels(PyObject* self, PyObject* args) {
-        PyObject* ret   = nullptr;
-        PyObject* node  = nullptr;
-        PyObject* limit = nullptr;
-        triton::uint32 index = 0;
-        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
-        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>>::iterator it;
+      /* Returns a list of dictionaries from provenance events */
+      static PyObject* PyList_FromTaintEvents(const std::vector<triton::engines::taint::TaintEvent>& events) {
+        PyObject* ret = xPyList_New(events.size());
 
-        /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &node, &limit);
+        for (triton::usize index = 0; index < events.size(); index++) {
+          const triton::engines::taint::TaintEvent& event = events[index];
+          PyObject* dict    = xPyDict_New();
+          PyObject* parents = xPyList_New(event.numberOfParents);
 
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getModels(): Architecture is not defined.");
+          for (triton::uint32 parent = 0; parent < event.numberOfParents; parent++)
+            PyList_SetItem(parents, parent, PyLong_FromUint64(event.parents[parent]));
 
-        if (node == nullptr || !PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "getModels(): Expects a AstNode as first argument.");
+          PyDict_SetItem(dict, PyString_FromString("id"),      PyLong_FromUint64(event.id));
+          PyDict_SetItem(dict, PyString_FromString("address"), PyLong_FromUint64(event.address));
+          PyDict_SetItem(dict, PyString_FromString("parents"), parents);
 
-        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
-          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as second argument.");
+          if (event.location.isRegister)
+            PyDict_SetItem(dict, PyString_FromString("location"), PyRegister(triton::arch::Register(static_cast<triton::uint32>(event.location.value))));
+          else
+            PyDict_SetItem(dict, PyString_FromString("location"), PyMemoryAccess(triton::arch::MemoryAccess(event.location.value, event.location.size)));
 
-        try {
-          models = triton::api.getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit));
-          ret = xPyList_New(models.size());
-          for (it = models.begin(); it != models.end(); it++) {
-            PyObject* mdict = xPyDict_New();
+          PyList_SetItem(ret, index, dict);
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getMemoryTaintProvenance(PyObject* self, PyObject* mem) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getMemoryTaintProvenance(): Architecture is not defined.");
+
+        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
+          return PyErr_Format(PyExc_TypeError, "getMemoryTaintProvenance(): Expects an integer or a Memory as argument.");
+
+        try {
+          if (PyLong_Check(mem) || PyInt_Check(mem))
+            return PyList_FromTaintEvents(triton::api.getMemoryTaintProvenance(PyLong_AsUint64(mem)));
+          return PyList_FromTaintEvents(triton::api.getMemoryTaintProvenance(*PyMemoryAccess_AsMemoryAccess(mem)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getModel(PyObject* self, PyObject* node) {
+        PyObject* ret = nullptr;
+        std::map<triton::uint32, triton::engines::solver::SolverModel> model;
+        std::map<triton::uint32, triton::engines::solver::SolverModel>::iterator it;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModel(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as argument.");
+
+        try {
+          ret = xPyDict_New();
+          model = triton::api.getModel(PyAstNode_AsAstNode(node));
+          for (it = model.begin(); it != model.end(); it++) {
+            PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getModels(PyObject* self, PyObject* args) {
+        PyObject* ret   = nullptr;
+        PyObject* node  = nullptr;
+        PyObject* limit = nullptr;
+        triton::uint32 index = 0;
+        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
+        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>>::iterator it;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &limit);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModels(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects a AstNode as first argument.");
+
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as second argument.");
+
+        try {
+          models = triton::api.getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit));
+          ret = xPyList_New(models.size());
+          for (it = models.begin(); it != models.end(); it++) {
+            PyObject* mdict = xPyDict_New();
             std::map<triton::uint32, triton::engines::solver::SolverModel> model = *it;
             for (auto it2 = model.begin(); it2 != model.end(); it2++) {
               PyDict_SetItem(mdict, PyLong_FromUint32(it2->first), PySolverModel(it2->second));
@@ -1604,6 +2121,29 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getNextTaintedMemory(PyObject* self, PyObject* addr) {
+        triton::uint64 found = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getNextTaintedMemory(): Architecture is not defined.");
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "getNextTaintedMemory(): Expects an integer as argument.");
+
+        try {
+          if (triton::api.getNextTaintedMemory(PyLong_AsUint64(addr), found))
+            return PyLong_FromUint64(found);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_getParentRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         std::set<triton::arch::Register*> reg;
@@ -1665,36 +2205,61 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
+      static PyObject* triton_getRegisterTaintLabels(PyObject* self, PyObject* reg) {
+        std::vector<triton::uint32> labels;
+        PyObject* ret = nullptr;
+
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Architecture is not defined.");
+          return PyErr_Format(PyExc_TypeError, "getRegisterTaintLabels(): Architecture is not defined.");
 
-        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getRegisterTaintLabels(): Expects a REG as argument.");
 
         try {
-          return PySymbolicExpression(triton::api.getSymbolicExpressionFromId(PyLong_AsUsize(symExprId)));
+          labels = triton::api.getRegisterTaintLabels(*PyRegister_AsRegister(reg));
+          ret = xPyList_New(labels.size());
+          for (triton::usize index = 0; index < labels.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint32(labels[index]));
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        return ret;
       }
 
 
-      static PyObject* triton_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
+      static PyObject* triton_getRegisterTaintProvenance(PyObject* self, PyObject* reg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getRegisterTaintProvenance(): Architecture is not defined.");
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getRegisterTaintProvenance(): Expects a REG as argument.");
+
+        try {
+          return PyList_FromTaintEvents(triton::api.getRegisterTaintProvenance(*PyRegister_AsRegister(reg)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSimplificationRules(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
-        const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& expressions = triton::api.getSymbolicExpressions();
-        std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>::const_iterator it;
+        std::vector<std::string> rules;
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicExpressions(): Architecture is not defined.");
+          return PyErr_Format(PyExc_TypeError, "getSimplificationRules(): Architecture is not defined.");
 
         try {
-          ret = xPyDict_New();
-          for (it = expressions.begin(); it != expressions.end(); it++)
-            PyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+          rules = triton::api.getSimplificationRules();
+          ret = xPyList_New(rules.size());
+          for (triton::usize index = 0; index < rules.size(); index++)
+            PyList_SetItem(ret, index, PyString_FromString(rules[index].c_str()));
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1704,26 +2269,38 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicMemory(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> regs = triton::api.getSymbolicMemory();
-        std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*>::iterator it;
-
+      static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Architecture is not defined.");
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Architecture is not defined.");
+
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
 
         try {
-          ret = xPyDict_New();
-          for (it = regs.begin(); it != regs.end(); it++) {
-            PyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
-          }
+          return PySymbolicExpression(triton::api.getSymbolicExpressionFromId(PyLong_AsUsize(symExprId)));
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+      }
 
-        return ret;
+
+      static PyObject* triton_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressions(): Architecture is not defined.");
+
+        return PyView(triton::bindings::python::VIEW_SYMBOLIC_EXPRESSIONS);
+      }
+
+
+      static PyObject* triton_getSymbolicMemory(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Architecture is not defined.");
+
+        return PyView(triton::bindings::python::VIEW_SYMBOLIC_MEMORY);
       }
 
 
@@ -1857,44 +2434,54 @@ namespace triton {
 
 
       static PyObject* triton_getSymbolicVariables(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        const std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>& variables = triton::api.getSymbolicVariables();
-        std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>::const_iterator it;
-
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicVariables(): Architecture is not defined.");
-
-        try {
-          ret = xPyDict_New();
-          for (it = variables.begin(); it != variables.end(); it++)
-            PyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicVariable(it->second));
-        }
-        catch (const std::exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
-        }
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariables(): Architecture is not defined.");
 
-        return ret;
+        return PyView(triton::bindings::python::VIEW_SYMBOLIC_VARIABLES);
       }
 
 
       static PyObject* triton_getTaintedMemory(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
-        std::set<triton::uint64> addresses;
-        std::set<triton::uint64>::iterator it;
-
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "getTaintedMemory(): Architecture is not defined.");
 
+        return PyView(triton::bindings::python::VIEW_TAINTED_MEMORY);
+      }
+
+
+      static PyObject* triton_getTaintedMemoryRanges(PyObject* self, PyObject* args) {
+        std::vector<std::pair<triton::uint64, triton::usize>> ranges;
+        PyObject* start = nullptr;
+        PyObject* end   = nullptr;
+        PyObject* ret   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &start, &end);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemoryRanges(): Architecture is not defined.");
+
+        if (start != nullptr && (!PyLong_Check(start) && !PyInt_Check(start)))
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemoryRanges(): Expects an integer as first argument.");
+
+        if ((start != nullptr && end == nullptr) || (end != nullptr && (!PyLong_Check(end) && !PyInt_Check(end))))
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemoryRanges(): Expects an integer as second argument.");
+
         try {
-          addresses = triton::api.getTaintedMemory();
-          size = addresses.size();
-          ret = xPyList_New(size);
-          for (it = addresses.begin(); it != addresses.end(); it++) {
-            PyList_SetItem(ret, index, PyLong_FromUint64(*it));
-            index++;
+          if (start == nullptr)
+            ranges = triton::api.getTaintedMemoryRanges();
+          else
+            ranges = triton::api.getTaintedMemoryRanges(PyLong_AsUint64(start), PyLong_AsUint64(end));
+
+          ret = xPyList_New(ranges.size());
+          for (triton::usize index = 0; index < ranges.size(); index++) {
+            PyObject* item = xPyTuple_New(2);
+            PyTuple_SetItem(item, 0, PyLong_FromUint64(ranges[index].first));
+            PyTuple_SetItem(item, 1, PyLong_FromUsize(ranges[index].second));
+            PyList_SetItem(ret, index, item);
           }
         }
         catch (const std::exception& e) {
@@ -2091,6 +2678,106 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isTaintLabelsEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isTaintLabelsEnabled(): Architecture is not defined.");
+
+        if (triton::api.isTaintLabelsEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isTaintProvenanceEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isTaintProvenanceEnabled(): Architecture is not defined.");
+
+        if (triton::api.isTaintProvenanceEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_loadBinary(PyObject* self, PyObject* binary) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadBinary(): Architecture is not defined.");
+
+        if (!PyElf_Check(binary))
+          return PyErr_Format(PyExc_TypeError, "loadBinary(): Expects an Elf as argument.");
+
+        try {
+          triton::api.loadBinary(*PyElf_AsElf(binary));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_loadSimplificationPlugin(PyObject* self, PyObject* path) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadSimplificationPlugin(): Architecture is not defined.");
+
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "loadSimplificationPlugin(): Expects a string as argument.");
+
+        try {
+          triton::api.loadSimplificationPlugin(PyString_AsString(path));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_loadSimplificationRules(PyObject* self, PyObject* path) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadSimplificationRules(): Architecture is not defined.");
+
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "loadSimplificationRules(): Expects a string as argument.");
+
+        try {
+          return PyLong_FromUsize(triton::api.loadSimplificationRules(PyString_AsString(path)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_loadSymbolicState(PyObject* self, PyObject* path) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadSymbolicState(): Architecture is not defined.");
+
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "loadSymbolicState(): Expects a string as argument.");
+
+        try {
+          std::ifstream stream(PyString_AsString(path), std::ios::in | std::ios::binary);
+          if (!stream.is_open())
+            return PyErr_Format(PyExc_TypeError, "loadSymbolicState(): Cannot open the file.");
+          triton::api.loadSymbolicState(stream);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_newSymbolicExpression(PyObject* self, PyObject* args) {
         PyObject* node          = nullptr;
         PyObject* comment       = nullptr;
@@ -2151,6 +2838,218 @@ namespace triton {
       }
 
 
+      static PyObject* triton_parseSmtLib2(PyObject* self, PyObject* script) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "parseSmtLib2(): Architecture is not defined.");
+
+        if (!PyString_Check(script))
+          return PyErr_Format(PyExc_TypeError, "parseSmtLib2(): Expects a string as argument.");
+
+        try {
+          std::istringstream stream(std::string(PyString_AsString(script), PyString_Size(script)));
+          std::vector<triton::ast::AbstractNode*> nodes = triton::ast::parseSmtLib2(stream);
+
+          PyObject* ret = xPyList_New(nodes.size());
+          for (triton::usize index = 0; index < nodes.size(); index++)
+            PyList_SetItem(ret, index, PyAstNode(nodes[index]));
+
+          return ret;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_processBlock(PyObject* self, PyObject* args) {
+        std::vector<triton::arch::Instruction> block;
+        PyObject* code  = nullptr;
+        PyObject* addr  = nullptr;
+        PyObject* ret   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &code, &addr);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Architecture is not defined.");
+
+        if (code == nullptr || !PyBytes_Check(code))
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Expects bytes as first argument.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Expects an integer as second argument.");
+
+        try {
+          block = triton::api.processBlock(reinterpret_cast<triton::uint8*>(PyBytes_AsString(code)), static_cast<triton::usize>(PyBytes_Size(code)), PyLong_AsUint64(addr));
+          ret   = xPyList_New(block.size());
+
+          for (triton::usize index = 0; index < block.size(); index++)
+            PyList_SetItem(ret, index, PyInstruction(block[index]));
+
+          return ret;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      /* Returns the summary of a batch processing */
+      static PyObject* PyDict_FromBatchSummary(triton::usize count, triton::uint64 next, const std::vector<triton::uint64>& tainted, const std::vector<triton::uint64>& symbolized) {
+        PyObject* ret            = xPyDict_New();
+        PyObject* taintedList    = xPyList_New(tainted.size());
+        PyObject* symbolizedList = xPyList_New(symbolized.size());
+
+        for (triton::usize index = 0; index < tainted.size(); index++)
+          PyList_SetItem(taintedList, index, PyLong_FromUint64(tainted[index]));
+
+        for (triton::usize index = 0; index < symbolized.size(); index++)
+          PyList_SetItem(symbolizedList, index, PyLong_FromUint64(symbolized[index]));
+
+        PyDict_SetItem(ret, PyString_FromString("count"),      PyLong_FromUsize(count));
+        PyDict_SetItem(ret, PyString_FromString("next"),       PyLong_FromUint64(next));
+        PyDict_SetItem(ret, PyString_FromString("tainted"),    taintedList);
+        PyDict_SetItem(ret, PyString_FromString("symbolized"), symbolizedList);
+
+        return ret;
+      }
+
+
+      static PyObject* triton_processBatch(PyObject* self, PyObject* records) {
+        std::vector<triton::arch::Instruction> insts;
+        std::vector<triton::uint64> tainted;
+        std::vector<triton::uint64> symbolized;
+        triton::usize count = 0;
+        triton::uint64 next = 0;
+        std::string error;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "processBatch(): Architecture is not defined.");
+
+        if (!PyList_Check(records))
+          return PyErr_Format(PyExc_TypeError, "processBatch(): Expects a list as argument.");
+
+        /* Decode the records while the GIL is held */
+        insts.resize(PyList_Size(records));
+        for (triton::usize index = 0; index < insts.size(); index++) {
+          PyObject* record = PyList_GetItem(records, index);
+
+          if (!PyTuple_Check(record) || PyTuple_Size(record) != 2)
+            return PyErr_Format(PyExc_TypeError, "processBatch(): Expects a list of (integer address, bytes opcodes) tuples.");
+
+          PyObject* addr    = PyTuple_GetItem(record, 0);
+          PyObject* opcodes = PyTuple_GetItem(record, 1);
+
+          if ((!PyLong_Check(addr) && !PyInt_Check(addr)) || !PyBytes_Check(opcodes))
+            return PyErr_Format(PyExc_TypeError, "processBatch(): Expects a list of (integer address, bytes opcodes) tuples.");
+
+          insts[index].setAddress(PyLong_AsUint64(addr));
+          insts[index].setOpcodes(reinterpret_cast<triton::uint8*>(PyBytes_AsString(opcodes)), static_cast<triton::uint32>(PyBytes_Size(opcodes)));
+        }
+
+        /* Python callbacks take the GIL back when they are called */
+        Py_BEGIN_ALLOW_THREADS
+        try {
+          for (count = 0; count < insts.size(); count++) {
+            if (!triton::api.processing(insts[count]))
+              break;
+            if (insts[count].isTainted())
+              tainted.push_back(insts[count].getAddress());
+            if (insts[count].isSymbolized())
+              symbolized.push_back(insts[count].getAddress());
+          }
+          if (count)
+            next = triton::api.getConcreteRegisterValue(TRITON_X86_REG_PC, false).convert_to<triton::uint64>();
+        }
+        catch (const std::exception& e) {
+          error = e.what();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (!error.empty())
+          return PyErr_Format(PyExc_TypeError, "%s", error.c_str());
+
+        return PyDict_FromBatchSummary(count, next, tainted, symbolized);
+      }
+
+
+      static PyObject* triton_processCodeRegion(PyObject* self, PyObject* args) {
+        std::vector<triton::uint64> tainted;
+        std::vector<triton::uint64> symbolized;
+        std::vector<triton::uint8> area;
+        triton::usize maxCount  = 0;
+        triton::usize count     = 0;
+        triton::uint64 base     = 0;
+        triton::uint64 pc       = 0;
+        PyObject* code          = nullptr;
+        PyObject* baseAddr      = nullptr;
+        PyObject* entry         = nullptr;
+        PyObject* max           = nullptr;
+        std::string error;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOO", &code, &baseAddr, &entry, &max);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "processCodeRegion(): Architecture is not defined.");
+
+        if (code == nullptr || !PyBytes_Check(code))
+          return PyErr_Format(PyExc_TypeError, "processCodeRegion(): Expects bytes as first argument.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "processCodeRegion(): Expects an integer as second argument.");
+
+        if (entry == nullptr || (!PyLong_Check(entry) && !PyInt_Check(entry)))
+          return PyErr_Format(PyExc_TypeError, "processCodeRegion(): Expects an integer as third argument.");
+
+        if (max != nullptr && !PyLong_Check(max) && !PyInt_Check(max))
+          return PyErr_Format(PyExc_TypeError, "processCodeRegion(): Expects an integer as fourth argument.");
+
+        /* The region is copied, thus the bytes object is not touched without the GIL */
+        area.assign(reinterpret_cast<triton::uint8*>(PyBytes_AsString(code)), reinterpret_cast<triton::uint8*>(PyBytes_AsString(code)) + PyBytes_Size(code));
+        base = PyLong_AsUint64(baseAddr);
+        pc   = PyLong_AsUint64(entry);
+        if (max != nullptr)
+          maxCount = PyLong_AsUsize(max);
+
+        /* Python callbacks take the GIL back when they are called */
+        Py_BEGIN_ALLOW_THREADS
+        try {
+          while ((maxCount == 0 || count < maxCount) && pc >= base && pc - base < area.size()) {
+            triton::arch::Instruction inst;
+
+            /* Fetch enough bytes for the longest x86 instruction (15 bytes) */
+            inst.setOpcodes(&area[pc - base], static_cast<triton::uint32>(std::min<triton::usize>(DQWORD_SIZE, area.size() - (pc - base))));
+            inst.setAddress(pc);
+
+            if (!triton::api.processing(inst))
+              break;
+            count++;
+
+            if (inst.isTainted())
+              tainted.push_back(pc);
+            if (inst.isSymbolized())
+              symbolized.push_back(pc);
+
+            pc = triton::api.getConcreteRegisterValue(TRITON_X86_REG_PC, false).convert_to<triton::uint64>();
+          }
+        }
+        catch (const std::exception& e) {
+          error = e.what();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (!error.empty())
+          return PyErr_Format(PyExc_TypeError, "%s", error.c_str());
+
+        return PyDict_FromBatchSummary(count, pc, tainted, symbolized);
+      }
+
+
       static PyObject* triton_processing(PyObject* self, PyObject* inst) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2212,6 +3111,43 @@ namespace triton {
       }
 
 
+      static PyObject* triton_replayTrace(PyObject* self, PyObject* args) {
+        PyObject* path      = nullptr;
+        PyObject* maxCount  = nullptr;
+        triton::usize count = 0;
+        std::string error;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &path, &maxCount);
+
+        if (path == nullptr || !PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "replayTrace(): Expects a string as first argument.");
+
+        if (maxCount != nullptr && !PyLong_Check(maxCount) && !PyInt_Check(maxCount))
+          return PyErr_Format(PyExc_TypeError, "replayTrace(): Expects an integer as second argument.");
+
+        std::ifstream stream(PyString_AsString(path), std::ios::in | std::ios::binary);
+        if (!stream.is_open())
+          return PyErr_Format(PyExc_TypeError, "replayTrace(): Cannot open the file.");
+
+        /* Python callbacks take the GIL back when they are called */
+        triton::usize max = (maxCount != nullptr ? PyLong_AsUsize(maxCount) : 0);
+        Py_BEGIN_ALLOW_THREADS
+        try {
+          count = triton::api.replayTrace(stream, max);
+        }
+        catch (const std::exception& e) {
+          error = e.what();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (!error.empty())
+          return PyErr_Format(PyExc_TypeError, "%s", error.c_str());
+
+        return PyLong_FromUsize(count);
+      }
+
+
       static PyObject* triton_resetEngines(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2229,6 +3165,200 @@ namespace triton {
       }
 
 
+      static PyObject* triton_runAst(PyObject* self, PyObject* args) {
+        PyObject* compiled  = nullptr;
+        PyObject* values    = nullptr;
+        PyObject* key       = nullptr;
+        PyObject* value     = nullptr;
+        Py_ssize_t pos      = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &compiled, &values);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "runAst(): Architecture is not defined.");
+
+        if (compiled == nullptr || !PyAstBytecode_Check(compiled))
+          return PyErr_Format(PyExc_TypeError, "runAst(): Expects an AstBytecode as first argument.");
+
+        if (values == nullptr || (!PyDict_Check(values) && !PyList_Check(values)))
+          return PyErr_Format(PyExc_TypeError, "runAst(): Expects a dict or a list as second argument.");
+
+        try {
+          /* Values ordered by slot */
+          if (PyList_Check(values)) {
+            std::vector<triton::uint64> slots;
+            for (Py_ssize_t i = 0; i < PyList_Size(values); i++) {
+              PyObject* item = PyList_GetItem(values, i);
+              if (!PyLong_Check(item) && !PyInt_Check(item))
+                return PyErr_Format(PyExc_TypeError, "runAst(): Each item of the list must be an integer.");
+              slots.push_back(PyLong_AsUint64(item));
+            }
+            return PyLong_FromUint64(triton::ast::run(*PyAstBytecode_AsAstBytecode(compiled), slots));
+          }
+
+          /* Values indexed by variable id */
+          std::map<triton::usize, triton::uint64> vars;
+          while (PyDict_Next(values, &pos, &key, &value)) {
+            if ((!PyLong_Check(key) && !PyInt_Check(key)) || (!PyLong_Check(value) && !PyInt_Check(value)))
+              return PyErr_Format(PyExc_TypeError, "runAst(): Expects a dict of integers {symVarId : value}.");
+            vars[PyLong_AsUsize(key)] = PyLong_AsUint64(value);
+          }
+          return PyLong_FromUint64(triton::ast::run(*PyAstBytecode_AsAstBytecode(compiled), vars));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_runAstBatch(PyObject* self, PyObject* args) {
+        PyObject* compiled  = nullptr;
+        PyObject* values    = nullptr;
+        PyObject* key       = nullptr;
+        PyObject* value     = nullptr;
+        PyObject* ret       = nullptr;
+        Py_ssize_t pos      = 0;
+        Py_ssize_t count    = -1;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &compiled, &values);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "runAstBatch(): Architecture is not defined.");
+
+        if (compiled == nullptr || !PyAstBytecode_Check(compiled))
+          return PyErr_Format(PyExc_TypeError, "runAstBatch(): Expects an AstBytecode as first argument.");
+
+        if (values == nullptr || (!PyDict_Check(values) && !PyList_Check(values)))
+          return PyErr_Format(PyExc_TypeError, "runAstBatch(): Expects a dict or a list as second argument.");
+
+        try {
+          triton::ast::AstBytecode* bytecode              = PyAstBytecode_AsAstBytecode(compiled);
+          const std::vector<triton::usize>& variables     = bytecode->getVariables();
+          std::vector<PyObject*> columns(variables.size(), nullptr);
+
+          /* Columns ordered by slot */
+          if (PyList_Check(values)) {
+            if (PyList_Size(values) != static_cast<Py_ssize_t>(variables.size()))
+              return PyErr_Format(PyExc_TypeError, "runAstBatch(): Expects a column for each variable.");
+            for (triton::usize slot = 0; slot < variables.size(); slot++)
+              columns[slot] = PyList_GetItem(values, slot);
+          }
+
+          /* Columns indexed by variable id */
+          else {
+            while (PyDict_Next(values, &pos, &key, &value)) {
+              if (!PyLong_Check(key) && !PyInt_Check(key))
+                return PyErr_Format(PyExc_TypeError, "runAstBatch(): Expects a dict {symVarId : list of integers}.");
+              std::vector<triton::usize>::const_iterator it = std::find(variables.begin(), variables.end(), PyLong_AsUsize(key));
+              if (it != variables.end())
+                columns[it - variables.begin()] = value;
+            }
+          }
+
+          for (triton::usize slot = 0; slot < columns.size(); slot++) {
+            if (columns[slot] == nullptr)
+              continue;
+            if (!PyList_Check(columns[slot]))
+              return PyErr_Format(PyExc_TypeError, "runAstBatch(): Each column must be a list of integers.");
+            if (count != -1 && PyList_Size(columns[slot]) != count)
+              return PyErr_Format(PyExc_TypeError, "runAstBatch(): All the columns must have the same length.");
+            count = PyList_Size(columns[slot]);
+          }
+
+          if (count == -1)
+            return PyErr_Format(PyExc_TypeError, "runAstBatch(): Expects at least one column.");
+
+          /* Column-major values, the missing variables take their concrete value */
+          std::vector<triton::uint64> array(variables.size() * count);
+          for (triton::usize slot = 0; slot < columns.size(); slot++) {
+            triton::uint64* column = array.data() + slot * count;
+            if (columns[slot] == nullptr) {
+              std::fill(column, column + count, (triton::api.getSymbolicVariableFromId(variables[slot])->getConcreteValue() & 0xffffffffffffffffULL).convert_to<triton::uint64>());
+              continue;
+            }
+            for (Py_ssize_t i = 0; i < count; i++) {
+              PyObject* item = PyList_GetItem(columns[slot], i);
+              if (!PyLong_Check(item) && !PyInt_Check(item))
+                return PyErr_Format(PyExc_TypeError, "runAstBatch(): Each item of a column must be an integer.");
+              column[i] = PyLong_AsUint64(item);
+            }
+          }
+
+          std::vector<triton::uint64> results = triton::ast::runBatch(*bytecode, array, count);
+
+          ret = xPyList_New(results.size());
+          for (triton::usize i = 0; i < results.size(); i++)
+            PyList_SetItem(ret, i, PyLong_FromUint64(results[i]));
+
+          return ret;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_saveSymbolicState(PyObject* self, PyObject* path) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "saveSymbolicState(): Architecture is not defined.");
+
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "saveSymbolicState(): Expects a string as argument.");
+
+        try {
+          std::ofstream stream(PyString_AsString(path), std::ios::out | std::ios::binary | std::ios::trunc);
+          if (!stream.is_open())
+            return PyErr_Format(PyExc_TypeError, "saveSymbolicState(): Cannot open the file.");
+          triton::api.saveSymbolicState(stream);
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_serializeAst(PyObject* self, PyObject* nodes) {
+        std::vector<triton::ast::AbstractNode*> roots;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "serializeAst(): Architecture is not defined.");
+
+        if (PyAstNode_Check(nodes))
+          roots.push_back(PyAstNode_AsAstNode(nodes));
+
+        else if (PyList_Check(nodes)) {
+          for (Py_ssize_t index = 0; index < PyList_Size(nodes); index++) {
+            PyObject* item = PyList_GetItem(nodes, index);
+            if (!PyAstNode_Check(item))
+              return PyErr_Format(PyExc_TypeError, "serializeAst(): Each item of the list must be a AstNode.");
+            roots.push_back(PyAstNode_AsAstNode(item));
+          }
+        }
+
+        else
+          return PyErr_Format(PyExc_TypeError, "serializeAst(): Expects a AstNode or a list of AstNode as argument.");
+
+        try {
+          std::ostringstream stream;
+          triton::ast::serialize(stream, roots);
+          std::string data = stream.str();
+          return PyString_FromStringAndSize(data.data(), data.size());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2277,7 +3407,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects an integer as first argument.");
 
         if (values == nullptr)
-          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a bytes array as second argument.");
+          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a buffer as second argument.");
 
         // Python object: List
         if (PyList_Check(values)) {
@@ -2311,22 +3441,29 @@ namespace triton {
           }
         }
 
-        // Python object: ByteArray
-        else if (PyByteArray_Check(values)) {
-          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyByteArray_AsString(values));
-          triton::usize  size = static_cast<triton::usize>(PyByteArray_Size(values));
+        // Python object: Any other buffer (bytearray, memoryview, ...), read in place
+        else if (PyObject_CheckBuffer(values)) {
+          Py_buffer view;
+
+          if (PyObject_GetBuffer(values, &view, PyBUF_SIMPLE) != 0) {
+            PyErr_Clear();
+            return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a contiguous buffer as second argument.");
+          }
 
           try {
-            triton::api.setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), area, size);
+            triton::api.setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), reinterpret_cast<triton::uint8*>(view.buf), static_cast<triton::usize>(view.len));
           }
           catch (const std::exception& e) {
+            PyBuffer_Release(&view);
             return PyErr_Format(PyExc_TypeError, "%s", e.what());
           }
+
+          PyBuffer_Release(&view);
         }
 
         // Invalid Python object
         else
-          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a bytes array as second argument.");
+          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a buffer as second argument.");
 
         Py_INCREF(Py_None);
         return Py_None;
@@ -2461,6 +3598,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_setupStack(PyObject* self, PyObject* base) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setupStack(): Architecture is not defined.");
+
+        if (!PyLong_Check(base) && !PyInt_Check(base))
+          return PyErr_Format(PyExc_TypeError, "setupStack(): Expects an integer as argument.");
+
+        try {
+          triton::api.setupStack(PyLong_AsUint64(base));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_simplify(PyObject* self, PyObject* args) {
         PyObject* node        = nullptr;
         PyObject* z3Flag      = nullptr;
@@ -2640,19 +3797,32 @@ namespace triton {
       }
 
 
-      static PyObject* triton_taintMemory(PyObject* self, PyObject* mem) {
+      static PyObject* triton_taintMemory(PyObject* self, PyObject* args) {
+        PyObject* mem   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &mem, &label);
+
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintMemory(): Architecture is not defined.");
 
+        if (label != nullptr && !PyLong_Check(label) && !PyInt_Check(label))
+          return PyErr_Format(PyExc_TypeError, "taintMemory(): Expects an integer as second argument.");
+
         try {
-          if (PyMemoryAccess_Check(mem)) {
-            if (triton::api.taintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+          if (mem != nullptr && PyMemoryAccess_Check(mem)) {
+            if (label != nullptr && triton::api.taintMemory(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+            if (label == nullptr && triton::api.taintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
               Py_RETURN_TRUE;
           }
 
-          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (triton::api.taintMemory(PyLong_AsUint64(mem)) == true)
+          else if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
+            if (label != nullptr && triton::api.taintMemory(PyLong_AsUint64(mem), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+            if (label == nullptr && triton::api.taintMemory(PyLong_AsUint64(mem)) == true)
               Py_RETURN_TRUE;
           }
 
@@ -2666,15 +3836,29 @@ namespace triton {
       }
 
 
-      static PyObject* triton_taintRegister(PyObject* self, PyObject* reg) {
+      static PyObject* triton_taintRegister(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &reg, &label);
+
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintRegister(): Architecture is not defined.");
 
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "taintRegister(): Expects a Memory as argument.");
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "taintRegister(): Expects a REG as first argument.");
+
+        if (label != nullptr && !PyLong_Check(label) && !PyInt_Check(label))
+          return PyErr_Format(PyExc_TypeError, "taintRegister(): Expects an integer as second argument.");
 
         try {
+          if (label != nullptr) {
+            if (triton::api.taintRegister(*PyRegister_AsRegister(reg), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+            Py_RETURN_FALSE;
+          }
           if (triton::api.taintRegister(*PyRegister_AsRegister(reg)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
@@ -2914,6 +4098,96 @@ namespace triton {
       }
 
 
+      /* Adds a (address, opcodes, [Register], [MemoryAccess]) record to a trace. Returns false with a python error on an invalid record */
+      static bool addTraceRecord(triton::format::trace::TraceRecorder& recorder, PyObject* record) {
+        PyObject* addr    = nullptr;
+        PyObject* opcodes = nullptr;
+        PyObject* regs    = nullptr;
+        PyObject* mems    = nullptr;
+
+        if (!PyTuple_Check(record) || PyTuple_Size(record) < 2 || PyTuple_Size(record) > 4) {
+          PyErr_Format(PyExc_TypeError, "writeTrace(): Expects a list of (integer address, bytes opcodes, [Register], [MemoryAccess]) tuples.");
+          return false;
+        }
+
+        addr    = PyTuple_GetItem(record, 0);
+        opcodes = PyTuple_GetItem(record, 1);
+        regs    = (PyTuple_Size(record) > 2 ? PyTuple_GetItem(record, 2) : nullptr);
+        mems    = (PyTuple_Size(record) > 3 ? PyTuple_GetItem(record, 3) : nullptr);
+
+        if ((!PyLong_Check(addr) && !PyInt_Check(addr)) || !PyBytes_Check(opcodes) || (regs != nullptr && !PyList_Check(regs)) || (mems != nullptr && !PyList_Check(mems))) {
+          PyErr_Format(PyExc_TypeError, "writeTrace(): Expects a list of (integer address, bytes opcodes, [Register], [MemoryAccess]) tuples.");
+          return false;
+        }
+
+        for (Py_ssize_t i = 0; regs != nullptr && i < PyList_Size(regs); i++) {
+          if (!PyRegister_Check(PyList_GetItem(regs, i))) {
+            PyErr_Format(PyExc_TypeError, "writeTrace(): Each item of the registers list must be a Register.");
+            return false;
+          }
+          recorder.addRegisterValue(*PyRegister_AsRegister(PyList_GetItem(regs, i)));
+        }
+
+        for (Py_ssize_t i = 0; mems != nullptr && i < PyList_Size(mems); i++) {
+          if (!PyMemoryAccess_Check(PyList_GetItem(mems, i))) {
+            PyErr_Format(PyExc_TypeError, "writeTrace(): Each item of the memory list must be a MemoryAccess.");
+            return false;
+          }
+          recorder.addMemoryValue(*PyMemoryAccess_AsMemoryAccess(PyList_GetItem(mems, i)));
+        }
+
+        recorder.addInstruction(PyLong_AsUint64(addr), reinterpret_cast<triton::uint8*>(PyBytes_AsString(opcodes)), static_cast<triton::uint32>(PyBytes_Size(opcodes)));
+        return true;
+      }
+
+
+      static PyObject* triton_writeTrace(PyObject* self, PyObject* args) {
+        PyObject* path    = nullptr;
+        PyObject* records = nullptr;
+        PyObject* ret     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &path, &records);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "writeTrace(): Architecture is not defined.");
+
+        if (path == nullptr || !PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "writeTrace(): Expects a string as first argument.");
+
+        if (records == nullptr || !PyList_Check(records))
+          return PyErr_Format(PyExc_TypeError, "writeTrace(): Expects a list as second argument.");
+
+        std::string filename(PyString_AsString(path));
+
+        try {
+          std::ofstream stream(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+          if (!stream.is_open())
+            return PyErr_Format(PyExc_TypeError, "writeTrace(): Cannot open the file.");
+
+          triton::format::trace::TraceRecorder recorder(stream, triton::api.getArchitecture());
+          Py_ssize_t index = 0;
+          while (index < PyList_Size(records) && addTraceRecord(recorder, PyList_GetItem(records, index)))
+            index++;
+
+          if (index == PyList_Size(records)) {
+            recorder.close();
+            ret = PyLong_FromUsize(recorder.getNumberOfInstructions());
+          }
+        }
+        catch (const std::exception& e) {
+          PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        /* The records written before an error would be read as a whole trace */
+        if (ret == nullptr)
+          std::remove(filename.c_str());
+
+        return ret;
+      }
+
+
       PyMethodDef tritonCallbacks[] = {
         {"Bitvector",                           (PyCFunction)triton_Bitvector,                              METH_VARARGS,       ""},
         {"Elf",                                 (PyCFunction)triton_Elf,                                    METH_O,             ""},
@@ -2922,13 +4196,18 @@ namespace triton {
         {"MemoryAccess",                        (PyCFunction)triton_MemoryAccess,                           METH_VARARGS,       ""},
         {"Register",                            (PyCFunction)triton_Register,                               METH_VARARGS,       ""},
         {"addCallback",                         (PyCFunction)triton_addCallback,                            METH_VARARGS,       ""},
+        {"addSimplificationRule",               (PyCFunction)triton_addSimplificationRule,                  METH_O,             ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)triton_assignSymbolicExpressionToMemory,       METH_VARARGS,       ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)triton_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
         {"buildSemantics",                      (PyCFunction)triton_buildSemantics,                         METH_O,             ""},
         {"buildSymbolicImmediate",              (PyCFunction)triton_buildSymbolicImmediate,                 METH_O,             ""},
         {"buildSymbolicMemory",                 (PyCFunction)triton_buildSymbolicMemory,                    METH_O,             ""},
         {"buildSymbolicRegister",               (PyCFunction)triton_buildSymbolicRegister,                  METH_O,             ""},
+        {"clearBlockCache",                     (PyCFunction)triton_clearBlockCache,                        METH_NOARGS,        ""},
         {"clearPathConstraints",                (PyCFunction)triton_clearPathConstraints,                   METH_NOARGS,        ""},
+        {"clearSimplificationRules",            (PyCFunction)triton_clearSimplificationRules,               METH_NOARGS,        ""},
+        {"clearTranslationCache",               (PyCFunction)triton_clearTranslationCache,                  METH_NOARGS,        ""},
+        {"compileAst",                          (PyCFunction)triton_compileAst,                             METH_O,             ""},
         {"concretizeAllMemory",                 (PyCFunction)triton_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)triton_concretizeAllRegister,                  METH_NOARGS,        ""},
         {"concretizeMemory",                    (PyCFunction)triton_concretizeMemory,                       METH_O,             ""},
@@ -2936,6 +4215,7 @@ namespace triton {
         {"convertExpressionToSymbolicVariable", (PyCFunction)triton_convertExpressionToSymbolicVariable,    METH_VARARGS,       ""},
         {"convertMemoryToSymbolicVariable",     (PyCFunction)triton_convertMemoryToSymbolicVariable,        METH_VARARGS,       ""},
         {"convertRegisterToSymbolicVariable",   (PyCFunction)triton_convertRegisterToSymbolicVariable,      METH_VARARGS,       ""},
+        {"countTaintedMemory",                  (PyCFunction)triton_countTaintedMemory,                     METH_VARARGS,       ""},
         {"cpuInvalidRegister",                  (PyCFunction)triton_cpuInvalidRegister,                     METH_NOARGS,        ""},
         {"cpuRegisterBitSize",                  (PyCFunction)triton_cpuRegisterBitSize,                     METH_NOARGS,        ""},
         {"cpuRegisterSize",                     (PyCFunction)triton_cpuRegisterSize,                        METH_NOARGS,        ""},
@@ -2943,12 +4223,18 @@ namespace triton {
         {"createSymbolicMemoryExpression",      (PyCFunction)triton_createSymbolicMemoryExpression,         METH_VARARGS,       ""},
         {"createSymbolicRegisterExpression",    (PyCFunction)triton_createSymbolicRegisterExpression,       METH_VARARGS,       ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)triton_createSymbolicVolatileExpression,       METH_VARARGS,       ""},
+        {"deserializeAst",                      (PyCFunction)triton_deserializeAst,                         METH_O,             ""},
         {"disassembly",                         (PyCFunction)triton_disassembly,                            METH_O,             ""},
+        {"emulate",                             (PyCFunction)triton_emulate,                                METH_VARARGS,       ""},
         {"enableSymbolicEngine",                (PyCFunction)triton_enableSymbolicEngine,                   METH_O,             ""},
         {"enableSymbolicOptimization",          (PyCFunction)triton_enableSymbolicOptimization,             METH_VARARGS,       ""},
         {"enableSymbolicZ3Simplification",      (PyCFunction)triton_enableSymbolicZ3Simplification,         METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)triton_enableTaintEngine,                      METH_O,             ""},
+        {"enableTaintLabels",                   (PyCFunction)triton_enableTaintLabels,                      METH_O,             ""},
+        {"enableTaintProvenance",               (PyCFunction)triton_enableTaintProvenance,                  METH_VARARGS,       ""},
         {"evaluateAstViaZ3",                    (PyCFunction)triton_evaluateAstViaZ3,                       METH_O,             ""},
+        {"foldAst",                             (PyCFunction)triton_foldAst,                                METH_O,             ""},
+        {"foldSymbolicExpressions",             (PyCFunction)triton_foldSymbolicExpressions,                METH_NOARGS,        ""},
         {"getAllRegisters",                     (PyCFunction)triton_getAllRegisters,                        METH_NOARGS,        ""},
         {"getArchitecture",                     (PyCFunction)triton_getArchitecture,                        METH_NOARGS,        ""},
         {"getAstDictionariesStats",             (PyCFunction)triton_getAstDictionariesStats,                METH_NOARGS,        ""},
@@ -2959,11 +4245,17 @@ namespace triton {
         {"getConcreteRegisterValue",            (PyCFunction)triton_getConcreteRegisterValue,               METH_O,             ""},
         {"getFullAst",                          (PyCFunction)triton_getFullAst,                             METH_O,             ""},
         {"getFullAstFromId",                    (PyCFunction)triton_getFullAstFromId,                       METH_O,             ""},
+        {"getMemoryTaintLabels",                (PyCFunction)triton_getMemoryTaintLabels,                   METH_O,             ""},
+        {"getMemoryTaintProvenance",            (PyCFunction)triton_getMemoryTaintProvenance,               METH_O,             ""},
         {"getModel",                            (PyCFunction)triton_getModel,                               METH_O,             ""},
         {"getModels",                           (PyCFunction)triton_getModels,                              METH_VARARGS,       ""},
+        {"getNextTaintedMemory",                (PyCFunction)triton_getNextTaintedMemory,                   METH_O,             ""},
         {"getParentRegisters",                  (PyCFunction)triton_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)triton_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)triton_getPathConstraintsAst,                  METH_NOARGS,        ""},
+        {"getRegisterTaintLabels",              (PyCFunction)triton_getRegisterTaintLabels,                 METH_O,             ""},
+        {"getRegisterTaintProvenance",          (PyCFunction)triton_getRegisterTaintProvenance,             METH_O,             ""},
+        {"getSimplificationRules",              (PyCFunction)triton_getSimplificationRules,                 METH_NOARGS,        ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)triton_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)triton_getSymbolicExpressions,                 METH_NOARGS,        ""},
         {"getSymbolicMemory",                   (PyCFunction)triton_getSymbolicMemory,                      METH_NOARGS,        ""},
@@ -2976,6 +4268,7 @@ namespace triton {
         {"getSymbolicVariableFromName",         (PyCFunction)triton_getSymbolicVariableFromName,            METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)triton_getSymbolicVariables,                   METH_NOARGS,        ""},
         {"getTaintedMemory",                    (PyCFunction)triton_getTaintedMemory,                       METH_NOARGS,        ""},
+        {"getTaintedMemoryRanges",              (PyCFunction)triton_getTaintedMemoryRanges,                 METH_VARARGS,       ""},
         {"getTaintedRegisters",                 (PyCFunction)triton_getTaintedRegisters,                    METH_NOARGS,        ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)triton_getTaintedSymbolicExpressions,          METH_NOARGS,        ""},
         {"isArchitectureValid",                 (PyCFunction)triton_isArchitectureValid,                    METH_NOARGS,        ""},
@@ -2987,12 +4280,27 @@ namespace triton {
         {"isSymbolicOptimizationEnabled",       (PyCFunction)triton_isSymbolicOptimizationEnabled,          METH_O,             ""},
         {"isSymbolicZ3SimplificationEnabled",   (PyCFunction)triton_isSymbolicZ3SimplificationEnabled,      METH_NOARGS,        ""},
         {"isTaintEngineEnabled",                (PyCFunction)triton_isTaintEngineEnabled,                   METH_NOARGS,        ""},
+        {"isTaintLabelsEnabled",                (PyCFunction)triton_isTaintLabelsEnabled,                   METH_NOARGS,        ""},
+        {"isTaintProvenanceEnabled",            (PyCFunction)triton_isTaintProvenanceEnabled,               METH_NOARGS,        ""},
+        {"loadBinary",                          (PyCFunction)triton_loadBinary,                             METH_O,             ""},
+        {"loadSimplificationPlugin",            (PyCFunction)triton_loadSimplificationPlugin,               METH_O,             ""},
+        {"loadSimplificationRules",             (PyCFunction)triton_loadSimplificationRules,                METH_O,             ""},
+        {"loadSymbolicState",                   (PyCFunction)triton_loadSymbolicState,                      METH_O,             ""},
         {"newSymbolicExpression",               (PyCFunction)triton_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)triton_newSymbolicVariable,                    METH_VARARGS,       ""},
+        {"parseSmtLib2",                        (PyCFunction)triton_parseSmtLib2,                           METH_O,             ""},
+        {"processBlock",                        (PyCFunction)triton_processBlock,                           METH_VARARGS,       ""},
+        {"processBatch",                        (PyCFunction)triton_processBatch,                           METH_O,             ""},
+        {"processCodeRegion",                   (PyCFunction)triton_processCodeRegion,                      METH_VARARGS,       ""},
         {"processing",                          (PyCFunction)triton_processing,                             METH_O,             ""},
         {"removeAllCallbacks",                  (PyCFunction)triton_removeAllCallbacks,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)triton_removeCallback,                         METH_VARARGS,       ""},
+        {"replayTrace",                         (PyCFunction)triton_replayTrace,                            METH_VARARGS,       ""},
         {"resetEngines",                        (PyCFunction)triton_resetEngines,                           METH_NOARGS,        ""},
+        {"runAst",                              (PyCFunction)triton_runAst,                                 METH_VARARGS,       ""},
+        {"runAstBatch",                         (PyCFunction)triton_runAstBatch,                            METH_VARARGS,       ""},
+        {"saveSymbolicState",                   (PyCFunction)triton_saveSymbolicState,                      METH_O,             ""},
+        {"serializeAst",                        (PyCFunction)triton_serializeAst,                           METH_O,             ""},
         {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)triton_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)triton_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
@@ -3000,6 +4308,7 @@ namespace triton {
         {"setConcreteRegisterValue",            (PyCFunction)triton_setConcreteRegisterValue,               METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)triton_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)triton_setTaintRegister,                       METH_VARARGS,       ""},
+        {"setupStack",                          (PyCFunction)triton_setupStack,                             METH_O,             ""},
         {"simplify",                            (PyCFunction)triton_simplify,                               METH_VARARGS,       ""},
         {"taintAssignmentMemoryImmediate",      (PyCFunction)triton_taintAssignmentMemoryImmediate,         METH_O,             ""},
         {"taintAssignmentMemoryMemory",         (PyCFunction)triton_taintAssignmentMemoryMemory,            METH_VARARGS,       ""},
@@ -3007,8 +4316,8 @@ namespace triton {
         {"taintAssignmentRegisterImmediate",    (PyCFunction)triton_taintAssignmentRegisterImmediate,       METH_O,             ""},
         {"taintAssignmentRegisterMemory",       (PyCFunction)triton_taintAssignmentRegisterMemory,          METH_VARARGS,       ""},
         {"taintAssignmentRegisterRegister",     (PyCFunction)triton_taintAssignmentRegisterRegister,        METH_VARARGS,       ""},
-        {"taintMemory",                         (PyCFunction)triton_taintMemory,                            METH_O,             ""},
-        {"taintRegister",                       (PyCFunction)triton_taintRegister,                          METH_O,             ""},
+        {"taintMemory",                         (PyCFunction)triton_taintMemory,                            METH_VARARGS,       ""},
+        {"taintRegister",                       (PyCFunction)triton_taintRegister,                          METH_VARARGS,       ""},
         {"taintUnionMemoryImmediate",           (PyCFunction)triton_taintUnionMemoryImmediate,              METH_O,             ""},
         {"taintUnionMemoryMemory",              (PyCFunction)triton_taintUnionMemoryMemory,                 METH_VARARGS,       ""},
         {"taintUnionMemoryRegister",            (PyCFunction)triton_taintUnionMemoryRegister,               METH_VARARGS,       ""},
@@ -3018,6 +4327,7 @@ namespace triton {
         {"unmapMemory",                         (PyCFunction)triton_unmapMemory,                            METH_VARARGS,       ""},
         {"untaintMemory",                       (PyCFunction)triton_untaintMemory,                          METH_O,             ""},
         {"untaintRegister",                     (PyCFunction)triton_untaintRegister,                        METH_O,             ""},
+        {"writeTrace",                          (PyCFunction)triton_writeTrace,                             METH_VARARGS,       ""},
         {nullptr,                               nullptr,                                                    0,                  nullptr}
 
       };
@@ -45,6 +45,11 @@ Defines a callback which be called before all symbolic assignments. The callback
 an \ref py_AstNode_page and must return a valid \ref py_AstNode_page. The returned node is used as assignment.
 See also the page about \ref SMT_simplification_page.
 
+- **CALLBACK.SYSCALL**<br>
+The callback takes as unique argument the processed syscall \ref py_Instruction_page. Callbacks will be called by `emulate()`
+each time that a syscall is executed and may emulate it by updating the concrete state. The emulation goes on only if all
+callbacks return True.
+
 */
 
 
@@ -57,6 +62,7 @@ namespace triton {
         PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
         PyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
         PyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",     PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
+        PyDict_SetItemString(callbackDict, "SYSCALL",                     PyLong_FromUint32(triton::callbacks::SYSCALL));
       }
 
     }; /* python namespace */
@@ -35,9 +35,25 @@ The OPTIMIZATION namespace contains all kinds of symbolic optimization.
 - **OPTIMIZATION.ALIGNED_MEMORY**<br>
 Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` acceess.
 
+- **OPTIMIZATION.AST_CANONICALIZATION**<br>
+Enabled, Triton will fold the nodes when they are built (e.g: `bvadd((_ bv1 8), (_ bv2 8))` returns `(_ bv3 8)`) and
+will order the operands of the commutative operators (references, variables, operators, then constants), which improves
+the hits of the `AST_DICTIONARIES` optimization. Fewer nodes are allocated but the ASTs may differ from the semantics.
+
 - **OPTIMIZATION.AST_DICTIONARIES**<br>
 Enabled, Triton will record all AST nodes into several dictionaries and try to return node already allocated instead of allocate twice the same node.
 
+- **OPTIMIZATION.AST_FOLDING**<br>
+Enabled, Triton will fold the constants and the algebraic identities (e.g: `x + 0`, `x & (x | y)`, `~~x`, extractions of
+concatenations, zx and sx chains) of each new expression. Nodes shared by several expressions are folded once.
+
+- **OPTIMIZATION.CONCRETE_FAST_PATH**<br>
+Enabled, Triton will emulate natively the instructions whose inputs are neither symbolized nor tainted. No symbolic
+expression is created for such instructions and their load, store and register accesses are not recorded.
+
+- **OPTIMIZATION.DEAD_FLAGS_ELIMINATION**<br>
+Enabled, Triton will remove flag expressions which are overwritten before being read inside a block processed by `processBlock()`.
+
 - **OPTIMIZATION.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
@@ -47,6 +63,18 @@ Enabled, Triton will perform symbolic execution only on tainted instructions.
 - **OPTIMIZATION.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This optimization is enabled by default.
 
+- **OPTIMIZATION.SEMANTICS_TEMPLATES**<br>
+Enabled, Triton will record the expressions built for the register-only ALU instructions (e.g: `add`, `xor`, `mov`)
+as templates keyed by address and opcodes. When the same instruction is processed again, its expressions are rebuilt
+from the template and from the registers it reads, without going through the semantics, and the taint is spread through
+the table of rules. The templates are not recorded while the ASTs are rewritten by another optimization or a simplification.
+The decoding of the instructions processed by `processing()` is also cached per address. See `clearTranslationCache()`.
+
+- **OPTIMIZATION.TAINT_ONLY**<br>
+Enabled, Triton will only spread the taint through a table of rules. No AST is built and the concrete state is not updated,
+thus each instruction must come with its context (see `Instruction.updateContext()`). Unsupported instructions go through
+the whole semantics.
+
 */
 
 
@@ -57,10 +85,16 @@ namespace triton {
 
       void initSymOptiNamespace(PyObject* symOptiDict) {
         PyDict_SetItemString(symOptiDict, "ALIGNED_MEMORY",         PyLong_FromUint32(triton::engines::symbolic::ALIGNED_MEMORY));
+        PyDict_SetItemString(symOptiDict, "AST_CANONICALIZATION",   PyLong_FromUint32(triton::engines::symbolic::AST_CANONICALIZATION));
         PyDict_SetItemString(symOptiDict, "AST_DICTIONARIES",       PyLong_FromUint32(triton::engines::symbolic::AST_DICTIONARIES));
+        PyDict_SetItemString(symOptiDict, "AST_FOLDING",            PyLong_FromUint32(triton::engines::symbolic::AST_FOLDING));
+        PyDict_SetItemString(symOptiDict, "CONCRETE_FAST_PATH",     PyLong_FromUint32(triton::engines::symbolic::CONCRETE_FAST_PATH));
+        PyDict_SetItemString(symOptiDict, "DEAD_FLAGS_ELIMINATION", PyLong_FromUint32(triton::engines::symbolic::DEAD_FLAGS_ELIMINATION));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint32(triton::engines::symbolic::ONLY_ON_SYMBOLIZED));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_TAINTED",        PyLong_FromUint32(triton::engines::symbolic::ONLY_ON_TAINTED));
         PyDict_SetItemString(symOptiDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint32(triton::engines::symbolic::PC_TRACKING_SYMBOLIC));
+        PyDict_SetItemString(symOptiDict, "SEMANTICS_TEMPLATES",    PyLong_FromUint32(triton::engines::symbolic::SEMANTICS_TEMPLATES));
+        PyDict_SetItemString(symOptiDict, "TAINT_ONLY",             PyLong_FromUint32(triton::engines::symbolic::TAINT_ONLY));
       }
 
     }; /* python namespace */
@@ -0,0 +1,205 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <astBytecode.hpp>
+#include <pythonObjects.hpp>
+#include <pythonUtils.hpp>
+#include <pythonXFunctions.hpp>
+
+
+
+/*! \page py_AstBytecode_page AstBytecode
+    \brief [**python api**] All information about the AstBytecode python object.
+
+\tableofcontents
+
+\section py_AstBytecode_description Description
+<hr>
+
+This object is an AST compiled by `compileAst()`. The compiled AST is evaluated by `runAst()` on native
+64-bits integers, which is much faster than building and evaluating new nodes when the same expression
+is evaluated with many values of its symbolic variables. `runAstBatch()` evaluates it on many inputs at once,
+given as one column of values per variable. Nodes wider than 64 bits cannot be compiled.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import *
+>>> from triton.ast import *
+
+>>> setArchitecture(ARCH.X86_64)
+>>> x = newSymbolicVariable(32)
+>>> y = newSymbolicVariable(32)
+>>> node = (variable(x) * bv(3, 32)) ^ variable(y)
+
+>>> compiled = compileAst(node)
+>>> compiled.getVariables()
+[0L, 1L]
+
+>>> runAst(compiled, {x.getId(): 5, y.getId(): 1})
+14L
+>>> runAst(compiled, [5, 1])
+14L
+>>> runAstBatch(compiled, [[5, 6, 7], [1, 1, 0]])
+[14L, 19L, 21L]
+~~~~~~~~~~~~~
+
+\section AstBytecode_py_api Python API - Methods of the AstBytecode class
+<hr>
+
+- **getBitvectorSize(void)**<br>
+Returns the size of the compiled node as integer.
+
+- **getNumberOfInstructions(void)**<br>
+Returns the number of instructions of the bytecode as integer. A node shared by several parents is compiled once.
+
+- **getNumberOfRegisters(void)**<br>
+Returns the number of registers of the bytecode as integer. A register is reused once its value is read for the last time.
+
+- **getVariables(void)**<br>
+Returns the ids of the symbolic variables as list of integers. The values given to `runAst()` as list follow this order.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! AstBytecode destructor.
+      void AstBytecode_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        delete PyAstBytecode_AsAstBytecode(self);
+        Py_DECREF(self);
+      }
+
+
+      static PyObject* AstBytecode_getBitvectorSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyAstBytecode_AsAstBytecode(self)->getBitvectorSize());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstBytecode_getNumberOfInstructions(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyAstBytecode_AsAstBytecode(self)->getInstructions().size());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstBytecode_getNumberOfRegisters(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyAstBytecode_AsAstBytecode(self)->getNumberOfRegisters());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstBytecode_getVariables(PyObject* self, PyObject* noarg) {
+        try {
+          const std::vector<triton::usize>& variables = PyAstBytecode_AsAstBytecode(self)->getVariables();
+          PyObject* ret = xPyList_New(variables.size());
+
+          for (triton::usize index = 0; index < variables.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUsize(variables[index]));
+
+          return ret;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      //! AstBytecode methods.
+      PyMethodDef AstBytecode_callbacks[] = {
+        {"getBitvectorSize",        AstBytecode_getBitvectorSize,         METH_NOARGS,    ""},
+        {"getNumberOfInstructions", AstBytecode_getNumberOfInstructions,  METH_NOARGS,    ""},
+        {"getNumberOfRegisters",    AstBytecode_getNumberOfRegisters,     METH_NOARGS,    ""},
+        {"getVariables",            AstBytecode_getVariables,             METH_NOARGS,    ""},
+        {nullptr,                   nullptr,                              0,              nullptr}
+      };
+
+
+      PyTypeObject AstBytecode_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "AstBytecode",                              /* tp_name */
+        sizeof(AstBytecode_Object),                 /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)AstBytecode_dealloc,            /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "AstBytecode objects",                      /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        AstBytecode_callbacks,                      /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      PyObject* PyAstBytecode(const triton::ast::AstBytecode& bytecode) {
+        AstBytecode_Object* object;
+
+        PyType_Ready(&AstBytecode_Type);
+        object = PyObject_NEW(AstBytecode_Object, &AstBytecode_Type);
+        if (object != NULL)
+          object->bytecode = new triton::ast::AstBytecode(bytecode);
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
@@ -0,0 +1,751 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <algorithm>
+#include <sstream>
+
+#include <api.hpp>
+#include <pythonObjects.hpp>
+#include <pythonUtils.hpp>
+#include <pythonXFunctions.hpp>
+
+
+
+/*! \page py_View_page View
+    \brief [**python api**] All information about the View python object.
+
+\tableofcontents
+
+\section py_View_description Description
+<hr>
+
+A view is a lazy and read-only window over a container of the engines: the symbolic expressions, the symbolic memory, the
+symbolic variables or the tainted memory. Nothing is copied when a view is created and each access looks up the current state
+of the engines, thus a view follows the processing and `resetEngines()`. Use `dict(view)` or `list(view)` to keep a snapshot.
+
+The views of symbolic expressions, symbolic memory and symbolic variables behave as read-only dictionaries ordered by key
+(id or address). The view of tainted memory behaves as the sorted list of tainted addresses.
+
+~~~~~~~~~~~~~{.py}
+>>> exprs = getSymbolicExpressions()
+>>> len(exprs)
+1024
+>>> for id, expr in exprs.getRange(100, 200).filterByKind(SYMEXPR.MEM).iteritems():
+...     print expr
+...
+>>> len(getSymbolicMemory().filterByTaint())
+16
+>>> 0x1000 in getTaintedMemory()
+True
+~~~~~~~~~~~~~
+
+The length of a view is given by the container, unless the view is filtered or restricted to a range. In this case, the view
+is walked without allocating its items.
+
+\section View_py_api Python API - Methods of the View class
+<hr>
+
+- **filterByKind(\ref py_SYMEXPR_page kind)**<br>
+Returns a view restricted to the symbolic expressions or symbolic variables of a kind.
+
+- **filterByTaint(void)**<br>
+Returns a view restricted to the tainted symbolic expressions. Only for views of symbolic expressions or symbolic memory.
+
+- **get(integer key, default=None)**<br>
+Returns the item of a key, or `default` if the key is not in the view.
+
+- **getRange(integer start, integer end)**<br>
+Returns a view restricted to the keys in `[start, end)`.
+
+- **items(void)**<br>
+Returns the list of `(key, item)` tuples.
+
+- **iteritems(void)**<br>
+Returns an iterator over the `(key, item)` tuples.
+
+- **iterkeys(void)**<br>
+Returns an iterator over the keys.
+
+- **itervalues(void)**<br>
+Returns an iterator over the items.
+
+- **keys(void)**<br>
+Returns the list of keys.
+
+- **values(void)**<br>
+Returns the list of items.
+
+Note that the methods of dictionaries are not available on a view of tainted memory. This view is indexed by position, which
+walks the tainted memory up to this position.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! View and ViewIterator destructor.
+      void View_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        PyObject_Del(self);
+      }
+
+
+      /* Returns a copy of a view as the given type */
+      static View_Object* View_copy(const View_Object* view, PyTypeObject* type) {
+        View_Object* object;
+
+        PyType_Ready(type);
+        object = PyObject_NEW(View_Object, type);
+        if (object != NULL) {
+          object->kind      = view->kind;
+          object->start     = view->start;
+          object->last      = view->last;
+          object->byKind    = view->byKind;
+          object->symKind   = view->symKind;
+          object->tainted   = view->tainted;
+          object->items     = VIEW_KEYS;
+          object->cursor    = view->start;
+          object->exhausted = (view->start > view->last);
+        }
+
+        return object;
+      }
+
+
+      /* Returns true if the view is a dictionary */
+      static bool View_isMapping(const View_Object* view) {
+        return (view->kind != VIEW_TAINTED_MEMORY);
+      }
+
+
+      /* Returns true if the view is neither filtered nor restricted to a range */
+      static bool View_isWhole(const View_Object* view) {
+        return (view->start == 0 && view->last == static_cast<triton::uint64>(-1) && !view->byKind && !view->tainted);
+      }
+
+
+      /* Returns true if the symbolic expression passes the filters of the view */
+      static bool View_matchExpression(const View_Object* view, const triton::engines::symbolic::SymbolicExpression* expr) {
+        if (expr == nullptr)
+          return false;
+        if (view->byKind && expr->getKind() != view->symKind)
+          return false;
+        if (view->tainted && !expr->isTainted)
+          return false;
+        return true;
+      }
+
+
+      /* Looks for the first key of the view at or after `from` */
+      static bool View_findKey(const View_Object* view, triton::uint64 from, triton::uint64& key) {
+        if (from < view->start)
+          from = view->start;
+
+        if (from > view->last)
+          return false;
+
+        switch (view->kind) {
+          case VIEW_SYMBOLIC_EXPRESSIONS: {
+            const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& expressions = triton::api.getSymbolicExpressions();
+            std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>::const_iterator it;
+            for (it = expressions.lower_bound(static_cast<triton::usize>(from)); it != expressions.end() && it->first <= view->last; it++) {
+              if (View_matchExpression(view, it->second)) {
+                key = it->first;
+                return true;
+              }
+            }
+            return false;
+          }
+
+          case VIEW_SYMBOLIC_MEMORY: {
+            const std::map<triton::uint64, triton::usize>& references = triton::api.getSymbolicMemoryReferences();
+            std::map<triton::uint64, triton::usize>::const_iterator it;
+            for (it = references.lower_bound(from); it != references.end() && it->first <= view->last; it++) {
+              if (!view->tainted || View_matchExpression(view, triton::api.getSymbolicExpressionFromId(it->second))) {
+                key = it->first;
+                return true;
+              }
+            }
+            return false;
+          }
+
+          case VIEW_SYMBOLIC_VARIABLES: {
+            const std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>& variables = triton::api.getSymbolicVariables();
+            std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>::const_iterator it;
+            for (it = variables.lower_bound(static_cast<triton::usize>(from)); it != variables.end() && it->first <= view->last; it++) {
+              if (!view->byKind || it->second->getKind() == view->symKind) {
+                key = it->first;
+                return true;
+              }
+            }
+            return false;
+          }
+
+          case VIEW_TAINTED_MEMORY:
+            return (triton::api.getNextTaintedMemory(from, key) && key <= view->last);
+        }
+
+        return false;
+      }
+
+
+      /* Returns true if the key is in the view */
+      static bool View_hasKey(const View_Object* view, triton::uint64 key) {
+        triton::uint64 found = 0;
+        return (View_findKey(view, key, found) && found == key);
+      }
+
+
+      /* Returns the item of a key which is in the view */
+      static PyObject* View_getItem(const View_Object* view, triton::uint64 key) {
+        switch (view->kind) {
+          case VIEW_SYMBOLIC_EXPRESSIONS:
+            return PySymbolicExpression(triton::api.getSymbolicExpressionFromId(static_cast<triton::usize>(key)));
+
+          case VIEW_SYMBOLIC_MEMORY:
+            return PySymbolicExpression(triton::api.getSymbolicExpressionFromId(triton::api.getSymbolicMemoryId(key)));
+
+          case VIEW_SYMBOLIC_VARIABLES:
+            return PySymbolicVariable(triton::api.getSymbolicVariableFromId(static_cast<triton::usize>(key)));
+
+          default:
+            return PyLong_FromUint64(key);
+        }
+      }
+
+
+      /* Returns the number of keys in the view */
+      static triton::usize View_size(const View_Object* view) {
+        triton::usize count = 0;
+        triton::uint64 key  = 0;
+
+        if (view->start > view->last)
+          return 0;
+
+        switch (view->kind) {
+          case VIEW_SYMBOLIC_EXPRESSIONS:
+            if (View_isWhole(view))
+              return triton::api.getSymbolicExpressions().size();
+            break;
+
+          case VIEW_SYMBOLIC_MEMORY:
+            if (View_isWhole(view))
+              return triton::api.getSymbolicMemoryReferences().size();
+            break;
+
+          case VIEW_SYMBOLIC_VARIABLES:
+            if (View_isWhole(view))
+              return triton::api.getSymbolicVariables().size();
+            break;
+
+          case VIEW_TAINTED_MEMORY:
+            /* The last address is counted apart, [start, last + 1) may overflow */
+            count = triton::api.countTaintedMemory(view->start, view->last);
+            if (triton::api.isMemoryTainted(view->last))
+              count++;
+            return count;
+        }
+
+        for (triton::uint64 from = view->start; View_findKey(view, from, key); from = key + 1) {
+          count++;
+          if (key == view->last)
+            break;
+        }
+
+        return count;
+      }
+
+
+      /* Returns the key at a position of the view */
+      static bool View_getKeyAt(const View_Object* view, triton::usize position, triton::uint64& key) {
+        triton::uint64 from = view->start;
+
+        while (View_findKey(view, from, key)) {
+          if (position-- == 0)
+            return true;
+          if (key == view->last)
+            break;
+          from = key + 1;
+        }
+
+        return false;
+      }
+
+
+      static Py_ssize_t View_length(PyObject* self) {
+        try {
+          return static_cast<Py_ssize_t>(View_size(reinterpret_cast<View_Object*>(self)));
+        }
+        catch (const std::exception& e) {
+          PyErr_Format(PyExc_TypeError, "%s", e.what());
+          return -1;
+        }
+      }
+
+
+      static PyObject* View_subscript(PyObject* self, PyObject* key) {
+        View_Object* view = reinterpret_cast<View_Object*>(self);
+        triton::uint64 found = 0;
+
+        if (!PyLong_Check(key) && !PyInt_Check(key))
+          return PyErr_Format(PyExc_TypeError, "View::__getitem__(): Expects an integer as key.");
+
+        try {
+          /* A view of tainted memory is indexed by position */
+          if (!View_isMapping(view)) {
+            triton::sint64 position = PyLong_AsLongLong(key);
+            if (position < 0)
+              position += static_cast<triton::sint64>(View_size(view));
+            if (position < 0 || !View_getKeyAt(view, static_cast<triton::usize>(position), found))
+              return PyErr_Format(PyExc_IndexError, "View::__getitem__(): Index out of range.");
+            return PyLong_FromUint64(found);
+          }
+
+          if (!View_hasKey(view, PyLong_AsUint64(key))) {
+            PyErr_SetObject(PyExc_KeyError, key);
+            return nullptr;
+          }
+
+          return View_getItem(view, PyLong_AsUint64(key));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static int View_contains(PyObject* self, PyObject* key) {
+        if (!PyLong_Check(key) && !PyInt_Check(key))
+          return 0;
+
+        try {
+          return View_hasKey(reinterpret_cast<View_Object*>(self), PyLong_AsUint64(key));
+        }
+        catch (const std::exception& e) {
+          PyErr_Format(PyExc_TypeError, "%s", e.what());
+          return -1;
+        }
+      }
+
+
+      /* Returns an iterator over the view */
+      static PyObject* View_iterate(PyObject* self, triton::uint32 items) {
+        View_Object* iterator = View_copy(reinterpret_cast<View_Object*>(self), &ViewIterator_Type);
+
+        if (iterator != NULL)
+          iterator->items = items;
+
+        return reinterpret_cast<PyObject*>(iterator);
+      }
+
+
+      /* Returns a list of the items of the view */
+      static PyObject* View_list(PyObject* self, triton::uint32 items) {
+        PyObject* iterator = nullptr;
+        PyObject* ret      = nullptr;
+        PyObject* item     = nullptr;
+
+        if (!View_isMapping(reinterpret_cast<View_Object*>(self)))
+          return PyErr_Format(PyExc_TypeError, "View: The view of tainted memory is not a dictionary.");
+
+        iterator = View_iterate(self, items);
+        if (iterator == nullptr)
+          return nullptr;
+
+        ret = xPyList_New(0);
+        while ((item = PyIter_Next(iterator)) != nullptr) {
+          PyList_Append(ret, item);
+          Py_DECREF(item);
+        }
+
+        Py_DECREF(iterator);
+
+        if (PyErr_Occurred()) {
+          Py_DECREF(ret);
+          return nullptr;
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* View_iter(PyObject* self) {
+        return View_iterate(self, VIEW_KEYS);
+      }
+
+
+      static PyObject* View_filterByKind(PyObject* self, PyObject* kind) {
+        View_Object* view = reinterpret_cast<View_Object*>(self);
+        View_Object* ret  = nullptr;
+
+        if (view->kind != VIEW_SYMBOLIC_EXPRESSIONS && view->kind != VIEW_SYMBOLIC_VARIABLES)
+          return PyErr_Format(PyExc_TypeError, "View::filterByKind(): Only views of symbolic expressions or variables have kinds.");
+
+        if (!PyLong_Check(kind) && !PyInt_Check(kind))
+          return PyErr_Format(PyExc_TypeError, "View::filterByKind(): Expects a SYMEXPR as argument.");
+
+        try {
+          triton::uint32 symKind = PyLong_AsUint32(kind);
+
+          ret = View_copy(view, &View_Type);
+          if (ret != NULL) {
+            ret->byKind  = true;
+            ret->symKind = symKind;
+          }
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return reinterpret_cast<PyObject*>(ret);
+      }
+
+
+      static PyObject* View_filterByTaint(PyObject* self, PyObject* noarg) {
+        View_Object* view = reinterpret_cast<View_Object*>(self);
+        View_Object* ret  = nullptr;
+
+        if (view->kind != VIEW_SYMBOLIC_EXPRESSIONS && view->kind != VIEW_SYMBOLIC_MEMORY)
+          return PyErr_Format(PyExc_TypeError, "View::filterByTaint(): Only views of symbolic expressions or memory may be filtered by taint.");
+
+        ret = View_copy(view, &View_Type);
+        if (ret != NULL)
+          ret->tainted = true;
+
+        return reinterpret_cast<PyObject*>(ret);
+      }
+
+
+      static PyObject* View_get(PyObject* self, PyObject* args) {
+        View_Object* view = reinterpret_cast<View_Object*>(self);
+        PyObject* key     = nullptr;
+        PyObject* dflt    = Py_None;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &key, &dflt);
+
+        if (!View_isMapping(view))
+          return PyErr_Format(PyExc_TypeError, "View::get(): The view of tainted memory is not a dictionary.");
+
+        if (key == nullptr || (!PyLong_Check(key) && !PyInt_Check(key)))
+          return PyErr_Format(PyExc_TypeError, "View::get(): Expects an integer as first argument.");
+
+        try {
+          if (View_hasKey(view, PyLong_AsUint64(key)))
+            return View_getItem(view, PyLong_AsUint64(key));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(dflt);
+        return dflt;
+      }
+
+
+      static PyObject* View_getRange(PyObject* self, PyObject* args) {
+        View_Object* view = reinterpret_cast<View_Object*>(self);
+        View_Object* ret  = nullptr;
+        PyObject* start   = nullptr;
+        PyObject* end     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &start, &end);
+
+        if (start == nullptr || (!PyLong_Check(start) && !PyInt_Check(start)))
+          return PyErr_Format(PyExc_TypeError, "View::getRange(): Expects an integer as first argument.");
+
+        if (end == nullptr || (!PyLong_Check(end) && !PyInt_Check(end)))
+          return PyErr_Format(PyExc_TypeError, "View::getRange(): Expects an integer as second argument.");
+
+        try {
+          triton::uint64 first = PyLong_AsUint64(start);
+          triton::uint64 last  = PyLong_AsUint64(end);
+
+          ret = View_copy(view, &View_Type);
+          if (ret != NULL) {
+            /* An empty range gives an empty view (start > last) */
+            if (last <= first) {
+              ret->start = 1;
+              ret->last  = 0;
+            }
+            else {
+              ret->start = std::max(view->start, first);
+              ret->last  = std::min(view->last, last - 1);
+            }
+          }
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return reinterpret_cast<PyObject*>(ret);
+      }
+
+
+      static PyObject* View_items(PyObject* self, PyObject* noarg) {
+        return View_list(self, VIEW_ITEMS);
+      }
+
+
+      static PyObject* View_iteritems(PyObject* self, PyObject* noarg) {
+        if (!View_isMapping(reinterpret_cast<View_Object*>(self)))
+          return PyErr_Format(PyExc_TypeError, "View::iteritems(): The view of tainted memory is not a dictionary.");
+        return View_iterate(self, VIEW_ITEMS);
+      }
+
+
+      static PyObject* View_iterkeys(PyObject* self, PyObject* noarg) {
+        return View_iterate(self, VIEW_KEYS);
+      }
+
+
+      static PyObject* View_itervalues(PyObject* self, PyObject* noarg) {
+        if (!View_isMapping(reinterpret_cast<View_Object*>(self)))
+          return PyErr_Format(PyExc_TypeError, "View::itervalues(): The view of tainted memory is not a dictionary.");
+        return View_iterate(self, VIEW_VALUES);
+      }
+
+
+      static PyObject* View_keys(PyObject* self, PyObject* noarg) {
+        return View_list(self, VIEW_KEYS);
+      }
+
+
+      static PyObject* View_values(PyObject* self, PyObject* noarg) {
+        return View_list(self, VIEW_VALUES);
+      }
+
+
+      static PyObject* View_str(PyObject* self) {
+        static const char* names[] = {"SymbolicExpressions", "SymbolicMemory", "SymbolicVariables", "TaintedMemory"};
+        View_Object* view = reinterpret_cast<View_Object*>(self);
+
+        try {
+          std::stringstream str;
+          str << "<View " << names[view->kind] << ": " << View_size(view) << " items>";
+          return PyString_FromFormat("%s", str.str().c_str());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ViewIterator_next(PyObject* self) {
+        View_Object* iterator = reinterpret_cast<View_Object*>(self);
+        PyObject* ret         = nullptr;
+        triton::uint64 key    = 0;
+
+        if (iterator->exhausted)
+          return nullptr;
+
+        try {
+          if (!View_findKey(iterator, iterator->cursor, key)) {
+            iterator->exhausted = true;
+            return nullptr;
+          }
+
+          /* The cursor is a key, thus the iteration goes on if the container changes */
+          if (key == iterator->last)
+            iterator->exhausted = true;
+          else
+            iterator->cursor = key + 1;
+
+          switch (iterator->items) {
+            case VIEW_VALUES:
+              return View_getItem(iterator, key);
+
+            case VIEW_ITEMS:
+              ret = xPyTuple_New(2);
+              PyTuple_SetItem(ret, 0, PyLong_FromUint64(key));
+              PyTuple_SetItem(ret, 1, View_getItem(iterator, key));
+              return ret;
+
+            default:
+              return PyLong_FromUint64(key);
+          }
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      //! View methods.
+      PyMethodDef View_callbacks[] = {
+        {"filterByKind",      View_filterByKind,      METH_O,         ""},
+        {"filterByTaint",     View_filterByTaint,     METH_NOARGS,    ""},
+        {"get",               View_get,               METH_VARARGS,   ""},
+        {"getRange",          View_getRange,          METH_VARARGS,   ""},
+        {"items",             View_items,             METH_NOARGS,    ""},
+        {"iteritems",         View_iteritems,         METH_NOARGS,    ""},
+        {"iterkeys",          View_iterkeys,          METH_NOARGS,    ""},
+        {"itervalues",        View_itervalues,        METH_NOARGS,    ""},
+        {"keys",              View_keys,              METH_NOARGS,    ""},
+        {"values",            View_values,            METH_NOARGS,    ""},
+        {nullptr,             nullptr,                0,              nullptr}
+      };
+
+
+      //! View mapping protocol.
+      PyMappingMethods View_mapping = {
+        (lenfunc)View_length,                       /* mp_length */
+        (binaryfunc)View_subscript,                 /* mp_subscript */
+        0,                                          /* mp_ass_subscript */
+      };
+
+
+      //! View sequence protocol, only for `in`.
+      PySequenceMethods View_sequence = {
+        (lenfunc)View_length,                       /* sq_length */
+        0,                                          /* sq_concat */
+        0,                                          /* sq_repeat */
+        0,                                          /* sq_item */
+        0,                                          /* sq_slice */
+        0,                                          /* sq_ass_item */
+        0,                                          /* sq_ass_slice */
+        (objobjproc)View_contains,                  /* sq_contains */
+        0,                                          /* sq_inplace_concat */
+        0,                                          /* sq_inplace_repeat */
+      };
+
+
+      PyTypeObject View_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "View",                                     /* tp_name */
+        sizeof(View_Object),                        /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)View_dealloc,                   /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        (reprfunc)View_str,                         /* tp_repr */
+        0,                                          /* tp_as_number */
+        &View_sequence,                             /* tp_as_sequence */
+        &View_mapping,                              /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        (reprfunc)View_str,                         /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "View objects",                             /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        (getiterfunc)View_iter,                     /* tp_iter */
+        0,                                          /* tp_iternext */
+        View_callbacks,                             /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      PyTypeObject ViewIterator_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "ViewIterator",                             /* tp_name */
+        sizeof(View_Object),                        /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)View_dealloc,                   /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "ViewIterator objects",                     /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        PyObject_SelfIter,                          /* tp_iter */
+        (iternextfunc)ViewIterator_next,            /* tp_iternext */
+        0,                                          /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      PyObject* PyView(triton::uint32 kind) {
+        View_Object* object;
+
+        PyType_Ready(&View_Type);
+        object = PyObject_NEW(View_Object, &View_Type);
+        if (object != NULL) {
+          object->kind      = kind;
+          object->start     = 0;
+          object->last      = static_cast<triton::uint64>(-1);
+          object->byKind    = false;
+          object->symKind   = 0;
+          object->tainted   = false;
+          object->items     = VIEW_KEYS;
+          object->cursor    = 0;
+          object->exhausted = false;
+        }
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
@@ -7,6 +7,9 @@
 
 #ifdef TRITON_PYTHON_BINDINGS
 
+#include <limits>
+#include <string>
+
 #include <exceptions.hpp>
 #include <pythonBindings.hpp>
 #include <pythonUtils.hpp>
@@ -18,6 +21,57 @@ namespace triton {
   namespace bindings {
     namespace python {
 
+      /* Returns a wide integer from a PyObject, the value is converted by bytes if it does not fit in 64 bits */
+      template <typename T>
+      static T PyLong_AsWideUint(PyObject* vv, const char* name) {
+        triton::uint8 bytes[sizeof(triton::uint512)];
+        std::size_t bits = 0;
+        T x = 0;
+
+        if (vv == NULL || !PyLong_Check(vv)) {
+          if (vv != NULL && PyInt_Check(vv)) {
+              T val = PyInt_AsLong(vv);
+              return val;
+          }
+          throw triton::exceptions::Bindings(std::string(name) + ": Bad internal call.");
+        }
+
+        if (Py_SIZE(vv) < 0)
+          throw triton::exceptions::Bindings(std::string(name) + ": Cannot convert negative value to unsigned long.");
+
+        bits = _PyLong_NumBits(vv);
+        if (bits > std::numeric_limits<T>::digits)
+          throw triton::exceptions::Bindings(std::string(name) + ": long int too large to convert.");
+
+        /* Native width */
+        if (bits <= 64)
+          return static_cast<T>(PyLong_AsUnsignedLongLong(vv));
+
+        /* Little endian bytes, then limbs */
+        _PyLong_AsByteArray(reinterpret_cast<PyLongObject*>(vv), bytes, (bits + 7) / 8, 1, 0);
+        boost::multiprecision::import_bits(x, bytes, bytes + (bits + 7) / 8, 8, false);
+
+        return x;
+      }
+
+
+      /* Returns a PyObject from a wide integer, the value is converted by bytes if it does not fit in 64 bits */
+      template <typename T>
+      static PyObject* PyLong_FromWideUint(const T& value) {
+        triton::uint8 bytes[sizeof(triton::uint512)];
+        triton::uint8* end = nullptr;
+
+        /* Native width */
+        if (value <= std::numeric_limits<unsigned long long>::max())
+          return PyLong_FromUnsignedLongLong(value.template convert_to<unsigned long long>());
+
+        /* Limbs, then little endian bytes */
+        end = boost::multiprecision::export_bits(value, bytes, 8, false);
+
+        return _PyLong_FromByteArray(bytes, end - bytes, 1, 0);
+      }
+
+
       bool PyLong_AsBool(PyObject* obj) {
         return (PyObject_IsTrue(obj) != 0);
       }
@@ -144,92 +198,17 @@ namespace triton {
 
 
       triton::uint128 PyLong_AsUint128(PyObject* vv) {
-        PyLongObject* v;
-        triton::uint128 x, prev;
-        Py_ssize_t i;
-
-        if (vv == NULL || !PyLong_Check(vv)) {
-          if (vv != NULL && PyInt_Check(vv)) {
-              triton::uint128 val = PyInt_AsLong(vv);
-              return val;
-          }
-          throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint128(): Bad internal call.");
-        }
-
-        v = reinterpret_cast<PyLongObject*>(vv);
-        i = Py_SIZE(v);
-        x = 0;
-        if (i < 0)
-          throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint128(): Cannot convert negative value to unsigned long.");
-
-        while (--i >= 0) {
-            prev = x;
-            x = (x << PyLong_SHIFT) | v->ob_digit[i];
-            if ((x >> PyLong_SHIFT) != prev)
-                throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint128(): long int too large to convert.");
-        }
-
-        return x;
+        return PyLong_AsWideUint<triton::uint128>(vv, "triton::bindings::python::PyLong_AsUint128()");
       }
 
 
       triton::uint256 PyLong_AsUint256(PyObject* vv) {
-        PyLongObject* v;
-        triton::uint256 x, prev;
-        Py_ssize_t i;
-
-        if (vv == NULL || !PyLong_Check(vv)) {
-          if (vv != NULL && PyInt_Check(vv)) {
-              triton::uint256 val = PyInt_AsLong(vv);
-              return val;
-          }
-          throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint256(): Bad internal call.");
-        }
-
-        v = reinterpret_cast<PyLongObject*>(vv);
-        i = Py_SIZE(v);
-        x = 0;
-        if (i < 0)
-          throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint256(): Cannot convert negative value to unsigned long.");
-
-        while (--i >= 0) {
-            prev = x;
-            x = (x << PyLong_SHIFT) | v->ob_digit[i];
-            if ((x >> PyLong_SHIFT) != prev)
-                throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint256(): long int too large to convert.");
-        }
-
-        return x;
+        return PyLong_AsWideUint<triton::uint256>(vv, "triton::bindings::python::PyLong_AsUint256()");
       }
 
 
       triton::uint512 PyLong_AsUint512(PyObject* vv) {
-        PyLongObject* v;
-        triton::uint512 x, prev;
-        Py_ssize_t i;
-
-        if (vv == NULL || !PyLong_Check(vv)) {
-          if (vv != NULL && PyInt_Check(vv)) {
-              triton::uint512 val = PyInt_AsLong(vv);
-              return val;
-          }
-          throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint512(): Bad internal call.");
-        }
-
-        v = reinterpret_cast<PyLongObject*>(vv);
-        i = Py_SIZE(v);
-        x = 0;
-        if (i < 0)
-          throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint512(): Cannot convert negative value to unsigned long.");
-
-        while (--i >= 0) {
-            prev = x;
-            x = (x << PyLong_SHIFT) | v->ob_digit[i];
-            if ((x >> PyLong_SHIFT) != prev)
-                throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint512(): long int too large to convert.");
-        }
-
-        return x;
+        return PyLong_AsWideUint<triton::uint512>(vv, "triton::bindings::python::PyLong_AsUint512()");
       }
 
 
@@ -334,77 +313,20 @@ namespace triton {
 
 
       /* Returns a PyObject from a 128-bits integer */
-      PyObject* PyLong_FromUint128(triton::uint128 value) {
-        PyLongObject* v;
-        triton::uint128 t;
-        int ndigits = 0;
-
-        /* Count the number of Python digits. */
-        t = value;
-        while (t) {
-          ++ndigits;
-          t >>= PyLong_SHIFT;
-        }
-
-        v = _PyLong_New(ndigits);
-        digit* p = v->ob_digit;
-        Py_SIZE(v) = ndigits;
-        while (value) {
-          *p++ = (value & PyLong_MASK).convert_to<digit>();
-          value >>= PyLong_SHIFT;
-        }
-
-        return (PyObject*)v;
+      PyObject* PyLong_FromUint128(const triton::uint128& value) {
+        return PyLong_FromWideUint(value);
       }
 
 
       /* Returns a PyObject from a 256-bits integer */
-      PyObject* PyLong_FromUint256(triton::uint256 value) {
-        PyLongObject* v;
-        triton::uint256 t;
-        int ndigits = 0;
-
-        /* Count the number of Python digits. */
-        t = value;
-        while (t) {
-          ++ndigits;
-          t >>= PyLong_SHIFT;
-        }
-
-        v = _PyLong_New(ndigits);
-        digit* p = v->ob_digit;
-        Py_SIZE(v) = ndigits;
-        while (value) {
-          *p++ = (value & PyLong_MASK).convert_to<digit>();
-          value >>= PyLong_SHIFT;
-        }
-
-        return (PyObject*)v;
+      PyObject* PyLong_FromUint256(const triton::uint256& value) {
+        return PyLong_FromWideUint(value);
       }
 
 
       /* Returns a PyObject from a 512-bits integer */
-      PyObject* PyLong_FromUint512(triton::uint512 value) {
-        PyLongObject* v;
-        triton::uint512 t = 0;
-        int ndigits = 0;
-
-        /* Count the number of Python digits. */
-        t = value;
-        while (t) {
-          ++ndigits;
-          t >>= PyLong_SHIFT;
-        }
-
-        v = _PyLong_New(ndigits);
-        digit* p = v->ob_digit;
-        Py_SIZE(v) = ndigits;
-        while (value) {
-          *p++ = (value & PyLong_MASK).convert_to<digit>();
-          value >>= PyLong_SHIFT;
-        }
-
-        return (PyObject*)v;
+      PyObject* PyLong_FromUint512(const triton::uint512& value) {
+        return PyLong_FromWideUint(value);
       }
 
     }; /* python namespace */
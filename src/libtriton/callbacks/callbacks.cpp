@@ -29,10 +29,12 @@ namespace triton {
       this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
       this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
       this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
+      this->pySyscallCallbacks                  = copy.pySyscallCallbacks;
       #endif
       this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
       this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
       this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
+      this->syscallCallbacks                    = copy.syscallCallbacks;
       this->isDefined                           = copy.isDefined;
     }
 
@@ -46,10 +48,12 @@ namespace triton {
       this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
       this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
       this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
+      this->pySyscallCallbacks                  = copy.pySyscallCallbacks;
       #endif
       this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
       this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
       this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
+      this->syscallCallbacks                    = copy.syscallCallbacks;
       this->isDefined                           = copy.isDefined;
     }
 
@@ -72,6 +76,12 @@ namespace triton {
     }
 
 
+    void Callbacks::addCallback(triton::callbacks::syscallCallback cb) {
+      this->syscallCallbacks.push_back(cb);
+      this->isDefined = true;
+    }
+
+
     #ifdef TRITON_PYTHON_BINDINGS
     void Callbacks::addCallback(PyObject* function, triton::callbacks::callback_e kind) {
       switch (kind) {
@@ -84,6 +94,9 @@ namespace triton {
         case SYMBOLIC_SIMPLIFICATION:
           this->pySymbolicSimplificationCallbacks.push_back(function);
           break;
+        case SYSCALL:
+          this->pySyscallCallbacks.push_back(function);
+          break;
         default:
           throw triton::exceptions::Callbacks("Callbacks::addCallback(): Invalid kind of callback.");
       };
@@ -96,10 +109,12 @@ namespace triton {
       this->getConcreteMemoryValueCallbacks.clear();
       this->getConcreteRegisterValueCallbacks.clear();
       this->symbolicSimplificationCallbacks.clear();
+      this->syscallCallbacks.clear();
       #ifdef TRITON_PYTHON_BINDINGS
       this->pyGetConcreteMemoryValueCallbacks.clear();
       this->pyGetConcreteRegisterValueCallbacks.clear();
       this->pySymbolicSimplificationCallbacks.clear();
+      this->pySyscallCallbacks.clear();
       #endif
     }
 
@@ -125,6 +140,13 @@ namespace triton {
     }
 
 
+    void Callbacks::removeCallback(triton::callbacks::syscallCallback cb) {
+      this->syscallCallbacks.remove(cb);
+      if (this->countCallbacks() == 0)
+        this->isDefined = false;
+    }
+
+
     #ifdef TRITON_PYTHON_BINDINGS
     void Callbacks::removeCallback(PyObject* function, triton::callbacks::callback_e kind) {
       switch (kind) {
@@ -137,6 +159,9 @@ namespace triton {
         case SYMBOLIC_SIMPLIFICATION:
           this->pySymbolicSimplificationCallbacks.remove(function);
           break;
+        case SYSCALL:
+          this->pySyscallCallbacks.remove(function);
+          break;
         default:
           throw triton::exceptions::Callbacks("Callbacks::removeCallback(): Invalid kind of callback.");
       };
@@ -159,30 +184,37 @@ namespace triton {
           }
 
           #ifdef TRITON_PYTHON_BINDINGS
-          // Python callbacks
-          std::list<PyObject*>::const_iterator it2;
-          for (it2 = this->pySymbolicSimplificationCallbacks.begin(); it2 != this->pySymbolicSimplificationCallbacks.end(); it2++) {
-
-            /* Create function args */
-            PyObject* args = triton::bindings::python::xPyTuple_New(1);
-            PyTuple_SetItem(args, 0, triton::bindings::python::PyAstNode(node));
-
-            /* Call the callback */
-            PyObject* ret = PyObject_CallObject(*it2, args);
-
-            /* Check the call */
-            if (ret == nullptr) {
-              PyErr_Print();
-              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION): Fail to call the python callback.");
+          // Python callbacks, the GIL may have been released by a batch processing
+          if (!this->pySymbolicSimplificationCallbacks.empty()) {
+            std::list<PyObject*>::const_iterator it2;
+            PyGILState_STATE gstate = PyGILState_Ensure();
+            for (it2 = this->pySymbolicSimplificationCallbacks.begin(); it2 != this->pySymbolicSimplificationCallbacks.end(); it2++) {
+
+              /* Create function args */
+              PyObject* args = triton::bindings::python::xPyTuple_New(1);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyAstNode(node));
+
+              /* Call the callback */
+              PyObject* ret = PyObject_CallObject(*it2, args);
+
+              /* Check the call */
+              if (ret == nullptr) {
+                PyErr_Print();
+                PyGILState_Release(gstate);
+                throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION): Fail to call the python callback.");
+              }
+
+              /* Check if the callback has returned a AbstractNode */
+              if (!PyAstNode_Check(ret)) {
+                PyGILState_Release(gstate);
+                throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION): You must return a AstNode object.");
+              }
+
+              /* Update node */
+              node = PyAstNode_AsAstNode(ret);
+              Py_DECREF(args);
             }
-
-            /* Check if the callback has returned a AbstractNode */
-            if (!PyAstNode_Check(ret))
-              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION): You must return a AstNode object.");
-
-            /* Update node */
-            node = PyAstNode_AsAstNode(ret);
-            Py_DECREF(args);
+            PyGILState_Release(gstate);
           }
           #endif
           break;
@@ -204,24 +236,29 @@ namespace triton {
             (*it1)(const_cast<triton::arch::MemoryAccess&>(mem));
 
           #ifdef TRITON_PYTHON_BINDINGS
-          // Python callbacks
-          std::list<PyObject*>::const_iterator it2;
-          for (it2 = this->pyGetConcreteMemoryValueCallbacks.begin(); it2 != this->pyGetConcreteMemoryValueCallbacks.end(); it2++) {
-
-            /* Create function args */
-            PyObject* args = triton::bindings::python::xPyTuple_New(1);
-            PyTuple_SetItem(args, 0, triton::bindings::python::PyMemoryAccess(mem));
-
-            /* Call the callback */
-            PyObject* ret = PyObject_CallObject(*it2, args);
-
-            /* Check the call */
-            if (ret == nullptr) {
-              PyErr_Print();
-              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_MEMORY_VALUE): Fail to call the python callback.");
+          // Python callbacks, the GIL may have been released by a batch processing
+          if (!this->pyGetConcreteMemoryValueCallbacks.empty()) {
+            std::list<PyObject*>::const_iterator it2;
+            PyGILState_STATE gstate = PyGILState_Ensure();
+            for (it2 = this->pyGetConcreteMemoryValueCallbacks.begin(); it2 != this->pyGetConcreteMemoryValueCallbacks.end(); it2++) {
+
+              /* Create function args */
+              PyObject* args = triton::bindings::python::xPyTuple_New(1);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyMemoryAccess(mem));
+
+              /* Call the callback */
+              PyObject* ret = PyObject_CallObject(*it2, args);
+
+              /* Check the call */
+              if (ret == nullptr) {
+                PyErr_Print();
+                PyGILState_Release(gstate);
+                throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_MEMORY_VALUE): Fail to call the python callback.");
+              }
+
+              Py_DECREF(args);
             }
-
-            Py_DECREF(args);
+            PyGILState_Release(gstate);
           }
           #endif
           break;
@@ -242,24 +279,78 @@ namespace triton {
             (*it1)(const_cast<triton::arch::Register&>(reg));
 
           #ifdef TRITON_PYTHON_BINDINGS
-          // Python callbacks
-          std::list<PyObject*>::const_iterator it2;
-          for (it2 = this->pyGetConcreteRegisterValueCallbacks.begin(); it2 != this->pyGetConcreteRegisterValueCallbacks.end(); it2++) {
+          // Python callbacks, the GIL may have been released by a batch processing
+          if (!this->pyGetConcreteRegisterValueCallbacks.empty()) {
+            std::list<PyObject*>::const_iterator it2;
+            PyGILState_STATE gstate = PyGILState_Ensure();
+            for (it2 = this->pyGetConcreteRegisterValueCallbacks.begin(); it2 != this->pyGetConcreteRegisterValueCallbacks.end(); it2++) {
+
+              /* Create function args */
+              PyObject* args = triton::bindings::python::xPyTuple_New(1);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyRegister(reg));
+
+              /* Call the callback */
+              PyObject* ret = PyObject_CallObject(*it2, args);
+
+              /* Check the call */
+              if (ret == nullptr) {
+                PyErr_Print();
+                PyGILState_Release(gstate);
+                throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_REGISTER_VALUE): Fail to call the python callback.");
+              }
+
+              Py_DECREF(args);
+            }
+            PyGILState_Release(gstate);
+          }
+          #endif
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
 
-            /* Create function args */
-            PyObject* args = triton::bindings::python::xPyTuple_New(1);
-            PyTuple_SetItem(args, 0, triton::bindings::python::PyRegister(reg));
 
-            /* Call the callback */
-            PyObject* ret = PyObject_CallObject(*it2, args);
+    bool Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Instruction& inst) const {
+      bool ret = true;
 
-            /* Check the call */
-            if (ret == nullptr) {
-              PyErr_Print();
-              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_REGISTER_VALUE): Fail to call the python callback.");
-            }
+      switch (kind) {
+        case triton::callbacks::SYSCALL: {
+          // C++ callbacks
+          std::list<triton::callbacks::syscallCallback>::const_iterator it1;
+          for (it1 = this->syscallCallbacks.begin(); it1 != this->syscallCallbacks.end(); it1++)
+            ret &= (*it1)(const_cast<triton::arch::Instruction&>(inst));
 
-            Py_DECREF(args);
+          #ifdef TRITON_PYTHON_BINDINGS
+          // Python callbacks, the GIL may have been released by a batch processing
+          if (!this->pySyscallCallbacks.empty()) {
+            std::list<PyObject*>::const_iterator it2;
+            PyGILState_STATE gstate = PyGILState_Ensure();
+            for (it2 = this->pySyscallCallbacks.begin(); it2 != this->pySyscallCallbacks.end(); it2++) {
+
+              /* Create function args */
+              PyObject* args = triton::bindings::python::xPyTuple_New(1);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyInstruction(inst));
+
+              /* Call the callback */
+              PyObject* cbRet = PyObject_CallObject(*it2, args);
+
+              /* Check the call */
+              if (cbRet == nullptr) {
+                PyErr_Print();
+                PyGILState_Release(gstate);
+                throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYSCALL): Fail to call the python callback.");
+              }
+
+              /* The emulation goes on only if the callback has returned True */
+              ret &= (PyObject_IsTrue(cbRet) == 1);
+
+              Py_DECREF(cbRet);
+              Py_DECREF(args);
+            }
+            PyGILState_Release(gstate);
           }
           #endif
           break;
@@ -268,6 +359,8 @@ namespace triton {
         default:
           throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
       };
+
+      return ret;
     }
 
 
@@ -277,14 +370,27 @@ namespace triton {
       count += this->getConcreteMemoryValueCallbacks.size();
       count += this->getConcreteRegisterValueCallbacks.size();
       count += this->symbolicSimplificationCallbacks.size();
+      count += this->syscallCallbacks.size();
       #ifdef TRITON_PYTHON_BINDINGS
       count += this->pyGetConcreteMemoryValueCallbacks.size();
       count += this->pyGetConcreteRegisterValueCallbacks.size();
       count += this->pySymbolicSimplificationCallbacks.size();
+      count += this->pySyscallCallbacks.size();
       #endif
 
       return count;
     }
 
+
+    bool Callbacks::isSymbolicSimplificationDefined(void) const {
+      if (!this->symbolicSimplificationCallbacks.empty())
+        return true;
+      #ifdef TRITON_PYTHON_BINDINGS
+      if (!this->pySymbolicSimplificationCallbacks.empty())
+        return true;
+      #endif
+      return false;
+    }
+
   }; /* callbacks namespace */
 }; /* triton namespace */
@@ -123,8 +123,8 @@ namespace triton {
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
 
-        /* Switch into the SMT mode */
-        triton::api.setAstRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
+        /* Switch into the SMT mode, the shared nodes are printed once */
+        triton::api.setAstRepresentationMode(triton::ast::representations::SMT_DAG_REPRESENTATION);
 
         /* First, set the QF_AUFBV flag  */
         formula << "(set-logic QF_BV)";
@@ -0,0 +1,627 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#if defined(_WIN32)
+  #define NOMINMAX
+  #include <windows.h>
+#else
+  #include <dlfcn.h>
+#endif
+
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+#include <simplificationRules.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* An operator of the rules syntax */
+      struct SimplificationOperator {
+        const char*             name;
+        triton::ast::kind_e     kind;
+        triton::uint32          operands;     /* 0 means at least two operands */
+        triton::uint32          parameters;   /* Leading decimal childs: ((_ extract h l) x) */
+        bool                    commutative;
+      };
+
+
+      static const SimplificationOperator operators[] = {
+        {"=",             triton::ast::EQUAL_NODE,    2, 0, true},
+        {"and",           triton::ast::LAND_NODE,     2, 0, true},
+        {"bvadd",         triton::ast::BVADD_NODE,    2, 0, true},
+        {"bvand",         triton::ast::BVAND_NODE,    2, 0, true},
+        {"bvashr",        triton::ast::BVASHR_NODE,   2, 0, false},
+        {"bvlshr",        triton::ast::BVLSHR_NODE,   2, 0, false},
+        {"bvmul",         triton::ast::BVMUL_NODE,    2, 0, true},
+        {"bvnand",        triton::ast::BVNAND_NODE,   2, 0, true},
+        {"bvneg",         triton::ast::BVNEG_NODE,    1, 0, false},
+        {"bvnor",         triton::ast::BVNOR_NODE,    2, 0, true},
+        {"bvnot",         triton::ast::BVNOT_NODE,    1, 0, false},
+        {"bvor",          triton::ast::BVOR_NODE,     2, 0, true},
+        {"bvsdiv",        triton::ast::BVSDIV_NODE,   2, 0, false},
+        {"bvsge",         triton::ast::BVSGE_NODE,    2, 0, false},
+        {"bvsgt",         triton::ast::BVSGT_NODE,    2, 0, false},
+        {"bvshl",         triton::ast::BVSHL_NODE,    2, 0, false},
+        {"bvsle",         triton::ast::BVSLE_NODE,    2, 0, false},
+        {"bvslt",         triton::ast::BVSLT_NODE,    2, 0, false},
+        {"bvsmod",        triton::ast::BVSMOD_NODE,   2, 0, false},
+        {"bvsrem",        triton::ast::BVSREM_NODE,   2, 0, false},
+        {"bvsub",         triton::ast::BVSUB_NODE,    2, 0, false},
+        {"bvudiv",        triton::ast::BVUDIV_NODE,   2, 0, false},
+        {"bvuge",         triton::ast::BVUGE_NODE,    2, 0, false},
+        {"bvugt",         triton::ast::BVUGT_NODE,    2, 0, false},
+        {"bvule",         triton::ast::BVULE_NODE,    2, 0, false},
+        {"bvult",         triton::ast::BVULT_NODE,    2, 0, false},
+        {"bvurem",        triton::ast::BVUREM_NODE,   2, 0, false},
+        {"bvxnor",        triton::ast::BVXNOR_NODE,   2, 0, true},
+        {"bvxor",         triton::ast::BVXOR_NODE,    2, 0, true},
+        {"concat",        triton::ast::CONCAT_NODE,   0, 0, false},
+        {"distinct",      triton::ast::DISTINCT_NODE, 2, 0, true},
+        {"extract",       triton::ast::EXTRACT_NODE,  1, 2, false},
+        {"ite",           triton::ast::ITE_NODE,      3, 0, false},
+        {"not",           triton::ast::LNOT_NODE,     1, 0, false},
+        {"or",            triton::ast::LOR_NODE,      2, 0, true},
+        {"rotate_left",   triton::ast::BVROL_NODE,    1, 1, false},
+        {"rotate_right",  triton::ast::BVROR_NODE,    1, 1, false},
+        {"sign_extend",   triton::ast::SX_NODE,       1, 1, false},
+        {"zero_extend",   triton::ast::ZX_NODE,       1, 1, false},
+      };
+
+
+      static const SimplificationOperator* getOperator(const std::string& name) {
+        for (triton::usize index = 0; index < sizeof(operators) / sizeof(operators[0]); index++) {
+          if (name == operators[index].name)
+            return &operators[index];
+        }
+        return nullptr;
+      }
+
+
+      static const SimplificationOperator* getOperator(triton::ast::kind_e kind) {
+        for (triton::usize index = 0; index < sizeof(operators) / sizeof(operators[0]); index++) {
+          if (kind == operators[index].kind)
+            return &operators[index];
+        }
+        return nullptr;
+      }
+
+
+      /* Returns true if the childs of the node are the ones expected by the operator */
+      static bool isWellFormed(const SimplificationOperator* op, triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+
+        if (op->operands == 0 && childs.size() < 2)
+          return false;
+
+        if (op->operands && childs.size() != op->operands + op->parameters)
+          return false;
+
+        for (triton::uint32 index = 0; index < op->parameters; index++) {
+          if (childs[index]->getKind() != triton::ast::DECIMAL_NODE)
+            return false;
+        }
+
+        return true;
+      }
+
+
+      static triton::uint32 getParameter(triton::ast::AbstractNode* node, triton::uint32 index) {
+        return reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[index])->getValue().convert_to<triton::uint32>();
+      }
+
+
+      /* Returns true if a constant pattern matches a bitvector of the node size */
+      static bool isMatchingConstant(const SimplificationPattern& pattern, triton::ast::AbstractNode* node) {
+        if (node->getKind() != triton::ast::BV_NODE)
+          return false;
+
+        if (pattern.size && pattern.size != node->getBitvectorSize())
+          return false;
+
+        triton::uint512 mask = node->getBitvectorMask();
+        triton::uint512 high = pattern.value & ~mask;
+
+        /* The bits out of the node must be a zero or a sign extension */
+        if (high != 0 && high != (~mask))
+          return false;
+
+        return ((pattern.value & mask) == node->evaluate());
+      }
+
+
+      /* Matches the pending pairs, the last one first. Bindings are restored on failure. */
+      static bool matchPending(std::vector<std::pair<const SimplificationPattern*, triton::ast::AbstractNode*>> pending, std::vector<triton::ast::AbstractNode*>& bindings) {
+        if (pending.empty())
+          return true;
+
+        const SimplificationPattern* pattern = pending.back().first;
+        triton::ast::AbstractNode* node      = pending.back().second;
+        pending.pop_back();
+
+        switch (pattern->type) {
+
+          case SimplificationPattern::PATTERN_VARIABLE: {
+            triton::ast::AbstractNode*& bound = bindings[pattern->variable];
+            if (bound != nullptr) {
+              if (bound != node && !(*bound == *node))
+                return false;
+              return matchPending(pending, bindings);
+            }
+            bound = node;
+            if (matchPending(pending, bindings))
+              return true;
+            bindings[pattern->variable] = nullptr;
+            return false;
+          }
+
+          case SimplificationPattern::PATTERN_CONSTANT:
+            if (!isMatchingConstant(*pattern, node))
+              return false;
+            return matchPending(pending, bindings);
+
+          case SimplificationPattern::PATTERN_NODE: {
+            if (node->getKind() != pattern->kind)
+              return false;
+
+            const SimplificationOperator* op = getOperator(pattern->kind);
+            std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+
+            if (!isWellFormed(op, node) || childs.size() != pattern->parameters.size() + pattern->childs.size())
+              return false;
+
+            for (triton::uint32 index = 0; index < pattern->parameters.size(); index++) {
+              if (getParameter(node, index) != pattern->parameters[index])
+                return false;
+            }
+
+            /* Operands are pushed in reverse order, thus the first one is matched first */
+            triton::usize base = pattern->parameters.size();
+            triton::usize size = pending.size();
+            for (triton::usize index = pattern->childs.size(); index > 0; index--)
+              pending.push_back(std::make_pair(&pattern->childs[index - 1], childs[base + index - 1]));
+            if (matchPending(pending, bindings))
+              return true;
+
+            if (!op->commutative)
+              return false;
+
+            /* Commutative operators are also matched with their operands swapped */
+            pending.resize(size);
+            pending.push_back(std::make_pair(&pattern->childs[0], childs[base + 1]));
+            pending.push_back(std::make_pair(&pattern->childs[1], childs[base]));
+            return matchPending(pending, bindings);
+          }
+
+          default:
+            return false;
+        }
+      }
+
+
+      /* Splits a rule into tokens. A ';' starts a comment up to the end of the text. */
+      static std::vector<std::string> tokenize(const std::string& text) {
+        std::vector<std::string> tokens;
+        std::string token;
+
+        for (triton::usize index = 0; index < text.size(); index++) {
+          char c = text[index];
+          if (c == ';')
+            break;
+          if (std::isspace(static_cast<unsigned char>(c)) || c == '(' || c == ')') {
+            if (!token.empty())
+              tokens.push_back(token);
+            token.clear();
+            if (c == '(' || c == ')')
+              tokens.push_back(std::string(1, c));
+            continue;
+          }
+          token += c;
+        }
+
+        if (!token.empty())
+          tokens.push_back(token);
+
+        return tokens;
+      }
+
+
+      static bool isInteger(const std::string& token) {
+        triton::usize index = (token[0] == '-') ? 1 : 0;
+        return (index < token.size() && std::isdigit(static_cast<unsigned char>(token[index])));
+      }
+
+
+      static triton::uint512 parseInteger(const std::string& token) {
+        bool negative = (token[0] == '-');
+        triton::uint512 value = 0;
+
+        try {
+          value.assign(negative ? token.substr(1) : token);
+        }
+        catch (const std::exception&) {
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Invalid integer " + token + ".");
+        }
+
+        /* Two's complement on 512 bits */
+        if (negative)
+          value = ~value + 1;
+
+        return value;
+      }
+
+
+      static const std::string& nextToken(const std::vector<std::string>& tokens, triton::usize& index) {
+        if (index >= tokens.size())
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Unexpected end of rule.");
+        return tokens[index++];
+      }
+
+
+      static void expectToken(const std::vector<std::string>& tokens, triton::usize& index, const char* expected) {
+        if (nextToken(tokens, index) != expected)
+          throw triton::exceptions::SymbolicSimplification(std::string("SimplificationRules::addRule(): Expected '") + expected + "'.");
+      }
+
+
+      /* Parses a pattern. The variables of the left side are declared, the ones of the right side must exist. */
+      static SimplificationPattern parsePattern(const std::vector<std::string>& tokens, triton::usize& index, SimplificationRule& rule, bool lhs) {
+        SimplificationPattern pattern;
+        const std::string& token = nextToken(tokens, index);
+
+        if (token == ")" || token == "->")
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Unexpected '" + token + "'.");
+
+        /* Atoms: integers and variables */
+        if (token != "(") {
+          if (isInteger(token)) {
+            pattern.type  = SimplificationPattern::PATTERN_CONSTANT;
+            pattern.value = parseInteger(token);
+            return pattern;
+          }
+
+          if (getOperator(token) != nullptr || token == "_")
+            throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): The operator " + token + " must be in parentheses.");
+
+          std::vector<std::string>::iterator it = std::find(rule.variables.begin(), rule.variables.end(), token);
+          if (it == rule.variables.end() && !lhs)
+            throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): The variable " + token + " is not defined by the left side.");
+          if (it == rule.variables.end())
+            it = rule.variables.insert(rule.variables.end(), token);
+
+          pattern.type     = SimplificationPattern::PATTERN_VARIABLE;
+          pattern.variable = static_cast<triton::uint32>(it - rule.variables.begin());
+          return pattern;
+        }
+
+        const SimplificationOperator* op = nullptr;
+        const std::string& head = nextToken(tokens, index);
+
+        /* (_ bvV S) */
+        if (head == "_") {
+          const std::string& value = nextToken(tokens, index);
+          const std::string& size  = nextToken(tokens, index);
+          if (value.size() < 3 || value.compare(0, 2, "bv") != 0 || !isInteger(value.substr(2)) || !isInteger(size) || size[0] == '-')
+            throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Invalid bitvector, expected (_ bvV S).");
+          expectToken(tokens, index, ")");
+          pattern.type  = SimplificationPattern::PATTERN_CONSTANT;
+          pattern.value = parseInteger(value.substr(2));
+          pattern.size  = parseInteger(size).convert_to<triton::uint32>();
+          if (pattern.size == 0 || pattern.size > MAX_BITS_SUPPORTED)
+            throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Invalid bitvector size.");
+          return pattern;
+        }
+
+        /* ((_ extract h l) x), ((_ zero_extend n) x), ... */
+        if (head == "(") {
+          expectToken(tokens, index, "_");
+          op = getOperator(nextToken(tokens, index));
+          if (op == nullptr || op->parameters == 0)
+            throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Unknown indexed operator.");
+          for (triton::uint32 param = 0; param < op->parameters; param++) {
+            const std::string& value = nextToken(tokens, index);
+            if (!isInteger(value) || value[0] == '-')
+              throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Invalid index " + value + ".");
+            pattern.parameters.push_back(parseInteger(value).convert_to<triton::uint32>());
+          }
+          expectToken(tokens, index, ")");
+        }
+        else {
+          op = getOperator(head);
+          if (op == nullptr || op->parameters != 0)
+            throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Unknown operator " + head + ".");
+        }
+
+        pattern.type = SimplificationPattern::PATTERN_NODE;
+        pattern.kind = op->kind;
+
+        while (index < tokens.size() && tokens[index] != ")")
+          pattern.childs.push_back(parsePattern(tokens, index, rule, lhs));
+        expectToken(tokens, index, ")");
+
+        if ((op->operands && pattern.childs.size() != op->operands) || (op->operands == 0 && pattern.childs.size() < 2))
+          throw triton::exceptions::SymbolicSimplification(std::string("SimplificationRules::addRule(): Invalid number of operands for ") + op->name + ".");
+
+        return pattern;
+      }
+
+
+
+      SimplificationPattern::SimplificationPattern() {
+        this->kind      = triton::ast::UNDEFINED_NODE;
+        this->size      = 0;
+        this->type      = PATTERN_CONSTANT;
+        this->value     = 0;
+        this->variable  = 0;
+      }
+
+
+      SimplificationRules::SimplificationRules() {
+      }
+
+
+      SimplificationRules::SimplificationRules(const SimplificationRules& copy) {
+        this->copy(copy);
+      }
+
+
+      SimplificationRules::~SimplificationRules() {
+      }
+
+
+      void SimplificationRules::copy(const SimplificationRules& other) {
+        this->nativeRules = other.nativeRules;
+        this->rules       = other.rules;
+        this->rulesByKind = other.rulesByKind;
+      }
+
+
+      bool SimplificationRules::isEmpty(void) const {
+        return (this->rules.empty() && this->nativeRules.empty());
+      }
+
+
+      void SimplificationRules::addRule(const std::string& rule) {
+        std::vector<std::string> tokens = tokenize(rule);
+        SimplificationRule r;
+        triton::usize index = 0;
+
+        if (tokens.empty())
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Empty rule.");
+
+        r.lhs = parsePattern(tokens, index, r, true);
+        expectToken(tokens, index, "->");
+        r.rhs = parsePattern(tokens, index, r, false);
+
+        if (index != tokens.size())
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): Unexpected tokens after the right side.");
+
+        if (r.lhs.type != SimplificationPattern::PATTERN_NODE)
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): The left side must be an operator.");
+
+        /* Keeps the rule as written, without its comment */
+        r.text = rule.substr(0, rule.find(';'));
+        r.text.erase(0, r.text.find_first_not_of(" \t\r\n"));
+        r.text.erase(r.text.find_last_not_of(" \t\r\n") + 1);
+
+        this->rulesByKind[r.lhs.kind].push_back(this->rules.size());
+        this->rules.push_back(r);
+      }
+
+
+      void SimplificationRules::addRule(triton::callbacks::symbolicSimplificationCallback cb) {
+        if (cb == nullptr)
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::addRule(): The callback cannot be null.");
+        this->nativeRules.push_back(cb);
+      }
+
+
+      triton::usize SimplificationRules::loadRules(const std::string& path) {
+        std::ifstream file(path.c_str());
+        std::string line;
+        triton::usize count = 0;
+        triton::usize number = 0;
+
+        if (!file.is_open())
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::loadRules(): Cannot open " + path + ".");
+
+        while (std::getline(file, line)) {
+          number++;
+          if (tokenize(line).empty())
+            continue;
+          try {
+            this->addRule(line);
+          }
+          catch (const triton::exceptions::SymbolicSimplification& e) {
+            std::ostringstream message;
+            message << path << ":" << number << ": " << e.what();
+            throw triton::exceptions::SymbolicSimplification(message.str());
+          }
+          count++;
+        }
+
+        return count;
+      }
+
+
+      void SimplificationRules::loadPlugin(const std::string& path) {
+        simplificationPluginEntry entry = nullptr;
+
+        #if defined(_WIN32)
+        HMODULE handle = LoadLibraryA(path.c_str());
+        if (handle == nullptr)
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::loadPlugin(): Cannot load " + path + ".");
+        entry = reinterpret_cast<simplificationPluginEntry>(GetProcAddress(handle, SIMPLIFICATION_PLUGIN_ENTRY));
+        #else
+        void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if (handle == nullptr)
+          throw triton::exceptions::SymbolicSimplification(std::string("SimplificationRules::loadPlugin(): ") + dlerror());
+        entry = reinterpret_cast<simplificationPluginEntry>(dlsym(handle, SIMPLIFICATION_PLUGIN_ENTRY));
+        #endif
+
+        if (entry == nullptr)
+          throw triton::exceptions::SymbolicSimplification(std::string("SimplificationRules::loadPlugin(): The plugin does not export ") + SIMPLIFICATION_PLUGIN_ENTRY + ".");
+
+        entry(this);
+      }
+
+
+      std::vector<std::string> SimplificationRules::getRules(void) const {
+        std::vector<std::string> ret;
+        for (triton::usize index = 0; index < this->rules.size(); index++)
+          ret.push_back(this->rules[index].text);
+        return ret;
+      }
+
+
+      void SimplificationRules::clear(void) {
+        this->nativeRules.clear();
+        this->rules.clear();
+        this->rulesByKind.clear();
+      }
+
+
+      bool SimplificationRules::match(const SimplificationPattern& pattern, triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& bindings) const {
+        std::vector<std::pair<const SimplificationPattern*, triton::ast::AbstractNode*>> pending;
+        pending.push_back(std::make_pair(&pattern, node));
+        return matchPending(pending, bindings);
+      }
+
+
+      triton::ast::AbstractNode* SimplificationRules::build(const SimplificationPattern& pattern, const std::vector<triton::ast::AbstractNode*>& bindings, triton::uint32 size) const {
+        switch (pattern.type) {
+          case SimplificationPattern::PATTERN_VARIABLE:
+            return bindings[pattern.variable];
+
+          case SimplificationPattern::PATTERN_CONSTANT: {
+            triton::uint32 bvSize = pattern.size ? pattern.size : size;
+            triton::uint512 mask  = -1;
+            return triton::ast::bv(pattern.value & (mask >> (512 - bvSize)), bvSize);
+          }
+
+          default:
+            break;
+        }
+
+        std::vector<triton::ast::AbstractNode*> childs(pattern.childs.size(), nullptr);
+
+        /* Constants take the size of their first sibling which is not a constant (the condition of an ite excepted) */
+        triton::uint32 first = (pattern.kind == triton::ast::ITE_NODE) ? 1 : 0;
+        triton::uint32 childSize = size;
+        for (triton::uint32 index = 0; index < pattern.childs.size(); index++) {
+          if (pattern.childs[index].type != SimplificationPattern::PATTERN_CONSTANT) {
+            childs[index] = this->build(pattern.childs[index], bindings, size);
+            if (index >= first && childSize == size)
+              childSize = childs[index]->getBitvectorSize();
+          }
+        }
+
+        for (triton::uint32 index = 0; index < pattern.childs.size(); index++) {
+          if (childs[index] == nullptr)
+            childs[index] = this->build(pattern.childs[index], bindings, childSize);
+        }
+
+        /* Indexes come first, as DECIMAL_NODE childs */
+        for (triton::usize index = pattern.parameters.size(); index > 0; index--)
+          childs.insert(childs.begin(), triton::ast::decimal(pattern.parameters[index - 1]));
+
+        return triton::ast::buildNode(pattern.kind, childs);
+      }
+
+
+      triton::ast::AbstractNode* SimplificationRules::rewrite(triton::ast::AbstractNode* node) const {
+        std::map<triton::uint32, std::vector<triton::usize>>::const_iterator it = this->rulesByKind.find(node->getKind());
+
+        if (it != this->rulesByKind.end()) {
+          std::vector<triton::ast::AbstractNode*> bindings;
+          for (triton::usize index = 0; index < it->second.size(); index++) {
+            const SimplificationRule& rule = this->rules[it->second[index]];
+            bindings.assign(rule.variables.size(), nullptr);
+            if (!this->match(rule.lhs, node, bindings))
+              continue;
+            /* A rule which builds an invalid or a resized node is ignored */
+            try {
+              triton::ast::AbstractNode* simplified = this->build(rule.rhs, bindings, node->getBitvectorSize());
+              if (simplified->getBitvectorSize() == node->getBitvectorSize())
+                return simplified;
+            }
+            catch (const triton::exceptions::Ast&) {
+            }
+          }
+        }
+
+        for (std::list<triton::callbacks::symbolicSimplificationCallback>::const_iterator cb = this->nativeRules.begin(); cb != this->nativeRules.end(); cb++) {
+          triton::ast::AbstractNode* simplified = (*cb)(node);
+          if (simplified != nullptr && simplified != node)
+            return simplified;
+        }
+
+        return node;
+      }
+
+
+      triton::ast::AbstractNode* SimplificationRules::visit(triton::ast::AbstractNode* node, std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& cache, triton::uint32 depth) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>::iterator it = cache.find(node);
+        if (it != cache.end())
+          return it->second;
+
+        triton::ast::AbstractNode* result = node;
+        const SimplificationOperator* op  = getOperator(node->getKind());
+
+        /* Childs first. References are not followed, their expressions have already been simplified. */
+        if (op != nullptr && isWellFormed(op, node)) {
+          std::vector<triton::ast::AbstractNode*> childs = node->getChilds();
+          bool changed = false;
+
+          for (triton::uint32 index = op->parameters; index < childs.size(); index++) {
+            triton::ast::AbstractNode* child = this->visit(childs[index], cache, depth);
+            changed |= (child != childs[index]);
+            childs[index] = child;
+          }
+
+          if (changed)
+            result = triton::ast::buildNode(node->getKind(), childs);
+        }
+
+        /* The rewritten node may match other rules, up to SIMPLIFICATION_MAX_REWRITES */
+        triton::ast::AbstractNode* rewritten = this->rewrite(result);
+        if (rewritten != result)
+          result = (depth < SIMPLIFICATION_MAX_REWRITES) ? this->visit(rewritten, cache, depth + 1) : rewritten;
+
+        cache[node] = result;
+        return result;
+      }
+
+
+      triton::ast::AbstractNode* SimplificationRules::apply(triton::ast::AbstractNode* node) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> cache;
+
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicSimplification("SimplificationRules::apply(): node cannot be null.");
+
+        if (this->isEmpty())
+          return node;
+
+        return this->visit(node, cache, 0);
+      }
+
+
+      void SimplificationRules::operator=(const SimplificationRules& other) {
+        this->copy(other);
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
@@ -6,8 +6,11 @@
 */
 
 #include <cstring>
+#include <sstream>
+#include <tuple>
 
 #include <api.hpp>
+#include <astSerialization.hpp>
 #include <exceptions.hpp>
 #include <coreUtils.hpp>
 #include <symbolicEngine.hpp>
@@ -61,6 +64,10 @@ There also exists an important point, if there is no previous symbolic reference
 the instruction is processed, Triton builds the expression with the concretization of the value and assigns the
 expression to a new symbolic reference. This allows us to start the analysis everywhere.
 
+The whole symbolic state may be written into a compact binary file by `saveSymbolicState()` and restored later,
+or on another machine, by `loadSymbolicState()`. The ASTs of all the expressions and path constraints are written
+as a single node table, thus a node shared by several expressions is written once (see triton::ast::serialize()).
+
 */
 
 
@@ -82,6 +89,7 @@ namespace triton {
 
         this->backupFlag      = isBackup;
         this->enableFlag      = true;
+        this->foldedSymExprId = 0;
         this->uniqueSymExprId = 0;
         this->uniqueSymVarId  = 0;
       }
@@ -103,6 +111,7 @@ namespace triton {
         this->backupFlag                  = true;
         this->alignedMemoryReference      = other.alignedMemoryReference;
         this->enableFlag                  = other.enableFlag;
+        this->foldedSymExprId             = other.foldedSymExprId;
         this->memoryReference             = other.memoryReference;
         this->symbolicExpressions         = other.symbolicExpressions;
         this->symbolicVariables           = other.symbolicVariables;
@@ -113,6 +122,7 @@ namespace triton {
 
       SymbolicEngine::SymbolicEngine(const SymbolicEngine& copy)
         : triton::ast::AstDictionaries(copy),
+          triton::ast::AstFolding(copy),
           triton::engines::symbolic::SymbolicOptimization(copy),
           triton::engines::symbolic::SymbolicSimplification(copy),
           triton::engines::symbolic::PathManager(copy) {
@@ -122,6 +132,7 @@ namespace triton {
 
       void SymbolicEngine::operator=(const SymbolicEngine& other) {
         triton::ast::AstDictionaries::operator=(other);
+        triton::ast::AstFolding::operator=(other);
         triton::engines::symbolic::SymbolicOptimization::operator=(other);
         triton::engines::symbolic::SymbolicSimplification::operator=(other);
         triton::engines::symbolic::PathManager::operator=(other);
@@ -371,6 +382,8 @@ namespace triton {
       /* Creates a new symbolic expression with comment */
       SymbolicExpression* SymbolicEngine::newSymbolicExpression(triton::ast::AbstractNode* node, triton::engines::symbolic::symkind_e kind, const std::string& comment) {
         triton::usize id = this->getUniqueSymExprId();
+        if (this->isOptimizationEnabled(triton::engines::symbolic::AST_FOLDING))
+          node = this->foldAst(node);
         node = this->processSimplification(node);
         SymbolicExpression* expr = new SymbolicExpression(node, id, kind, comment);
         if (expr == nullptr)
@@ -385,6 +398,17 @@ namespace triton {
         std::map<triton::uint64, triton::usize>::iterator it;
 
         if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
+          /* A register expression may only be assigned to its origin register (the memory only references byte expressions) */
+          const triton::arch::Register& origin = this->symbolicExpressions[symExprId]->getOriginRegister();
+          if (this->symbolicExpressions[symExprId]->getKind() == triton::engines::symbolic::REG && origin.isValid()) {
+            triton::uint32 parentId = origin.getParent().getId();
+            if (parentId < this->numberOfRegisters && this->symbolicReg[parentId] == symExprId)
+              this->symbolicReg[parentId] = triton::engines::symbolic::UNSET;
+            delete this->symbolicExpressions[symExprId];
+            this->symbolicExpressions.erase(symExprId);
+            return;
+          }
+
           /* Delete and remove the pointer */
           delete this->symbolicExpressions[symExprId];
           this->symbolicExpressions.erase(symExprId);
@@ -409,6 +433,25 @@ namespace triton {
       }
 
 
+      /* Folds the symbolic expressions created since the last call */
+      triton::usize SymbolicEngine::foldSymbolicExpressions(void) {
+        std::map<triton::usize, SymbolicExpression*>::iterator it;
+        triton::usize count = 0;
+
+        for (it = this->symbolicExpressions.lower_bound(this->foldedSymExprId); it != this->symbolicExpressions.end(); it++) {
+          triton::ast::AbstractNode* node = it->second->getAst();
+          triton::ast::AbstractNode* folded = this->foldAst(node);
+          if (folded != node) {
+            it->second->setAst(folded);
+            count++;
+          }
+        }
+
+        this->foldedSymExprId = this->uniqueSymExprId;
+        return count;
+      }
+
+
       /* Gets the symbolic expression pointer from a symbolic id */
       SymbolicExpression* SymbolicEngine::getSymbolicExpressionFromId(triton::usize symExprId) const {
         if (this->symbolicExpressions.find(symExprId) == this->symbolicExpressions.end())
@@ -425,18 +468,18 @@ namespace triton {
 
       /* Returns the full symbolic expression backtracked. */
       triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
-
-        for (triton::uint32 index = 0; index < childs.size(); index++) {
-          if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
-            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
-            triton::ast::AbstractNode* ref = this->getSymbolicExpressionFromId(id)->getAst();
-            childs[index] = ref;
-            if (processed.find(id) != processed.end())
-              continue;
-            processed.insert(id);
+        std::vector<triton::ast::AbstractNode*> nodes = triton::ast::nodesExtraction(node, true);
+
+        /* Each node reachable through the references is visited once, its references are replaced by the ASTs they point to */
+        for (std::vector<triton::ast::AbstractNode*>::iterator it = nodes.begin(); it != nodes.end(); it++) {
+          std::vector<triton::ast::AbstractNode*>& childs = (*it)->getChilds();
+          for (triton::uint32 index = 0; index < childs.size(); index++) {
+            while (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
+              childs[index] = this->getSymbolicExpressionFromId(id)->getAst();
+              processed.insert(id);
+            }
           }
-          this->getFullAst(childs[index], processed);
         }
 
         return node;
@@ -495,6 +538,12 @@ namespace triton {
       }
 
 
+      /* Returns the map of symbolic memory references */
+      const std::map<triton::uint64, triton::usize>& SymbolicEngine::getSymbolicMemoryReferences(void) const {
+        return this->memoryReference;
+      }
+
+
       /*
        * Converts an expression id to a symbolic variable.
        * e.g:
@@ -950,6 +999,258 @@ namespace triton {
       }
 
 
+      /* Writes the symbolic state, the ASTs of the expressions come first in the roots of the node table, then the ones of the branches */
+      void SymbolicEngine::saveSymbolicState(std::ostream& stream) const {
+        std::vector<triton::ast::AbstractNode*> roots;
+        std::ostringstream state;
+        std::ostringstream variables;
+        std::ostringstream nodes;
+        std::ostringstream expressions;
+        std::ostringstream registers;
+        std::ostringstream memory;
+        std::ostringstream constraints;
+        triton::uint64 previous = 0;
+
+        triton::ast::writeVarint(state, static_cast<triton::uint64>(triton::api.getArchitecture()));
+        triton::ast::writeVarint(state, static_cast<triton::uint64>(this->numberOfRegisters));
+        triton::ast::writeVarint(state, static_cast<triton::uint64>(this->uniqueSymExprId));
+        triton::ast::writeVarint(state, static_cast<triton::uint64>(this->uniqueSymVarId));
+        triton::ast::writeVarint(state, static_cast<triton::uint64>(this->foldedSymExprId));
+
+        triton::ast::writeVarint(variables, static_cast<triton::uint64>(this->symbolicVariables.size()));
+        for (auto it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++) {
+          const SymbolicVariable* symVar = it->second;
+          triton::ast::writeVarint(variables, static_cast<triton::uint64>(symVar->getId()));
+          triton::ast::writeVarint(variables, static_cast<triton::uint64>(symVar->getKind()));
+          triton::ast::writeVarint(variables, symVar->getKindValue());
+          triton::ast::writeVarint(variables, static_cast<triton::uint64>(symVar->getSize()));
+          triton::ast::writeString(variables, symVar->getComment());
+          triton::ast::writeVarint(variables, symVar->getConcreteValue());
+        }
+
+        triton::ast::writeVarint(expressions, static_cast<triton::uint64>(this->symbolicExpressions.size()));
+        for (auto it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
+          const SymbolicExpression* expr = it->second;
+          triton::ast::writeVarint(expressions, static_cast<triton::uint64>(expr->getId()));
+          triton::ast::writeVarint(expressions, static_cast<triton::uint64>(expr->getKind()));
+          triton::ast::writeString(expressions, expr->getComment());
+          triton::ast::writeVarint(expressions, static_cast<triton::uint64>(expr->getOriginRegister().getId()));
+          triton::ast::writeVarint(expressions, expr->getOriginMemory().getAddress());
+          triton::ast::writeVarint(expressions, static_cast<triton::uint64>(expr->getOriginMemory().getSize()));
+          triton::ast::writeVarint(expressions, static_cast<triton::uint64>(expr->isTainted));
+          roots.push_back(expr->getAst());
+        }
+
+        /* UNSET is written as 0 */
+        triton::ast::writeVarint(registers, static_cast<triton::uint64>(this->numberOfRegisters));
+        for (triton::uint32 index = 0; index < this->numberOfRegisters; index++)
+          triton::ast::writeVarint(registers, static_cast<triton::uint64>(this->symbolicReg[index] + 1));
+
+        /* The addresses are sorted, only their distances are written */
+        triton::ast::writeVarint(memory, static_cast<triton::uint64>(this->memoryReference.size()));
+        for (auto it = this->memoryReference.begin(); it != this->memoryReference.end(); it++) {
+          triton::ast::writeVarint(memory, it->first - previous);
+          triton::ast::writeVarint(memory, static_cast<triton::uint64>(it->second));
+          previous = it->first;
+        }
+
+        triton::ast::writeVarint(constraints, static_cast<triton::uint64>(this->pathConstraints.size()));
+        for (const PathConstraint& pco : this->pathConstraints) {
+          const std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::AbstractNode*>>& branches = pco.getBranchConstraints();
+          triton::ast::writeVarint(constraints, static_cast<triton::uint64>(branches.size()));
+          for (auto& branch : branches) {
+            triton::ast::writeVarint(constraints, static_cast<triton::uint64>(std::get<0>(branch)));
+            triton::ast::writeVarint(constraints, std::get<1>(branch));
+            triton::ast::writeVarint(constraints, std::get<2>(branch));
+            roots.push_back(std::get<3>(branch));
+          }
+        }
+
+        triton::ast::writeNodeTable(nodes, roots);
+
+        triton::ast::writeHeader(stream);
+        triton::ast::writeSection(stream, triton::ast::SECTION_STATE, state.str());
+        triton::ast::writeSection(stream, triton::ast::SECTION_VARIABLES, variables.str());
+        triton::ast::writeSection(stream, triton::ast::SECTION_AST, nodes.str());
+        triton::ast::writeSection(stream, triton::ast::SECTION_EXPRESSIONS, expressions.str());
+        triton::ast::writeSection(stream, triton::ast::SECTION_REGISTERS, registers.str());
+        triton::ast::writeSection(stream, triton::ast::SECTION_MEMORY, memory.str());
+        triton::ast::writeSection(stream, triton::ast::SECTION_PATH_CONSTRAINTS, constraints.str());
+        triton::ast::writeSection(stream, triton::ast::SECTION_END, "");
+      }
+
+
+      /*
+       * Replaces the symbolic state. All the sections are decoded before the engine is changed. The ASTs
+       * need the new variables and expressions to be installed, thus the current ones are swapped out while
+       * the nodes are rebuilt and are restored if the state is invalid.
+       */
+      void SymbolicEngine::loadSymbolicState(std::istream& stream) {
+        std::map<triton::ast::serialization_section_e, std::string> sections;
+        std::map<triton::usize, SymbolicVariable*> variables;
+        std::map<triton::usize, SymbolicExpression*> expressions;
+        std::map<triton::uint64, triton::usize> memoryReference;
+        std::vector<triton::usize> symbolicReg;
+        std::vector<PathConstraint> pathConstraints;
+        std::vector<triton::ast::AbstractNode*> roots;
+        std::string payload;
+
+        triton::ast::readHeader(stream);
+        for (triton::ast::serialization_section_e kind = triton::ast::readSection(stream, payload); kind != triton::ast::SECTION_END; kind = triton::ast::readSection(stream, payload))
+          sections[kind].swap(payload);
+
+        for (triton::uint32 kind = triton::ast::SECTION_AST; kind <= triton::ast::SECTION_PATH_CONSTRAINTS; kind++) {
+          if (sections.find(static_cast<triton::ast::serialization_section_e>(kind)) == sections.end())
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::loadSymbolicState(): Missing section.");
+        }
+
+        std::istringstream state(sections[triton::ast::SECTION_STATE]);
+        if (triton::ast::readVarint(state) != triton::api.getArchitecture())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::loadSymbolicState(): The architecture does not match.");
+
+        if (triton::ast::readVarint(state) != this->numberOfRegisters)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::loadSymbolicState(): The number of registers does not match.");
+
+        triton::usize uniqueSymExprId = triton::ast::readVarint(state);
+        triton::usize uniqueSymVarId  = triton::ast::readVarint(state);
+        triton::usize foldedSymExprId = triton::ast::readVarint(state);
+
+        /* The expressions are created as soon as their AST is rebuilt, the references need them */
+        struct ExpressionRecord {
+          triton::usize id;
+          symkind_e kind;
+          std::string comment;
+          triton::uint32 regId;
+          triton::uint64 address;
+          triton::uint32 size;
+          bool isTainted;
+        };
+
+        std::istringstream expressionsSection(sections[triton::ast::SECTION_EXPRESSIONS]);
+        std::vector<ExpressionRecord> records;
+        for (triton::uint64 count = triton::ast::readVarint(expressionsSection); count > 0; count--) {
+          ExpressionRecord record;
+          record.id         = triton::ast::readVarint(expressionsSection);
+          record.kind       = static_cast<symkind_e>(triton::ast::readVarint(expressionsSection));
+          record.comment    = triton::ast::readString(expressionsSection);
+          record.regId      = static_cast<triton::uint32>(triton::ast::readVarint(expressionsSection));
+          record.address    = triton::ast::readVarint(expressionsSection);
+          record.size       = static_cast<triton::uint32>(triton::ast::readVarint(expressionsSection));
+          record.isTainted  = (triton::ast::readVarint(expressionsSection) != 0);
+          records.push_back(record);
+        }
+
+        std::istringstream registers(sections[triton::ast::SECTION_REGISTERS]);
+        if (triton::ast::readVarint(registers) != this->numberOfRegisters)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::loadSymbolicState(): The number of registers does not match.");
+        for (triton::uint32 index = 0; index < this->numberOfRegisters; index++)
+          symbolicReg.push_back(triton::ast::readVarint(registers) - 1);
+
+        std::istringstream memory(sections[triton::ast::SECTION_MEMORY]);
+        triton::uint64 address = 0;
+        for (triton::uint64 count = triton::ast::readVarint(memory); count > 0; count--) {
+          address += triton::ast::readVarint(memory);
+          memoryReference[address] = triton::ast::readVarint(memory);
+        }
+
+        /* The ASTs of the branches follow the ones of the expressions in the node table */
+        std::istringstream constraints(sections[triton::ast::SECTION_PATH_CONSTRAINTS]);
+        std::vector<std::vector<std::tuple<bool, triton::uint64, triton::uint64>>> branches;
+        triton::usize numberOfBranches = 0;
+        for (triton::uint64 count = triton::ast::readVarint(constraints); count > 0; count--) {
+          branches.push_back(std::vector<std::tuple<bool, triton::uint64, triton::uint64>>());
+          for (triton::uint64 index = triton::ast::readVarint(constraints); index > 0; index--) {
+            bool taken            = (triton::ast::readVarint(constraints) != 0);
+            triton::uint64 src    = triton::ast::readVarint(constraints);
+            triton::uint64 dst    = triton::ast::readVarint(constraints);
+            branches.back().push_back(std::make_tuple(taken, src, dst));
+            numberOfBranches++;
+          }
+        }
+
+        std::istringstream variablesSection(sections[triton::ast::SECTION_VARIABLES]);
+        try {
+          for (triton::uint64 count = triton::ast::readVarint(variablesSection); count > 0; count--) {
+            triton::usize id            = triton::ast::readVarint(variablesSection);
+            symkind_e kind              = static_cast<symkind_e>(triton::ast::readVarint(variablesSection));
+            triton::uint64 kindValue    = triton::ast::readVarint(variablesSection);
+            triton::uint32 size         = static_cast<triton::uint32>(triton::ast::readVarint(variablesSection));
+            std::string comment         = triton::ast::readString(variablesSection);
+            triton::uint512 value       = triton::ast::readVarint512(variablesSection);
+            delete variables[id];
+            variables[id] = new SymbolicVariable(kind, kindValue, id, size, comment, value);
+          }
+        }
+        catch (...) {
+          for (auto it = variables.begin(); it != variables.end(); it++)
+            delete it->second;
+          throw;
+        }
+
+        /* The new variables and expressions are installed while the nodes are rebuilt */
+        this->symbolicVariables.swap(variables);
+        this->symbolicExpressions.swap(expressions);
+
+        try {
+          std::istringstream nodes(sections[triton::ast::SECTION_AST]);
+          roots = triton::ast::readNodeTable(nodes, [this, &records](triton::usize position, triton::ast::AbstractNode* node) {
+            if (position >= records.size())
+              return;
+
+            const ExpressionRecord& record = records[position];
+            SymbolicExpression* expr = new SymbolicExpression(node, record.id, record.kind, record.comment);
+            if (record.kind == triton::engines::symbolic::REG)
+              expr->setOriginRegister(triton::arch::Register(record.regId));
+            else if (record.kind == triton::engines::symbolic::MEM)
+              expr->setOriginMemory(triton::arch::MemoryAccess(record.address, record.size));
+            expr->isTainted = record.isTainted;
+
+            delete this->symbolicExpressions[record.id];
+            this->symbolicExpressions[record.id] = expr;
+          });
+
+          if (roots.size() != records.size() + numberOfBranches)
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::loadSymbolicState(): Invalid number of roots.");
+        }
+        catch (...) {
+          /* The current state is restored */
+          for (auto it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++)
+            delete it->second;
+          for (auto it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++)
+            delete it->second;
+          this->symbolicVariables.swap(variables);
+          this->symbolicExpressions.swap(expressions);
+          throw;
+        }
+
+        triton::usize root = records.size();
+        for (auto& constraint : branches) {
+          PathConstraint pco;
+          for (auto& branch : constraint)
+            pco.addBranchConstraint(std::get<0>(branch), std::get<1>(branch), std::get<2>(branch), roots[root++]);
+          pathConstraints.push_back(pco);
+        }
+
+        /* Frees the previous state, the backup engine shares its objects with the original one */
+        if (this->isBackup() == false) {
+          for (auto it = expressions.begin(); it != expressions.end(); it++)
+            delete it->second;
+          for (auto it = variables.begin(); it != variables.end(); it++)
+            delete it->second;
+        }
+
+        for (triton::uint32 index = 0; index < this->numberOfRegisters; index++)
+          this->symbolicReg[index] = symbolicReg[index];
+
+        this->memoryReference.swap(memoryReference);
+        this->alignedMemoryReference.clear();
+        this->pathConstraints.swap(pathConstraints);
+        this->uniqueSymExprId = uniqueSymExprId;
+        this->uniqueSymVarId  = uniqueSymVarId;
+        this->foldedSymExprId = foldedSymExprId;
+      }
+
+
       /* Enables or disables the symbolic engine */
       void SymbolicEngine::enable(bool flag) {
         this->enableFlag = flag;
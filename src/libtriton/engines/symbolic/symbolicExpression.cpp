@@ -54,10 +54,12 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedId(void) const {
-        if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
+        triton::uint32 mode = triton::api.getAstRepresentationMode();
+
+        if (mode == triton::ast::representations::SMT_REPRESENTATION || mode == triton::ast::representations::SMT_DAG_REPRESENTATION)
           return "ref!" + std::to_string(this->id);
 
-        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (mode == triton::ast::representations::PYTHON_REPRESENTATION)
           return "ref_" + std::to_string(this->id);
 
         else
@@ -66,13 +68,15 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedComment(void) const {
+        triton::uint32 mode = triton::api.getAstRepresentationMode();
+
         if (this->getComment().empty())
           return "";
 
-        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
+        else if (mode == triton::ast::representations::SMT_REPRESENTATION || mode == triton::ast::representations::SMT_DAG_REPRESENTATION)
           return "; " + this->getComment();
 
-        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (mode == triton::ast::representations::PYTHON_REPRESENTATION)
           return "# " + this->getComment();
 
         else
@@ -112,6 +112,50 @@ if __name__ == "__main__":
     print 'Simp: ', c
 ~~~~~~~~~~~~~
 
+\subsection SMT_simplification_rules Simplification via native rules
+<hr>
+
+A Python callback is called for every new symbolic expression, which is slow on large traces. The same kind of
+rules may be written as rewrite rules and applied by Triton itself on every node of the expression, bottom-up and
+once per node. A rule is written as `lhs -> rhs` with the SMT2-Lib syntax of Triton's AST. Identifiers which are
+not operators are pattern variables, a variable which appears several times matches equal subtrees. Integers match
+bitvectors of any size (`(_ bvV S)` matches a size), on the right side they take the size of their sibling
+operands. Commutative operators are also matched with their operands swapped, and references to other symbolic
+expressions are not followed. Rules are applied after the simplifications of z3 and before the simplification
+callbacks.
+
+~~~~~~~~~~~~~{.py}
+>>> addSimplificationRule('(bvor (bvand a (bvnot b)) (bvand (bvnot a) b)) -> (bvxor a b)')
+>>> addSimplificationRule('(bvxor a a) -> 0')
+
+>>> a = variable(newSymbolicVariable(8))
+>>> b = bv(2, 8)
+>>> print simplify((~b & a) | (~a & b))
+(bvxor SymVar_0 (_ bv2 8))
+~~~~~~~~~~~~~
+
+Rules may also be loaded from a file, one rule per line with `;` comments, using
+triton::API::loadSimplificationRules(), or registered as C++ functions with
+triton::API::addSimplificationRule(). A shared object which exports the
+`extern "C" void tritonSimplificationPlugin(triton::engines::symbolic::SimplificationRules* rules)`
+function is loaded with triton::API::loadSimplificationPlugin(). This function registers its rules
+and the shared object is never unloaded. When used from Python, the shared object must be linked against
+the `triton` module, otherwise it would bind its own copy of Triton.
+
+~~~~~~~~~~~~~{.cpp}
+// Rule: if (bvnot (bvnot x)) -> x
+triton::ast::AbstractNode* not_not(triton::ast::AbstractNode* node) {
+  if (node->getKind() == triton::ast::BVNOT_NODE && node->getChilds()[0]->getKind() == triton::ast::BVNOT_NODE)
+    return node->getChilds()[0]->getChilds()[0];
+  return node;
+}
+
+extern "C" void tritonSimplificationPlugin(triton::engines::symbolic::SimplificationRules* rules) {
+  rules->addRule(not_not);
+  rules->addRule("(bvadd a (bvneg a)) -> 0");
+}
+~~~~~~~~~~~~~
+
 \subsection SMT_simplification_z3 Simplification via Z3
 <hr>
 
@@ -181,6 +225,7 @@ namespace triton {
 
 
       void SymbolicSimplification::copy(const SymbolicSimplification& other) {
+        this->rules     = other.rules;
         this->z3Enabled = other.z3Enabled;
       }
 
@@ -195,6 +240,11 @@ namespace triton {
       }
 
 
+      triton::engines::symbolic::SimplificationRules& SymbolicSimplification::getSimplificationRules(void) {
+        return this->rules;
+      }
+
+
       triton::ast::AbstractNode* SymbolicSimplification::processSimplification(triton::ast::AbstractNode* node, bool z3) const {
 
         if (node == nullptr)
@@ -212,6 +262,9 @@ namespace triton {
           node = tritonAst.convert();
         }
 
+        /* Apply the native rules on the whole tree */
+        node = this->rules.apply(node);
+
         /* process recorded callback about symbolic simplifications */
         node = triton::api.processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
 
@@ -0,0 +1,335 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <vector>
+
+#include <shadowMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      /* Returns the number of bits set */
+      static triton::uint32 popcount(triton::uint64 x) {
+        x = x - ((x >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return static_cast<triton::uint32>((x * 0x0101010101010101ULL) >> 56);
+      }
+
+
+      /* Returns a mask of n bits */
+      static triton::uint64 bitsMask(triton::uint32 n) {
+        return (n >= 64) ? ~0ULL : ((1ULL << n) - 1);
+      }
+
+
+      /* Returns the index of the lowest bit set (x must not be 0) */
+      static triton::uint32 lowestBit(triton::uint64 x) {
+        return popcount((x & (~x + 1)) - 1);
+      }
+
+
+      /* Returns the bits of the word at `base` which are inside [start:last] */
+      static triton::uint64 wordMask(triton::uint64 base, triton::uint64 start, triton::uint64 last) {
+        triton::uint64 lo = (start > base) ? start - base : 0;
+        triton::uint64 hi = (last < base + 63) ? last - base : 63;
+        return bitsMask(static_cast<triton::uint32>(hi - lo + 1)) << lo;
+      }
+
+
+      /* Packs the bits of [pos:n] of a packed bitmap */
+      static triton::uint64 extractBits(const std::vector<triton::uint64>& bitmap, triton::usize pos, triton::uint32 n) {
+        triton::usize index = pos / 64;
+        triton::uint32 bit  = pos % 64;
+        triton::uint64 ret  = bitmap[index] >> bit;
+
+        if (bit && bit + n > 64)
+          ret |= bitmap[index + 1] << (64 - bit);
+
+        return ret & bitsMask(n);
+      }
+
+
+      ShadowPage::ShadowPage() {
+        for (triton::uint32 index = 0; index < SHADOW_PAGE_WORDS; index++)
+          this->words[index] = 0;
+        this->count = 0;
+      }
+
+
+      ShadowMemory::ShadowMemory() {
+        this->count = 0;
+      }
+
+
+      triton::uint32 ShadowMemory::chunkSize(triton::uint64 addr, triton::usize size) const {
+        triton::uint32 room = 64 - (addr % 64);
+        return (size < room) ? static_cast<triton::uint32>(size) : room;
+      }
+
+
+      triton::uint64 ShadowMemory::readChunk(triton::uint64 addr, triton::uint32 n) const {
+        std::unordered_map<triton::uint64, ShadowPage>::const_iterator it = this->pages.find(addr / SHADOW_PAGE_SIZE);
+
+        if (it == this->pages.end())
+          return 0;
+
+        return (it->second.words[(addr % SHADOW_PAGE_SIZE) / 64] >> (addr % 64)) & bitsMask(n);
+      }
+
+
+      void ShadowMemory::writeChunk(triton::uint64 addr, triton::uint32 n, triton::uint64 bits, bool assign) {
+        triton::uint64 page = addr / SHADOW_PAGE_SIZE;
+        triton::uint64 mask = bitsMask(n) << (addr % 64);
+        std::unordered_map<triton::uint64, ShadowPage>::iterator it = this->pages.find(page);
+
+        bits = (bits & bitsMask(n)) << (addr % 64);
+
+        if (it == this->pages.end()) {
+          /* Nothing to clear */
+          if (bits == 0)
+            return;
+          it = this->pages.insert(std::make_pair(page, ShadowPage())).first;
+          this->allocated.insert(page);
+        }
+
+        triton::uint64& word = it->second.words[(addr % SHADOW_PAGE_SIZE) / 64];
+        triton::uint64 value = assign ? ((word & ~mask) | bits) : (word | bits);
+
+        it->second.count = it->second.count - popcount(word) + popcount(value);
+        this->count      = this->count - popcount(word) + popcount(value);
+        word             = value;
+
+        /* Release empty pages */
+        if (it->second.count == 0) {
+          this->pages.erase(it);
+          this->allocated.erase(page);
+        }
+      }
+
+
+      bool ShadowMemory::isSet(triton::uint64 addr, triton::usize size) const {
+        if (this->count == 0)
+          return false;
+
+        while (size) {
+          triton::uint32 n = this->chunkSize(addr, size);
+          if (this->readChunk(addr, n))
+            return true;
+          addr += n;
+          size -= n;
+        }
+
+        return false;
+      }
+
+
+      void ShadowMemory::set(triton::uint64 addr, triton::usize size) {
+        while (size) {
+          triton::uint32 n = this->chunkSize(addr, size);
+          this->writeChunk(addr, n, ~0ULL, false);
+          addr += n;
+          size -= n;
+        }
+      }
+
+
+      void ShadowMemory::unset(triton::uint64 addr, triton::usize size) {
+        if (this->count == 0)
+          return;
+
+        while (size) {
+          triton::uint32 n = this->chunkSize(addr, size);
+          this->writeChunk(addr, n, 0, true);
+          addr += n;
+          size -= n;
+        }
+      }
+
+
+      bool ShadowMemory::unionArea(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        std::vector<triton::uint64> bitmap((size + 63) / 64 + 1, 0);
+        triton::usize pos = 0;
+
+        if (this->count == 0)
+          return false;
+
+        /* Read the whole source first, areas may overlap */
+        while (pos < size) {
+          triton::uint32 n    = this->chunkSize(src + pos, size - pos);
+          triton::uint64 bits = this->readChunk(src + pos, n);
+          bitmap[pos / 64] |= bits << (pos % 64);
+          if (pos % 64)
+            bitmap[pos / 64 + 1] |= bits >> (64 - (pos % 64));
+          pos += n;
+        }
+
+        for (pos = 0; pos < size;) {
+          triton::uint32 n = this->chunkSize(dst + pos, size - pos);
+          this->writeChunk(dst + pos, n, extractBits(bitmap, pos, n), false);
+          pos += n;
+        }
+
+        return this->isSet(dst, size);
+      }
+
+
+      void ShadowMemory::assignArea(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        std::vector<triton::uint64> bitmap((size + 63) / 64 + 1, 0);
+        triton::usize pos = 0;
+
+        if (this->count == 0)
+          return;
+
+        /* Read the whole source first, areas may overlap */
+        while (pos < size) {
+          triton::uint32 n    = this->chunkSize(src + pos, size - pos);
+          triton::uint64 bits = this->readChunk(src + pos, n);
+          bitmap[pos / 64] |= bits << (pos % 64);
+          if (pos % 64)
+            bitmap[pos / 64 + 1] |= bits >> (64 - (pos % 64));
+          pos += n;
+        }
+
+        for (pos = 0; pos < size;) {
+          triton::uint32 n = this->chunkSize(dst + pos, size - pos);
+          this->writeChunk(dst + pos, n, extractBits(bitmap, pos, n), true);
+          pos += n;
+        }
+      }
+
+
+      triton::usize ShadowMemory::size(void) const {
+        return this->count;
+      }
+
+
+      std::set<triton::uint64> ShadowMemory::getAddresses(void) const {
+        std::unordered_map<triton::uint64, ShadowPage>::const_iterator it;
+        std::set<triton::uint64> ret;
+
+        for (it = this->pages.begin(); it != this->pages.end(); it++) {
+          for (triton::uint32 index = 0; index < SHADOW_PAGE_WORDS; index++) {
+            triton::uint64 word = it->second.words[index];
+            for (triton::uint32 bit = 0; word; bit++, word >>= 1) {
+              if (word & 1)
+                ret.insert(it->first * SHADOW_PAGE_SIZE + index * 64 + bit);
+            }
+          }
+        }
+
+        return ret;
+      }
+
+
+      triton::usize ShadowMemory::size(triton::uint64 start, triton::uint64 last) const {
+        std::set<triton::uint64>::const_iterator it;
+        triton::usize ret = 0;
+
+        if (this->count == 0 || start > last)
+          return 0;
+
+        for (it = this->allocated.lower_bound(start / SHADOW_PAGE_SIZE); it != this->allocated.end() && *it <= last / SHADOW_PAGE_SIZE; it++) {
+          const ShadowPage& page = this->pages.find(*it)->second;
+          triton::uint64 base    = *it * SHADOW_PAGE_SIZE;
+
+          /* Pages fully covered are counted at once */
+          if (start <= base && base + SHADOW_PAGE_SIZE - 1 <= last) {
+            ret += page.count;
+            continue;
+          }
+
+          for (triton::uint32 index = 0; index < SHADOW_PAGE_WORDS; index++) {
+            triton::uint64 addr = base + index * 64;
+            if (addr + 63 < start || addr > last)
+              continue;
+            ret += popcount(page.words[index] & wordMask(addr, start, last));
+          }
+        }
+
+        return ret;
+      }
+
+
+      std::vector<std::pair<triton::uint64, triton::usize>> ShadowMemory::getRanges(triton::uint64 start, triton::uint64 last) const {
+        std::vector<std::pair<triton::uint64, triton::usize>> ret;
+        std::set<triton::uint64>::const_iterator it;
+
+        if (this->count == 0 || start > last)
+          return ret;
+
+        for (it = this->allocated.lower_bound(start / SHADOW_PAGE_SIZE); it != this->allocated.end() && *it <= last / SHADOW_PAGE_SIZE; it++) {
+          const ShadowPage& page = this->pages.find(*it)->second;
+          triton::uint64 base    = *it * SHADOW_PAGE_SIZE;
+
+          for (triton::uint32 index = 0; index < SHADOW_PAGE_WORDS; index++) {
+            triton::uint64 addr = base + index * 64;
+            if (addr + 63 < start || addr > last)
+              continue;
+
+            /* Split the word into runs of bits set */
+            triton::uint64 word = page.words[index] & wordMask(addr, start, last);
+            while (word) {
+              triton::uint32 bit  = lowestBit(word);
+              triton::uint64 rest = ~(word >> bit);
+              triton::uint32 size = rest ? lowestBit(rest) : 64 - bit;
+
+              /* Runs which follow each other are merged, even across words and pages */
+              if (!ret.empty() && ret.back().first + ret.back().second == addr + bit)
+                ret.back().second += size;
+              else
+                ret.push_back(std::make_pair(addr + bit, static_cast<triton::usize>(size)));
+
+              word &= ~(bitsMask(size) << bit);
+            }
+          }
+        }
+
+        return ret;
+      }
+
+
+      bool ShadowMemory::findNext(triton::uint64 addr, triton::uint64& found) const {
+        std::set<triton::uint64>::const_iterator it;
+
+        if (this->count == 0)
+          return false;
+
+        for (it = this->allocated.lower_bound(addr / SHADOW_PAGE_SIZE); it != this->allocated.end(); it++) {
+          const ShadowPage& page = this->pages.find(*it)->second;
+          triton::uint64 base    = *it * SHADOW_PAGE_SIZE;
+
+          for (triton::uint32 index = 0; index < SHADOW_PAGE_WORDS; index++) {
+            triton::uint64 wbase = base + index * 64;
+            triton::uint64 word  = page.words[index];
+            if (wbase + 63 < addr)
+              continue;
+            if (addr > wbase)
+              word &= ~bitsMask(static_cast<triton::uint32>(addr - wbase));
+            if (word) {
+              found = wbase + lowestBit(word);
+              return true;
+            }
+          }
+        }
+
+        return false;
+      }
+
+
+      void ShadowMemory::clear(void) {
+        this->pages.clear();
+        this->allocated.clear();
+        this->count = 0;
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
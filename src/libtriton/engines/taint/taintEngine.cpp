@@ -5,6 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <vector>
+
+#include <cpuSize.hpp>
 #include <taintEngine.hpp>
 
 
@@ -80,6 +83,72 @@ That's why Triton uses **symbolic execution for precision** and an over-approxim
 tainting to know if we can ask a model to the SMT solver - Asking a model means that
 the symbolic variables are controllable by the user input.
 
+\section engine_Taint_registers Register granularity
+<hr>
+
+The taint of registers is kept per byte of their parent register (one 64-bit mask per
+parent), so writing `al` does not taint `ah` nor the upper bytes of `rax`. Inside an
+operand the spreading is still over-approximated: if a source is tainted, all bytes
+of the destination operand are tainted. As in AMD64, writing a 32-bit register clears
+the taint of the upper half of its 64-bit parent.
+
+~~~~~~~~~~~~~{.asm}
+mov rax, 0x1122               ; RAX is untainted
+mov al, byte ptr [user_input] ; AL is tainted, AH and RAX[63..16] are not
+cmp ah, 0x99                  ; not tainted
+~~~~~~~~~~~~~
+
+\section engine_Taint_labels Labeled taint
+<hr>
+
+When the labeled mode is enabled (`enableTaintLabels(True)`), each tainted byte and
+register also carries a set of labels. Labels are given by `taintMemory(mem, label)`
+and `taintRegister(reg, label)`, and are spread by the same rules as the taint. Thus,
+one pass over a trace tells which input sources reach a given sink. Label sets are
+interned and their unions are memoized, so a byte or a register only holds an id.
+
+~~~~~~~~~~~~~{.py}
+>>> enableTaintLabels(True)
+>>> taintMemory(MemoryAccess(0x1000, CPUSIZE.DWORD), 1)
+>>> taintRegister(REG.RBX, 2)
+>>> # add eax, dword ptr [0x1000] ; add eax, ebx
+>>> getRegisterTaintLabels(REG.RAX)
+[1L, 2L]
+~~~~~~~~~~~~~
+
+\section engine_Taint_provenance Provenance
+<hr>
+
+When the provenance recorder is enabled (`enableTaintProvenance(True, capacity)`), each spreading of the taint
+adds an event which links the destination to the events which have tainted its sources, along with the address
+of the instruction. Events live in a ring buffer of `capacity` events, thus the memory stays bounded on long traces
+and the oldest events are dropped first. Walking back the graph from a sink gives the instructions which have
+brought the taint up to it.
+
+~~~~~~~~~~~~~{.py}
+>>> enableTaintProvenance(True)
+>>> taintMemory(MemoryAccess(0x1000, CPUSIZE.QWORD))
+>>> # 0x400000: mov rax, qword ptr [0x1000] ; 0x400003: mov qword ptr [0x2000], rax
+>>> [e['address'] for e in getMemoryTaintProvenance(MemoryAccess(0x2000, CPUSIZE.QWORD))]
+[4194307L, 4194304L, 0L]
+~~~~~~~~~~~~~
+
+\section engine_Taint_ranges Memory ranges
+<hr>
+
+Tainted memory may be queried by ranges instead of listing every address with `getTaintedMemory()`.
+The queries only walk the shadow pages which are allocated inside the range, and fully covered
+pages are counted at once.
+
+~~~~~~~~~~~~~{.py}
+>>> countTaintedMemory(buf, buf + 0x1000) != 0   # is any byte of the buffer tainted?
+True
+>>> getTaintedMemoryRanges(buf, buf + 0x1000)    # (start, length) runs
+[(4096L, 16L)]
+>>> getNextTaintedMemory(buf + 0x10) is None
+True
+~~~~~~~~~~~~~
+
 */
 
 
@@ -89,13 +158,21 @@ namespace triton {
     namespace taint {
 
       TaintEngine::TaintEngine() {
-        this->enableFlag = true;
+        this->enableFlag     = true;
+        this->labelsFlag     = false;
+        this->provenanceFlag = false;
       }
 
 
       void TaintEngine::copy(const TaintEngine& other) {
-        this->enableFlag = other.enableFlag;
-        this->taintedMemory = other.taintedMemory;
+        this->enableFlag       = other.enableFlag;
+        this->labelsFlag       = other.labelsFlag;
+        this->labels           = other.labels;
+        this->memoryLabels     = other.memoryLabels;
+        this->provenance       = other.provenance;
+        this->provenanceFlag   = other.provenanceFlag;
+        this->registerLabels   = other.registerLabels;
+        this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
       }
 
@@ -124,61 +201,278 @@ namespace triton {
       }
 
 
+      bool TaintEngine::isLabelsEnabled(void) const {
+        return this->labelsFlag;
+      }
+
+
+      void TaintEngine::enableLabels(bool flag) {
+        this->labelsFlag = flag;
+        if (!flag) {
+          this->labels.clear();
+          this->memoryLabels.clear();
+          this->registerLabels.clear();
+        }
+      }
+
+
+      bool TaintEngine::isProvenanceEnabled(void) const {
+        return this->provenanceFlag;
+      }
+
+
+      void TaintEngine::enableProvenance(bool flag, triton::usize capacity) {
+        this->provenanceFlag = flag;
+        this->provenance     = TaintProvenance(flag ? capacity : TAINT_PROVENANCE_DEFAULT_CAPACITY);
+      }
+
+
+      void TaintEngine::enterInstruction(triton::uint64 addr) {
+        if (this->provenanceFlag)
+          this->provenance.enterInstruction(addr);
+      }
+
+
+      void TaintEngine::leaveInstruction(void) {
+        if (this->provenanceFlag)
+          this->provenance.leaveInstruction();
+      }
+
+
+      std::vector<TaintEvent> TaintEngine::getMemoryProvenance(triton::uint64 addr, triton::uint32 size) const {
+        return this->provenance.backtrack(TaintLocation(addr, size));
+      }
+
+
+      std::vector<TaintEvent> TaintEngine::getMemoryProvenance(const triton::arch::MemoryAccess& mem) const {
+        return this->provenance.backtrack(TaintLocation(mem.getAddress(), mem.getSize()));
+      }
+
+
+      std::vector<TaintEvent> TaintEngine::getRegisterProvenance(const triton::arch::Register& reg) const {
+        return this->provenance.backtrack(TaintLocation(reg.getParent().getId()));
+      }
+
+
+      triton::usize TaintEngine::getMemoryLabelSet(triton::uint64 addr, triton::usize size) const {
+        std::unordered_map<triton::uint64, triton::usize>::const_iterator it;
+        triton::usize set = EMPTY_LABEL_SET;
+
+        if (this->memoryLabels.empty())
+          return EMPTY_LABEL_SET;
+
+        for (triton::usize index = 0; index < size; index++) {
+          it = this->memoryLabels.find(addr + index);
+          if (it != this->memoryLabels.end())
+            set = this->labels.merge(set, it->second);
+        }
+
+        return set;
+      }
+
+
+      triton::usize TaintEngine::getRegisterLabelSet(const triton::arch::Register& reg) const {
+        std::map<triton::uint32, triton::usize>::const_iterator it = this->registerLabels.find(reg.getParent().getId());
+
+        if (it == this->registerLabels.end())
+          return EMPTY_LABEL_SET;
+
+        return it->second;
+      }
+
+
+      void TaintEngine::setMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::usize set) {
+        if (set == EMPTY_LABEL_SET && this->memoryLabels.empty())
+          return;
+
+        for (triton::usize index = 0; index < size; index++) {
+          if (set == EMPTY_LABEL_SET)
+            this->memoryLabels.erase(addr + index);
+          else
+            this->memoryLabels[addr + index] = set;
+        }
+      }
+
+
+      void TaintEngine::mergeMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::usize set) {
+        if (set == EMPTY_LABEL_SET)
+          return;
+
+        for (triton::usize index = 0; index < size; index++) {
+          triton::usize& current = this->memoryLabels[addr + index];
+          current = this->labels.merge(current, set);
+        }
+      }
+
+
+      void TaintEngine::setRegisterLabelSet(const triton::arch::Register& reg, triton::usize set) {
+        if (set == EMPTY_LABEL_SET)
+          this->registerLabels.erase(reg.getParent().getId());
+        else
+          this->registerLabels[reg.getParent().getId()] = set;
+      }
+
+
+      std::vector<triton::uint32> TaintEngine::getMemoryLabels(triton::uint64 addr, triton::uint32 size) const {
+        return this->labels.getLabels(this->getMemoryLabelSet(addr, size));
+      }
+
+
+      std::vector<triton::uint32> TaintEngine::getMemoryLabels(const triton::arch::MemoryAccess& mem) const {
+        return this->labels.getLabels(this->getMemoryLabelSet(mem.getAddress(), mem.getSize()));
+      }
+
+
+      std::vector<triton::uint32> TaintEngine::getRegisterLabels(const triton::arch::Register& reg) const {
+        return this->labels.getLabels(this->getRegisterLabelSet(reg));
+      }
+
+
       /* Returns the tainted addresses */
-      const std::set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
-        return this->taintedMemory;
+      std::set<triton::uint64> TaintEngine::getTaintedMemory(void) const {
+        return this->taintedMemory.getAddresses();
+      }
+
+
+      /* Returns the runs of tainted bytes */
+      std::vector<std::pair<triton::uint64, triton::usize>> TaintEngine::getTaintedMemoryRanges(void) const {
+        return this->taintedMemory.getRanges(0, static_cast<triton::uint64>(-1));
+      }
+
+
+      /* Returns the runs of tainted bytes inside [start:end) */
+      std::vector<std::pair<triton::uint64, triton::usize>> TaintEngine::getTaintedMemoryRanges(triton::uint64 start, triton::uint64 end) const {
+        if (end <= start)
+          return std::vector<std::pair<triton::uint64, triton::usize>>();
+        return this->taintedMemory.getRanges(start, end - 1);
+      }
+
+
+      /* Returns the number of tainted bytes inside [start:end) */
+      triton::usize TaintEngine::countTaintedMemory(triton::uint64 start, triton::uint64 end) const {
+        if (end <= start)
+          return 0;
+        return this->taintedMemory.size(start, end - 1);
+      }
+
+
+      /* Looks for the first tainted byte at or after addr */
+      bool TaintEngine::getNextTaintedMemory(triton::uint64 addr, triton::uint64& found) const {
+        return this->taintedMemory.findNext(addr, found);
       }
 
 
       /* Returns the tainted registers */
-      const std::set<triton::arch::Register>& TaintEngine::getTaintedRegisters(void) const {
-        return this->taintedRegisters;
+      std::set<triton::arch::Register> TaintEngine::getTaintedRegisters(void) const {
+        std::set<triton::arch::Register> ret;
+
+        for (triton::uint32 parentId = 0; parentId < this->taintedRegisters.size(); parentId++) {
+          if (this->taintedRegisters[parentId])
+            ret.insert(triton::arch::Register(parentId));
+        }
+
+        return ret;
       }
 
 
-      /* Returns true of false if the memory address is currently tainted */
-      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
+      triton::uint64 TaintEngine::getRegisterBytesMask(const triton::arch::Register& reg) const {
+        triton::uint32 low  = reg.getLow() / BYTE_SIZE_BIT;
+        triton::uint32 high = reg.getHigh() / BYTE_SIZE_BIT;
+
+        if (high - low + 1 >= 64)
+          return ~0ULL;
+
+        return ((1ULL << (high - low + 1)) - 1) << low;
+      }
+
+
+      triton::uint64 TaintEngine::getRegisterTaint(triton::uint32 parentId) const {
+        if (parentId >= this->taintedRegisters.size())
+          return 0;
+        return this->taintedRegisters[parentId];
+      }
+
 
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
+      void TaintEngine::setRegisterTaint(triton::uint32 parentId, triton::uint64 mask) {
+        if (parentId >= this->taintedRegisters.size()) {
+          if (mask == 0)
+            return;
+          this->taintedRegisters.resize(parentId + 1, 0);
         }
 
+        this->taintedRegisters[parentId] = mask;
+
+        /* The labels and the provenance follow the register once it is fully untainted */
+        if (mask == 0 && this->labelsFlag)
+          this->registerLabels.erase(parentId);
+        if (mask == 0 && this->provenanceFlag)
+          this->provenance.remove(TaintLocation(parentId));
+      }
+
+
+      bool TaintEngine::spreadRegister(const triton::arch::Register& reg, bool flag) {
+        triton::arch::Register parent = reg.getParent();
+        triton::uint64 bytes          = this->getRegisterBytesMask(reg);
+        triton::uint64 written        = bytes;
+        triton::uint64 mask           = this->getRegisterTaint(parent.getId());
+
+        /* In AMD64, if a reg32 is written, it clears the 32-bit MSB of the corresponding register */
+        if (reg.getSize() == DWORD_SIZE && parent.getSize() == QWORD_SIZE)
+          written = this->getRegisterBytesMask(parent);
+
+        mask &= ~written;
+        this->setRegisterTaint(parent.getId(), (flag == TAINTED) ? (mask | bytes) : mask);
+
+        return (mask != 0);
+      }
+
+
+      /* Returns true of false if the memory address is currently tainted */
+      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
+        if (this->taintedMemory.isSet(mem.getAddress(), mem.getSize()))
+          return TAINTED;
         return !TAINTED;
       }
 
 
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
-
+        if (this->taintedMemory.isSet(addr, size))
+          return TAINTED;
         return !TAINTED;
       }
 
 
       /* Returns true of false if the register is currently tainted */
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
-        triton::arch::Register parent = reg.getParent();
-
-        if (this->taintedRegisters.find(parent) != this->taintedRegisters.end())
+        if (this->getRegisterTaint(reg.getParent().getId()) & this->getRegisterBytesMask(reg))
           return TAINTED;
-
         return !TAINTED;
       }
 
 
       /* Taint the register */
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
-        triton::arch::Register parent = reg.getParent();
+        triton::uint32 parentId = reg.getParent().getId();
 
         if (!this->isEnabled())
-          return this->isRegisterTainted(parent);
-        this->taintedRegisters.insert(parent);
+          return this->isRegisterTainted(reg);
+        this->setRegisterTaint(parentId, this->getRegisterTaint(parentId) | this->getRegisterBytesMask(reg));
+        if (this->provenanceFlag)
+          this->provenance.introduce(TaintLocation(parentId));
+
+        return TAINTED;
+      }
+
+
+      /* Taint the register with a label */
+      bool TaintEngine::taintRegister(const triton::arch::Register& reg, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        this->taintRegister(reg);
+        if (this->labelsFlag)
+          this->setRegisterLabelSet(reg, this->labels.merge(this->getRegisterLabelSet(reg), this->labels.single(label)));
 
         return TAINTED;
       }
@@ -186,11 +480,11 @@ namespace triton {
 
       /* Untaint the register */
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
-        triton::arch::Register parent = reg.getParent();
+        triton::uint32 parentId = reg.getParent().getId();
 
         if (!this->isEnabled())
-          return this->isRegisterTainted(parent);
-        this->taintedRegisters.erase(parent);
+          return this->isRegisterTainted(reg);
+        this->setRegisterTaint(parentId, this->getRegisterTaint(parentId) & ~this->getRegisterBytesMask(reg));
 
         return !TAINTED;
       }
@@ -213,16 +507,60 @@ namespace triton {
 
       /* Set the taint on register */
       bool TaintEngine::setTaintRegister(const triton::arch::Register& reg, bool flag) {
-        triton::arch::Register parent = reg.getParent();
-
         if (!this->isEnabled())
-          return this->isRegisterTainted(parent);
+          return this->isRegisterTainted(reg);
 
         if (flag == TAINTED)
-          this->taintRegister(parent);
+          this->taintRegister(reg);
 
         else if (flag == !TAINTED)
-          this->untaintRegister(parent);
+          this->untaintRegister(reg);
+
+        return flag;
+      }
+
+
+      /* Set the taint on a register written by an instruction, its labels are the ones of the instruction's inputs */
+      bool TaintEngine::setTaintRegister(const triton::arch::Register& reg, bool flag, const triton::arch::Instruction& inst) {
+        triton::usize set = EMPTY_LABEL_SET;
+
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        if (flag == TAINTED && this->labelsFlag) {
+          for (const auto& input : inst.getReadRegisters())
+            set = this->labels.merge(set, this->getRegisterLabelSet(input.first));
+          for (const auto& input : inst.getLoadAccess())
+            set = this->labels.merge(set, this->getMemoryLabelSet(input.first.getAddress(), input.first.getSize()));
+        }
+
+        this->setTaintRegister(reg, flag);
+        if (this->labelsFlag)
+          this->setRegisterLabelSet(reg, set);
+
+        return flag;
+      }
+
+
+      /* Set the taint on a register computed from the sources, its labels are the ones of the sources */
+      bool TaintEngine::setTaintRegister(const triton::arch::Register& reg, bool flag, const std::vector<triton::arch::OperandWrapper>& sources) {
+        triton::usize set = EMPTY_LABEL_SET;
+
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        if (flag == TAINTED && this->labelsFlag) {
+          for (const triton::arch::OperandWrapper& source : sources) {
+            if (source.getType() == triton::arch::OP_REG)
+              set = this->labels.merge(set, this->getRegisterLabelSet(source.getConstRegister()));
+            else if (source.getType() == triton::arch::OP_MEM)
+              set = this->labels.merge(set, this->getMemoryLabelSet(source.getConstMemory().getAddress(), source.getConstMemory().getSize()));
+          }
+        }
+
+        this->setTaintRegister(reg, flag);
+        if (this->labelsFlag)
+          this->setRegisterLabelSet(reg, set);
 
         return flag;
       }
@@ -230,39 +568,61 @@ namespace triton {
 
       /* Taint the memory */
       bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
+        if (!this->isEnabled())
+          return this->isMemoryTainted(mem);
+        this->taintedMemory.set(mem.getAddress(), mem.getSize());
+        if (this->provenanceFlag)
+          this->provenance.introduce(TaintLocation(mem.getAddress(), mem.getSize()));
+        return TAINTED;
+      }
+
+
+      /* Taint the address */
+      bool TaintEngine::taintMemory(triton::uint64 addr) {
+        if (!this->isEnabled())
+          return this->isMemoryTainted(addr);
+        this->taintedMemory.set(addr);
+        if (this->provenanceFlag)
+          this->provenance.introduce(TaintLocation(addr, 1));
+        return TAINTED;
+      }
+
 
+      /* Taint the memory with a label */
+      bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+        this->taintMemory(mem);
+        if (this->labelsFlag)
+          this->mergeMemoryLabelSet(mem.getAddress(), mem.getSize(), this->labels.single(label));
 
         return TAINTED;
       }
 
 
-      /* Taint the address */
-      bool TaintEngine::taintMemory(triton::uint64 addr) {
+      /* Taint the address with a label */
+      bool TaintEngine::taintMemory(triton::uint64 addr, triton::uint32 label) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+
+        this->taintMemory(addr);
+        if (this->labelsFlag)
+          this->mergeMemoryLabelSet(addr, 1, this->labels.single(label));
+
         return TAINTED;
       }
 
 
       /* Untaint the memory */
       bool TaintEngine::untaintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
-
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
-
+        this->taintedMemory.unset(mem.getAddress(), mem.getSize());
+        if (this->labelsFlag)
+          this->setMemoryLabelSet(mem.getAddress(), mem.getSize(), EMPTY_LABEL_SET);
+        if (this->provenanceFlag)
+          this->provenance.remove(TaintLocation(mem.getAddress(), mem.getSize()));
         return !TAINTED;
       }
 
@@ -271,7 +631,11 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->taintedMemory.unset(addr);
+        if (this->labelsFlag)
+          this->setMemoryLabelSet(addr, 1, EMPTY_LABEL_SET);
+        if (this->provenanceFlag)
+          this->provenance.remove(TaintLocation(addr, 1));
         return !TAINTED;
       }
 
@@ -285,11 +649,19 @@ namespace triton {
           return this->isRegisterTainted(regDst);
 
         if (this->isRegisterTainted(regSrc)) {
-          this->taintRegister(regDst);
+          triton::usize set = this->getRegisterLabelSet(regSrc);
+          /* Bytes of the parent which are not written keep their labels */
+          bool keep = this->spreadRegister(regDst, TAINTED);
+          if (keep)
+            set = this->labels.merge(set, this->getRegisterLabelSet(regDst));
+          if (this->labelsFlag)
+            this->setRegisterLabelSet(regDst, set);
+          if (this->provenanceFlag)
+            this->provenance.spread(TaintLocation(regDst.getParent().getId()), TaintLocation(regSrc.getParent().getId()), keep);
           return TAINTED;
         }
 
-        this->untaintRegister(regDst);
+        this->spreadRegister(regDst, !TAINTED);
         return !TAINTED;
       }
 
@@ -301,7 +673,7 @@ namespace triton {
       bool TaintEngine::assignmentRegisterImmediate(const triton::arch::Register& regDst) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
-        this->untaintRegister(regDst);
+        this->spreadRegister(regDst, !TAINTED);
         return !TAINTED;
       }
 
@@ -315,21 +687,28 @@ namespace triton {
           return this->isRegisterTainted(regDst);
 
         if (this->isMemoryTainted(memSrc)) {
-          this->taintRegister(regDst);
+          triton::usize set = this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize());
+          /* Bytes of the parent which are not written keep their labels */
+          bool keep = this->spreadRegister(regDst, TAINTED);
+          if (keep)
+            set = this->labels.merge(set, this->getRegisterLabelSet(regDst));
+          if (this->labelsFlag)
+            this->setRegisterLabelSet(regDst, set);
+          if (this->provenanceFlag)
+            this->provenance.spread(TaintLocation(regDst.getParent().getId()), TaintLocation(memSrc.getAddress(), memSrc.getSize()), keep);
           return TAINTED;
         }
 
-        this->untaintRegister(regDst);
+        this->spreadRegister(regDst, !TAINTED);
         return !TAINTED;
       }
 
 
       /*
-       * Spread the taint in memDst if memSrc is tainted.
+       * Assign the taint of memSrc to memDst (byte per byte).
        * Returns true if a spreading occurs otherwise returns false.
        */
       bool TaintEngine::assignmentMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
-        bool isTainted          = !TAINTED;
         triton::uint32 readSize = memSrc.getSize();
         triton::uint64 addrSrc  = memSrc.getAddress();
         triton::uint64 addrDst  = memDst.getAddress();
@@ -337,14 +716,25 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
-        for (triton::uint32 offset = 0; offset < readSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            isTainted = TAINTED;
+        /* Bytes of the destination get the taint of their source byte, clean bytes are untainted */
+        if (this->taintedMemory.isSet(addrSrc, readSize)) {
+          if (this->labelsFlag) {
+            std::vector<triton::usize> sets(readSize);
+            /* Read the whole source first, areas may overlap */
+            for (triton::uint32 index = 0; index < readSize; index++)
+              sets[index] = this->taintedMemory.isSet(addrSrc + index) ? this->getMemoryLabelSet(addrSrc + index, 1) : EMPTY_LABEL_SET;
+            for (triton::uint32 index = 0; index < readSize; index++)
+              this->setMemoryLabelSet(addrDst + index, 1, sets[index]);
           }
+          if (this->provenanceFlag)
+            this->provenance.spread(TaintLocation(addrDst, memDst.getSize()), TaintLocation(addrSrc, readSize), false);
+          this->taintedMemory.assignArea(addrDst, addrSrc, readSize);
+          return TAINTED;
         }
 
-        return isTainted;
+        /* Spread destination */
+        this->untaintMemory(memDst);
+        return !TAINTED;
       }
 
 
@@ -370,7 +760,11 @@ namespace triton {
 
         /* Check source */
         if (this->isRegisterTainted(regSrc)) {
-          this->taintMemory(memDst);
+          this->taintedMemory.set(memDst.getAddress(), memDst.getSize());
+          if (this->labelsFlag)
+            this->setMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->getRegisterLabelSet(regSrc));
+          if (this->provenanceFlag)
+            this->provenance.spread(TaintLocation(memDst.getAddress(), memDst.getSize()), TaintLocation(regSrc.getParent().getId()), false);
           return TAINTED;
         }
 
@@ -386,6 +780,7 @@ namespace triton {
       bool TaintEngine::unionRegisterImmediate(const triton::arch::Register& regDst) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
+        this->spreadRegister(regDst, this->isRegisterTainted(regDst));
         return this->isRegisterTainted(regDst);
       }
 
@@ -399,10 +794,16 @@ namespace triton {
           return this->isRegisterTainted(regDst);
 
         if (this->isRegisterTainted(regSrc)) {
-          this->taintRegister(regDst);
+          triton::usize set = this->labels.merge(this->getRegisterLabelSet(regDst), this->getRegisterLabelSet(regSrc));
+          if (this->provenanceFlag)
+            this->provenance.spread(TaintLocation(regDst.getParent().getId()), TaintLocation(regSrc.getParent().getId()), true);
+          this->spreadRegister(regDst, TAINTED);
+          if (this->labelsFlag)
+            this->setRegisterLabelSet(regDst, set);
           return TAINTED;
         }
 
+        this->spreadRegister(regDst, this->isRegisterTainted(regDst));
         return this->isRegisterTainted(regDst);
       }
 
@@ -412,7 +813,6 @@ namespace triton {
        * we check if memDst is tainted and returns the status.
        */
       bool TaintEngine::unionMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
-        bool tainted             = !TAINTED;
         triton::uint32 writeSize = memDst.getSize();
         triton::uint64 addrDst   = memDst.getAddress();
         triton::uint64 addrSrc   = memSrc.getAddress();
@@ -420,20 +820,23 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
-        /* Check source */
-        for (triton::uint32 offset = 0; offset < writeSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            tainted = TAINTED;
-          }
+        /* Spread the labels of the source (byte per byte) */
+        if (this->labelsFlag && !this->memoryLabels.empty()) {
+          std::vector<triton::usize> sets(writeSize);
+          for (triton::uint32 index = 0; index < writeSize; index++)
+            sets[index] = this->getMemoryLabelSet(addrSrc + index, 1);
+          for (triton::uint32 index = 0; index < writeSize; index++)
+            this->mergeMemoryLabelSet(addrDst + index, 1, sets[index]);
         }
 
-        /* Check destination */
-        if (this->isMemoryTainted(memDst)) {
+        if (this->provenanceFlag && this->taintedMemory.isSet(addrSrc, writeSize))
+          this->provenance.spread(TaintLocation(addrDst, writeSize), TaintLocation(addrSrc, writeSize), true);
+
+        /* Spread the source (byte per byte) and check the destination */
+        if (this->taintedMemory.unionArea(addrDst, addrSrc, writeSize))
           return TAINTED;
-        }
 
-        return tainted;
+        return !TAINTED;
       }
 
 
@@ -446,10 +849,16 @@ namespace triton {
           return this->isRegisterTainted(regDst);
 
         if (this->isMemoryTainted(memSrc)) {
-          this->taintRegister(regDst);
+          triton::usize set = this->labels.merge(this->getRegisterLabelSet(regDst), this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize()));
+          if (this->provenanceFlag)
+            this->provenance.spread(TaintLocation(regDst.getParent().getId()), TaintLocation(memSrc.getAddress(), memSrc.getSize()), true);
+          this->spreadRegister(regDst, TAINTED);
+          if (this->labelsFlag)
+            this->setRegisterLabelSet(regDst, set);
           return TAINTED;
         }
 
+        this->spreadRegister(regDst, this->isRegisterTainted(regDst));
         return this->isRegisterTainted(regDst);
       }
 
@@ -473,7 +882,11 @@ namespace triton {
           return this->isMemoryTainted(memDst);
 
         if (this->isRegisterTainted(regSrc)) {
-          this->taintMemory(memDst);
+          if (this->provenanceFlag)
+            this->provenance.spread(TaintLocation(memDst.getAddress(), memDst.getSize()), TaintLocation(regSrc.getParent().getId()), true);
+          this->taintedMemory.set(memDst.getAddress(), memDst.getSize());
+          if (this->labelsFlag)
+            this->mergeMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
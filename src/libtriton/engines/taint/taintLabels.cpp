@@ -0,0 +1,101 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <exceptions.hpp>
+#include <taintLabels.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      TaintLabels::TaintLabels() {
+        this->clear();
+      }
+
+
+      triton::usize TaintLabels::intern(const std::vector<triton::uint32>& labels) {
+        std::vector<triton::uint32> key = labels;
+        std::map<std::vector<triton::uint32>, triton::usize>::iterator it;
+
+        std::sort(key.begin(), key.end());
+        key.erase(std::unique(key.begin(), key.end()), key.end());
+
+        it = this->index.find(key);
+        if (it != this->index.end())
+          return it->second;
+
+        this->sets.push_back(key);
+        this->index[key] = this->sets.size() - 1;
+
+        return this->sets.size() - 1;
+      }
+
+
+      triton::usize TaintLabels::single(triton::uint32 label) {
+        return this->intern(std::vector<triton::uint32>(1, label));
+      }
+
+
+      triton::usize TaintLabels::merge(triton::usize set1, triton::usize set2) {
+        std::map<std::pair<triton::usize, triton::usize>, triton::usize>::iterator it;
+        std::vector<triton::uint32> labels;
+        triton::usize id;
+
+        if (set1 == set2 || set2 == EMPTY_LABEL_SET)
+          return set1;
+
+        if (set1 == EMPTY_LABEL_SET)
+          return set2;
+
+        if (set1 > set2)
+          std::swap(set1, set2);
+
+        it = this->unions.find(std::make_pair(set1, set2));
+        if (it != this->unions.end())
+          return it->second;
+
+        const std::vector<triton::uint32>& labels1 = this->getLabels(set1);
+        const std::vector<triton::uint32>& labels2 = this->getLabels(set2);
+        std::set_union(labels1.begin(), labels1.end(), labels2.begin(), labels2.end(), std::back_inserter(labels));
+
+        id = this->intern(labels);
+        this->unions[std::make_pair(set1, set2)] = id;
+
+        return id;
+      }
+
+
+      const std::vector<triton::uint32>& TaintLabels::getLabels(triton::usize set) const {
+        if (set >= this->sets.size())
+          throw triton::exceptions::TaintEngine("TaintLabels::getLabels(): Invalid label set id.");
+        return this->sets[set];
+      }
+
+
+      triton::usize TaintLabels::size(void) const {
+        return this->sets.size();
+      }
+
+
+      void TaintLabels::clear(void) {
+        this->sets.clear();
+        this->index.clear();
+        this->unions.clear();
+
+        /* The id 0 is always the empty set */
+        this->sets.push_back(std::vector<triton::uint32>());
+        this->index[this->sets[EMPTY_LABEL_SET]] = EMPTY_LABEL_SET;
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
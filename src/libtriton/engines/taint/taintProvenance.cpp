@@ -0,0 +1,228 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <list>
+#include <set>
+
+#include <exceptions.hpp>
+#include <taintProvenance.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      TaintLocation::TaintLocation(triton::uint64 addr, triton::uint32 size) {
+        this->isRegister = false;
+        this->value      = addr;
+        this->size       = size;
+      }
+
+
+      TaintLocation::TaintLocation(triton::uint32 parentId) {
+        this->isRegister = true;
+        this->value      = parentId;
+        this->size       = 0;
+      }
+
+
+      TaintEvent::TaintEvent() : location(0, 0) {
+        this->id              = 0;
+        this->address         = 0;
+        this->numberOfParents = 0;
+      }
+
+
+      TaintProvenance::TaintProvenance(triton::usize capacity) {
+        if (capacity == 0)
+          throw triton::exceptions::TaintEngine("TaintProvenance::TaintProvenance(): The capacity must be greater than 0.");
+        this->capacity = capacity;
+        this->clear();
+      }
+
+
+      triton::usize TaintProvenance::getCapacity(void) const {
+        return this->capacity;
+      }
+
+
+      bool TaintProvenance::isAlive(triton::uint64 id) const {
+        return (id != 0 && id < this->nextId && this->nextId - id <= this->capacity);
+      }
+
+
+      const TaintEvent& TaintProvenance::getEvent(triton::uint64 id) const {
+        if (!this->isAlive(id))
+          throw triton::exceptions::TaintEngine("TaintProvenance::getEvent(): The event has been dropped or does not exist.");
+        return this->events[(id - 1) % this->capacity];
+      }
+
+
+      void TaintProvenance::collectWriters(const TaintLocation& loc, std::vector<triton::uint64>& parents, triton::usize limit) const {
+        if (loc.isRegister) {
+          std::map<triton::uint32, triton::uint64>::const_iterator it = this->registerWriters.find(static_cast<triton::uint32>(loc.value));
+          if (it != this->registerWriters.end() && this->isAlive(it->second) && parents.size() < limit && std::find(parents.begin(), parents.end(), it->second) == parents.end())
+            parents.push_back(it->second);
+          return;
+        }
+
+        if (this->memoryWriters.empty())
+          return;
+
+        for (triton::uint32 index = 0; index < loc.size && parents.size() < limit; index++) {
+          std::unordered_map<triton::uint64, triton::uint64>::const_iterator it = this->memoryWriters.find(loc.value + index);
+          if (it != this->memoryWriters.end() && this->isAlive(it->second) && std::find(parents.begin(), parents.end(), it->second) == parents.end())
+            parents.push_back(it->second);
+        }
+      }
+
+
+      void TaintProvenance::addEvent(const TaintLocation& loc, const std::vector<triton::uint64>& parents) {
+        triton::uint64 id   = this->nextId++;
+        triton::usize index = (id - 1) % this->capacity;
+
+        if (index == this->events.size())
+          this->events.push_back(TaintEvent());
+
+        TaintEvent& event = this->events[index];
+
+        event.id              = id;
+        event.address         = this->address;
+        event.location        = loc;
+        event.numberOfParents = static_cast<triton::uint32>(std::min<triton::usize>(parents.size(), TAINT_PROVENANCE_MAX_PARENTS));
+        for (triton::uint32 parent = 0; parent < event.numberOfParents; parent++)
+          event.parents[parent] = parents[parent];
+
+        if (loc.isRegister) {
+          this->registerWriters[static_cast<triton::uint32>(loc.value)] = id;
+          return;
+        }
+
+        for (triton::uint32 offset = 0; offset < loc.size; offset++)
+          this->memoryWriters[loc.value + offset] = id;
+
+        if (this->memoryWriters.size() > this->purgeThreshold)
+          this->purge();
+      }
+
+
+      void TaintProvenance::purge(void) {
+        std::unordered_map<triton::uint64, triton::uint64>::iterator mit;
+        std::map<triton::uint32, triton::uint64>::iterator rit;
+
+        for (mit = this->memoryWriters.begin(); mit != this->memoryWriters.end();) {
+          if (this->isAlive(mit->second))
+            mit++;
+          else
+            mit = this->memoryWriters.erase(mit);
+        }
+
+        for (rit = this->registerWriters.begin(); rit != this->registerWriters.end();) {
+          if (this->isAlive(rit->second))
+            rit++;
+          else
+            this->registerWriters.erase(rit++);
+        }
+
+        /* Writers of alive events may still grow, the next purge is delayed accordingly */
+        this->purgeThreshold = std::max(this->memoryWriters.size() * 2, this->capacity);
+      }
+
+
+      void TaintProvenance::enterInstruction(triton::uint64 addr) {
+        this->address            = addr;
+        this->instructionFirstId = this->nextId;
+      }
+
+
+      void TaintProvenance::leaveInstruction(void) {
+        this->instructionFirstId = 0;
+      }
+
+
+      void TaintProvenance::spread(const TaintLocation& dst, const TaintLocation& src, bool keep) {
+        std::vector<triton::uint64> parents;
+
+        this->collectWriters(src, parents, TAINT_PROVENANCE_MAX_PARENTS);
+        if (keep)
+          this->collectWriters(dst, parents, TAINT_PROVENANCE_MAX_PARENTS);
+
+        this->addEvent(dst, parents);
+      }
+
+
+      void TaintProvenance::introduce(const TaintLocation& dst) {
+        std::vector<triton::uint64> parents;
+
+        /* Flags are tainted from the result of the instruction, the closest events first */
+        if (this->instructionFirstId) {
+          for (triton::uint64 id = this->nextId - 1; id >= this->instructionFirstId && parents.size() < TAINT_PROVENANCE_MAX_PARENTS; id--) {
+            if (this->isAlive(id))
+              parents.push_back(id);
+          }
+        }
+
+        this->addEvent(dst, parents);
+      }
+
+
+      void TaintProvenance::remove(const TaintLocation& loc) {
+        if (loc.isRegister) {
+          this->registerWriters.erase(static_cast<triton::uint32>(loc.value));
+          return;
+        }
+
+        if (this->memoryWriters.empty())
+          return;
+
+        for (triton::uint32 index = 0; index < loc.size; index++)
+          this->memoryWriters.erase(loc.value + index);
+      }
+
+
+      std::vector<TaintEvent> TaintProvenance::backtrack(const TaintLocation& loc) const {
+        std::vector<TaintEvent> ret;
+        std::vector<triton::uint64> roots;
+        std::list<triton::uint64> worklist;
+        std::set<triton::uint64> visited;
+
+        this->collectWriters(loc, roots, static_cast<triton::usize>(-1));
+        worklist.insert(worklist.end(), roots.begin(), roots.end());
+
+        /* Breadth-first, thus the closest events come first */
+        while (!worklist.empty()) {
+          triton::uint64 id = worklist.front();
+          worklist.pop_front();
+
+          if (!this->isAlive(id) || !visited.insert(id).second)
+            continue;
+
+          const TaintEvent& event = this->getEvent(id);
+          ret.push_back(event);
+          for (triton::uint32 index = 0; index < event.numberOfParents; index++)
+            worklist.push_back(event.parents[index]);
+        }
+
+        return ret;
+      }
+
+
+      void TaintProvenance::clear(void) {
+        this->nextId             = 1;
+        this->address            = 0;
+        this->instructionFirstId = 0;
+        this->purgeThreshold     = this->capacity;
+        this->events.clear();
+        this->memoryWriters.clear();
+        this->registerWriters.clear();
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
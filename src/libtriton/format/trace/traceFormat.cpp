@@ -0,0 +1,110 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+#include <sstream>
+
+#include <astSerialization.hpp>
+#include <exceptions.hpp>
+#include <traceFormat.hpp>
+
+
+
+namespace triton {
+  namespace format {
+    namespace trace {
+
+      /* The shortest match and the size of the hash table of the compressor */
+      const triton::usize MIN_MATCH = 4;
+      const triton::usize HASH_BITS = 14;
+
+
+      static triton::uint32 hashSequence(const char* data) {
+        triton::uint32 sequence = 0;
+        std::memcpy(&sequence, data, sizeof(sequence));
+        return (sequence * 2654435761U) >> (32 - HASH_BITS);
+      }
+
+
+      /* A block is a list of sequences: the number of literals, the literals, then the length and the distance of a match */
+      std::string compressBlock(const std::string& input) {
+        std::vector<triton::usize> table(1 << HASH_BITS, 0);
+        std::ostringstream output;
+        triton::usize anchor = 0;
+        triton::usize pos = 0;
+
+        while (pos + MIN_MATCH <= input.size()) {
+          triton::uint32 hash = hashSequence(&input[pos]);
+          triton::usize candidate = table[hash];
+
+          /* The table holds the position + 1, 0 is an empty slot */
+          table[hash] = pos + 1;
+          if (candidate == 0 || std::memcmp(&input[candidate - 1], &input[pos], MIN_MATCH) != 0) {
+            pos++;
+            continue;
+          }
+
+          triton::usize match = candidate - 1;
+          triton::usize length = MIN_MATCH;
+          while (pos + length < input.size() && input[match + length] == input[pos + length])
+            length++;
+
+          triton::ast::writeVarint(output, static_cast<triton::uint64>(pos - anchor));
+          output.write(input.data() + anchor, pos - anchor);
+          triton::ast::writeVarint(output, static_cast<triton::uint64>(length - MIN_MATCH));
+          triton::ast::writeVarint(output, static_cast<triton::uint64>(pos - match));
+
+          pos += length;
+          anchor = pos;
+        }
+
+        /* The last sequence only holds literals */
+        triton::ast::writeVarint(output, static_cast<triton::uint64>(input.size() - anchor));
+        output.write(input.data() + anchor, input.size() - anchor);
+
+        return output.str();
+      }
+
+
+      std::string decompressBlock(const std::string& input, triton::usize size) {
+        std::istringstream stream(input);
+        std::string output;
+
+        output.reserve(size);
+        while (true) {
+          triton::uint64 literals = triton::ast::readVarint(stream);
+          if (literals > size - output.size())
+            throw triton::exceptions::Trace("triton::format::trace::decompressBlock(): Corrupted block.");
+
+          std::string::size_type start = output.size();
+          output.resize(start + literals);
+          stream.read(&output[start], literals);
+          if (static_cast<triton::uint64>(stream.gcount()) != literals)
+            throw triton::exceptions::Trace("triton::format::trace::decompressBlock(): Unexpected end of block.");
+
+          if (output.size() == size)
+            break;
+
+          triton::uint64 length   = triton::ast::readVarint(stream) + MIN_MATCH;
+          triton::uint64 distance = triton::ast::readVarint(stream);
+          if (distance == 0 || distance > output.size() || length > size - output.size())
+            throw triton::exceptions::Trace("triton::format::trace::decompressBlock(): Corrupted block.");
+
+          /* The match may overlap the bytes it writes */
+          for (triton::usize index = output.size() - distance; length; length--)
+            output.push_back(output[index++]);
+        }
+
+        if (stream.peek() != std::char_traits<char>::eof())
+          throw triton::exceptions::Trace("triton::format::trace::decompressBlock(): Corrupted block.");
+
+        return output;
+      }
+
+    }; /* trace namespace */
+  }; /* format namespace */
+}; /* triton namespace */
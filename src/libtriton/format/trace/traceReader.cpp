@@ -0,0 +1,120 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <astSerialization.hpp>
+#include <exceptions.hpp>
+#include <traceReader.hpp>
+
+
+
+namespace triton {
+  namespace format {
+    namespace trace {
+
+      TraceReader::TraceReader(std::istream& stream) {
+        std::string payload;
+
+        this->stream            = &stream;
+        this->finished          = false;
+        this->blockCount        = 0;
+        this->nextAddress       = 0;
+        this->lastMemoryAddress = 0;
+
+        triton::ast::readHeader(stream);
+        if (triton::ast::readSection(stream, payload) != triton::ast::SECTION_TRACE)
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): The file is not an execution trace.");
+
+        std::istringstream info(payload);
+        this->architecture = static_cast<triton::uint32>(triton::ast::readVarint(info));
+      }
+
+
+      triton::uint32 TraceReader::getArchitecture(void) const {
+        return this->architecture;
+      }
+
+
+      bool TraceReader::nextBlock(void) {
+        std::string payload;
+
+        while (!this->finished) {
+          enum triton::ast::serialization_section_e kind = triton::ast::readSection(*this->stream, payload);
+
+          if (kind == triton::ast::SECTION_END)
+            this->finished = true;
+
+          /* The unknown sections are skipped */
+          else if (kind == triton::ast::SECTION_TRACE_BLOCK) {
+            std::istringstream header(payload);
+            triton::usize count = triton::ast::readVarint(header);
+            triton::usize size  = triton::ast::readVarint(header);
+            std::string records = payload.substr(static_cast<triton::usize>(header.tellg()));
+
+            this->block.str(decompressBlock(records, size));
+            this->block.clear();
+            this->blockCount        = count;
+            this->nextAddress       = 0;
+            this->lastMemoryAddress = 0;
+            this->blockOpcodes.clear();
+            this->blockRegisters.clear();
+
+            if (count)
+              return true;
+          }
+        }
+
+        return false;
+      }
+
+
+      bool TraceReader::next(TraceRecord& record) {
+        if (this->blockCount == 0) {
+          if (this->block.peek() != std::char_traits<char>::eof())
+            throw triton::exceptions::Trace("TraceReader::next(): Corrupted block.");
+          if (!this->nextBlock())
+            return false;
+        }
+
+        record.address = unzigzag(triton::ast::readVarint(this->block), this->nextAddress);
+
+        /* Empty opcodes are the ones already read at this address */
+        std::string bytes = triton::ast::readString(this->block);
+        if (bytes.empty()) {
+          std::unordered_map<triton::uint64, std::vector<triton::uint8>>::const_iterator cached = this->blockOpcodes.find(record.address);
+          if (cached == this->blockOpcodes.end())
+            throw triton::exceptions::Trace("TraceReader::next(): Corrupted block.");
+          record.opcodes = cached->second;
+        }
+        else {
+          record.opcodes.assign(bytes.begin(), bytes.end());
+          this->blockOpcodes[record.address] = record.opcodes;
+        }
+        this->nextAddress = record.address + record.opcodes.size();
+
+        record.registers.clear();
+        for (triton::uint64 count = triton::ast::readVarint(this->block); count; count--) {
+          triton::uint32 regId = static_cast<triton::uint32>(triton::ast::readVarint(this->block));
+          triton::uint512& value = this->blockRegisters[regId];
+          value ^= triton::ast::readVarint512(this->block);
+          record.registers.push_back(triton::arch::Register(regId, value));
+        }
+
+        record.memory.clear();
+        for (triton::uint64 count = triton::ast::readVarint(this->block); count; count--) {
+          triton::uint64 address = unzigzag(triton::ast::readVarint(this->block), this->lastMemoryAddress);
+          triton::uint32 size    = static_cast<triton::uint32>(triton::ast::readVarint(this->block));
+          record.memory.push_back(triton::arch::MemoryAccess(address, size, triton::ast::readVarint512(this->block)));
+          this->lastMemoryAddress = address;
+        }
+
+        this->blockCount--;
+        return true;
+      }
+
+    }; /* trace namespace */
+  }; /* format namespace */
+}; /* triton namespace */
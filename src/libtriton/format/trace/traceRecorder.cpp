@@ -0,0 +1,159 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <astSerialization.hpp>
+#include <exceptions.hpp>
+#include <traceRecorder.hpp>
+
+
+
+namespace triton {
+  namespace format {
+    namespace trace {
+
+      TraceRecorder::TraceRecorder(std::ostream& stream, triton::uint32 arch, triton::usize blockRecords) {
+        std::ostringstream info;
+
+        if (blockRecords == 0)
+          throw triton::exceptions::Trace("TraceRecorder::TraceRecorder(): A block holds at least one record.");
+
+        this->stream                = &stream;
+        this->blockRecords          = blockRecords;
+        this->numberOfInstructions  = 0;
+        this->closed                = false;
+        this->blockCount            = 0;
+        this->nextAddress           = 0;
+        this->lastMemoryAddress     = 0;
+
+        triton::ast::writeHeader(stream);
+        triton::ast::writeVarint(info, static_cast<triton::uint64>(arch));
+        triton::ast::writeSection(stream, triton::ast::SECTION_TRACE, info.str());
+      }
+
+
+      TraceRecorder::~TraceRecorder() {
+        /* A destructor must not throw, a failure is seen by the reader as a truncated trace */
+        try {
+          this->close();
+        }
+        catch (const std::exception&) {
+        }
+      }
+
+
+      void TraceRecorder::addRegisterValue(const triton::arch::Register& reg) {
+        this->addRegisterValue(reg.getId(), reg.getConcreteValue());
+      }
+
+
+      void TraceRecorder::addRegisterValue(triton::uint32 regId, triton::uint512 value) {
+        this->pendingRegisters.push_back(std::make_pair(regId, value));
+      }
+
+
+      void TraceRecorder::addMemoryValue(const triton::arch::MemoryAccess& mem) {
+        this->pendingMemory.push_back(mem);
+      }
+
+
+      void TraceRecorder::addInstruction(triton::uint64 address, const triton::uint8* opcodes, triton::uint32 size) {
+        std::string bytes(reinterpret_cast<const char*>(opcodes), size);
+
+        if (this->closed)
+          throw triton::exceptions::Trace("TraceRecorder::addInstruction(): The trace is closed.");
+
+        if (size == 0)
+          throw triton::exceptions::Trace("TraceRecorder::addInstruction(): An instruction has at least one opcode.");
+
+        triton::ast::writeVarint(this->block, zigzag(address, this->nextAddress));
+        this->nextAddress = address + size;
+
+        /* The opcodes of a loop are written once per block */
+        std::unordered_map<triton::uint64, std::string>::iterator cached = this->blockOpcodes.find(address);
+        if (cached != this->blockOpcodes.end() && cached->second == bytes)
+          triton::ast::writeVarint(this->block, static_cast<triton::uint64>(0));
+        else {
+          triton::ast::writeString(this->block, bytes);
+          this->blockOpcodes[address] = bytes;
+        }
+
+        triton::ast::writeVarint(this->block, static_cast<triton::uint64>(this->pendingRegisters.size()));
+        for (const std::pair<triton::uint32, triton::uint512>& reg : this->pendingRegisters) {
+          triton::uint512& previous = this->blockRegisters[reg.first];
+          triton::ast::writeVarint(this->block, static_cast<triton::uint64>(reg.first));
+          triton::ast::writeVarint(this->block, reg.second ^ previous);
+          previous = reg.second;
+        }
+
+        triton::ast::writeVarint(this->block, static_cast<triton::uint64>(this->pendingMemory.size()));
+        for (const triton::arch::MemoryAccess& mem : this->pendingMemory) {
+          triton::ast::writeVarint(this->block, zigzag(mem.getAddress(), this->lastMemoryAddress));
+          triton::ast::writeVarint(this->block, static_cast<triton::uint64>(mem.getSize()));
+          triton::ast::writeVarint(this->block, mem.getConcreteValue());
+          this->lastMemoryAddress = mem.getAddress();
+        }
+
+        this->pendingRegisters.clear();
+        this->pendingMemory.clear();
+        this->numberOfInstructions++;
+
+        if (++this->blockCount == this->blockRecords)
+          this->flush();
+      }
+
+
+      void TraceRecorder::addInstruction(const triton::arch::Instruction& inst) {
+        this->addInstruction(inst.getAddress(), inst.getOpcodes(), inst.getSize());
+      }
+
+
+      triton::usize TraceRecorder::getNumberOfInstructions(void) const {
+        return this->numberOfInstructions;
+      }
+
+
+      void TraceRecorder::flush(void) {
+        std::ostringstream payload;
+        std::string records = this->block.str();
+
+        if (this->blockCount == 0)
+          return;
+
+        triton::ast::writeVarint(payload, static_cast<triton::uint64>(this->blockCount));
+        triton::ast::writeVarint(payload, static_cast<triton::uint64>(records.size()));
+        payload << compressBlock(records);
+        triton::ast::writeSection(*this->stream, triton::ast::SECTION_TRACE_BLOCK, payload.str());
+
+        if (this->stream->fail())
+          throw triton::exceptions::Trace("TraceRecorder::flush(): Cannot write the trace.");
+
+        /* Each block is decoded on its own */
+        this->block.str("");
+        this->blockCount        = 0;
+        this->nextAddress       = 0;
+        this->lastMemoryAddress = 0;
+        this->blockOpcodes.clear();
+        this->blockRegisters.clear();
+      }
+
+
+      void TraceRecorder::close(void) {
+        if (this->closed)
+          return;
+
+        this->closed = true;
+        this->flush();
+        triton::ast::writeSection(*this->stream, triton::ast::SECTION_END, "");
+        this->stream->flush();
+
+        if (this->stream->fail())
+          throw triton::exceptions::Trace("TraceRecorder::close(): Cannot write the trace.");
+      }
+
+    }; /* trace namespace */
+  }; /* format namespace */
+}; /* triton namespace */
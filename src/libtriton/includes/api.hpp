@@ -8,19 +8,27 @@
 #ifndef TRITON_API_H
 #define TRITON_API_H
 
+#include <set>
+#include <utility>
+#include <vector>
+
 #include "architecture.hpp"
 #include "ast.hpp"
 #include "astGarbageCollector.hpp"
 #include "astRepresentation.hpp"
+#include "basicBlock.hpp"
+#include "binaryInterface.hpp"
 #include "callbacks.hpp"
 #include "immediate.hpp"
 #include "instruction.hpp"
 #include "memoryAccess.hpp"
 #include "operandWrapper.hpp"
 #include "register.hpp"
+#include "semanticsTemplate.hpp"
 #include "solverEngine.hpp"
 #include "symbolicEngine.hpp"
 #include "taintEngine.hpp"
+#include "traceReader.hpp"
 #include "tritonTypes.hpp"
 
 #ifdef TRITON_PYTHON_BINDINGS
@@ -36,6 +44,9 @@ namespace triton {
  *  @{
  */
 
+    //! Defines the maximum number of addresses kept by the translation cache. The whole cache is flushed when it is full.
+    const triton::usize TRANSLATION_CACHE_CAPACITY = 0x10000;
+
     /*! \class API
      *  \brief This is used as C++ API. */
     class API {
@@ -65,6 +76,21 @@ namespace triton {
         //! The Callbacks interface.
         triton::callbacks::Callbacks callbacks;
 
+        //! The cache of pre-decoded basic blocks. **item1**: start address<br>**item2**: basic block
+        std::map<triton::uint64, triton::arch::BasicBlock> blockCache;
+
+        //! The translation cache of decoded instructions. **item1**: address<br>**item2**: decoded instruction
+        std::map<triton::uint64, triton::arch::Instruction> translationCache;
+
+        //! The semantics templates of the processed instructions. **item1**: address<br>**item2**: template
+        std::map<triton::uint64, triton::arch::SemanticsTemplate> semanticsTemplates;
+
+        //! Disassembles the instruction through the translation cache. The instruction is decoded only if its address and opcodes are not cached.
+        void cachedDisassembly(triton::arch::Instruction& inst);
+
+        //! Removes the flag expressions of a processed block which are overwritten before being read. \sa triton::engines::symbolic::DEAD_FLAGS_ELIMINATION.
+        void deadFlagsElimination(std::vector<triton::arch::Instruction>& block);
+
       public:
         //! Constructor of the API.
         API();
@@ -122,6 +148,9 @@ namespace triton {
          */
         std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> getCpuRegInformation(triton::uint32 reg) const;
 
+        //! [**architecture api**] - Returns the specification (name, bits and parent) of the register. This does not allocate anything.
+        triton::arch::RegisterSpecification getCpuRegSpecification(triton::uint32 reg) const;
+
         //! [**architecture api**] - Returns all registers. \sa triton::arch::x86::registers_e.
         std::set<triton::arch::Register*> getAllRegisters(void) const;
 
@@ -137,6 +166,9 @@ namespace triton {
         //! [**architecture api**] - Returns the concrete value of a memory area.
         std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! [**architecture api**] - Copies the concrete value of a memory area into `area`, which must hold `size` bytes. No intermediate buffer is allocated.
+        void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
         //! [**architecture api**] - Returns the concrete value of a register.
         triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
@@ -196,9 +228,51 @@ namespace triton {
 
         /* Processing API ================================================================================ */
 
-        //! [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported.
+        /*!
+         * \brief [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported.
+         *
+         * \description If the triton::engines::symbolic::SEMANTICS_TEMPLATES optimization is enabled, the decoding of an
+         * instruction is cached per address (and checked against its opcodes), so an instruction executed several times
+         * (e.g. in a loop) is disassembled only once. \sa clearTranslationCache().
+         */
         bool processing(triton::arch::Instruction& inst);
 
+        /*!
+         * \brief [**proccesing api**] - Disassembles a basic block starting at `addr`. The block ends after the first control flow instruction or at the end of `area`.
+         *
+         * \description The decoded block is cached by its start address and is returned without disassembling
+         * it again as long as `area` contains the same opcodes. A block cut short by the end of `area` is decoded
+         * again when a larger area is given. The cache holds at most triton::TRANSLATION_CACHE_CAPACITY blocks
+         * and is flushed when it is full. \sa processBlock().
+         */
+        const triton::arch::BasicBlock& disassemblyBlock(const triton::uint8* area, triton::usize size, triton::uint64 addr);
+
+        /*!
+         * \brief [**proccesing api**] - Processes a basic block and updates engines according to the semantics of each instruction.
+         *
+         * \description The block is pre-decoded once (see disassemblyBlock()) and then only semantics are built for
+         * each instruction. If the triton::engines::symbolic::DEAD_FLAGS_ELIMINATION optimization is enabled, flag expressions
+         * which are overwritten inside the block before being read are removed. Returns the processed instructions.
+         */
+        std::vector<triton::arch::Instruction> processBlock(const triton::uint8* area, triton::usize size, triton::uint64 addr);
+
+        //! [**proccesing api**] - Removes all pre-decoded basic blocks from the cache.
+        void clearBlockCache(void);
+
+        /*!
+         * \brief [**proccesing api**] - Removes all decoded instructions and semantics templates from the translation cache used by processing().
+         *
+         * \description The cache holds at most triton::TRANSLATION_CACHE_CAPACITY addresses and is flushed when it is full.
+         * Clearing it releases its memory, e.g. once a code area has been unmapped or is not executed anymore.
+         */
+        void clearTranslationCache(void);
+
+        //! [**proccesing api**] - Returns the semantics template recorded for the instruction's address and opcodes, nullptr if there is none. \sa triton::engines::symbolic::SEMANTICS_TEMPLATES.
+        const triton::arch::SemanticsTemplate* getSemanticsTemplate(const triton::arch::Instruction& inst) const;
+
+        //! [**proccesing api**] - Records the semantics just built for an instruction as a template. Returns false if they cannot be instantiated again.
+        bool recordSemanticsTemplate(const triton::arch::Instruction& inst);
+
         //! [**proccesing api**] - Initialize everything.
         void initEngines(void);
 
@@ -210,6 +284,45 @@ namespace triton {
 
 
 
+        /* Emulation API ================================================================================= */
+
+        //! [**emulation api**] - Maps all memory areas of a binary (see triton::format::BinaryInterface::getMemoryMapping()) into the concrete memory.
+        void loadBinary(const triton::format::BinaryInterface& binary);
+
+        //! [**emulation api**] - Sets up a stack by pointing the stack pointer and the base pointer to `base`. Both registers are concretized.
+        void setupStack(triton::uint64 base);
+
+        /*!
+         * \brief [**emulation api**] - Emulates the code from `pc` and returns the number of processed instructions.
+         *
+         * \description Instructions are fetched from the concrete memory and processed in a native loop
+         * until one of the following conditions is met:
+         *
+         * - the program counter reaches an address of `stopAddrs` (this instruction is not processed).
+         * - `maxCount` instructions have been processed (0 means no limit).
+         * - the program counter points to an unmapped memory area or to an unsupported instruction (e.g. `hlt`).
+         * - a syscall has been processed and no SYSCALL callback has asked to go on (see triton::callbacks::syscallCallback).
+         *
+         * The program counter register always holds the address where the emulation has stopped, so it
+         * may be resumed by calling emulate() again.
+         */
+        triton::usize emulate(triton::uint64 pc, triton::usize maxCount=0, const std::set<triton::uint64>& stopAddrs=std::set<triton::uint64>());
+
+        /*!
+         * \brief [**emulation api**] - Replays an execution trace and returns the number of processed instructions.
+         *
+         * \description Before each instruction, the registers and the memory values of its record (see triton::format::trace::TraceRecorder)
+         * are set into the concrete state, then the instruction is processed. No instrumentation is involved, thus an analysis
+         * may be run many times on one capture. The replay stops at the end of the trace, after `maxCount` instructions (0 means
+         * no limit) or after an unsupported instruction, and it may be resumed with the same reader.
+         */
+        triton::usize replayTrace(triton::format::trace::TraceReader& reader, triton::usize maxCount=0);
+
+        //! [**emulation api**] - Replays an execution trace from a stream. The architecture of the trace is defined if there is none.
+        triton::usize replayTrace(std::istream& stream, triton::usize maxCount=0);
+
+
+
         /* AST Garbage Collector API ===================================================================== */
 
         //! [**AST garbage collector api**] - Raises an exception if the AST garbage collector interface is not initialized.
@@ -274,6 +387,9 @@ namespace triton {
         //! [**callbacks api**] - Adds a SYMBOLIC_SIMPLIFICATION callback.
         void addCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! [**callbacks api**] - Adds a SYSCALL callback.
+        void addCallback(triton::callbacks::syscallCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
         //! [**callbacks api**] - Adds a python callback.
         void addCallback(PyObject* function, triton::callbacks::callback_e kind);
@@ -291,6 +407,9 @@ namespace triton {
         //! [**callbacks api**] - Deletes a SYMBOLIC_SIMPLIFICATION callback.
         void removeCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! [**callbacks api**] - Deletes a SYSCALL callback.
+        void removeCallback(triton::callbacks::syscallCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
         //! [**callbacks api**] - Deletes a python callback according to its kind.
         void removeCallback(PyObject* function, triton::callbacks::callback_e kind);
@@ -305,6 +424,9 @@ namespace triton {
         //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const;
 
+        //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism. Returns false if there is no callback or if a callback has returned false.
+        bool processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Instruction& inst) const;
+
 
 
         /* Symbolic engine API =========================================================================== */
@@ -327,6 +449,9 @@ namespace triton {
         //! [**symbolic api**] - Returns the map (<Addr : SymExpr>) of symbolic memory defined.
         std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> getSymbolicMemory(void) const;
 
+        //! [**symbolic api**] - Returns the map (<Addr : SymExpr id>) of symbolic memory defined, without copy.
+        const std::map<triton::uint64, triton::usize>& getSymbolicMemoryReferences(void) const;
+
         //! [**symbolic api**] - Returns the symbolic expression id corresponding to the memory address.
         triton::usize getSymbolicMemoryId(triton::uint64 addr) const;
 
@@ -414,9 +539,42 @@ namespace triton {
         //! [**symbolic api**] - Returns all stats about AST Dictionaries.
         std::map<std::string, triton::usize> getAstDictionariesStats(void);
 
+        //! [**symbolic api**] - Canonicalizes a node just built if the optimization `AST_CANONICALIZATION` is enabled.
+        triton::ast::AbstractNode* canonicalizeAstNode(triton::ast::AbstractNode* node);
+
+        //! [**symbolic api**] - Folds the constants and the algebraic identities of a whole AST. Returns the folded node.
+        triton::ast::AbstractNode* foldAst(triton::ast::AbstractNode* node);
+
+        //! [**symbolic api**] - Folds the symbolic expressions created since the last call. Returns the number of expressions changed.
+        triton::usize foldSymbolicExpressions(void);
+
+        //! [**symbolic api**] - Writes the symbolic state into a binary file. \sa triton::engines::symbolic::SymbolicEngine::saveSymbolicState()
+        void saveSymbolicState(std::ostream& stream) const;
+
+        //! [**symbolic api**] - Replaces the symbolic state by the one written by `saveSymbolicState()`.
+        void loadSymbolicState(std::istream& stream);
+
         //! [**symbolic api**] - Processes all recorded simplifications. Returns the simplified node.
         triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node, bool z3=false) const;
 
+        //! [**symbolic api**] - Adds a native simplification rule written as `lhs -> rhs`.
+        void addSimplificationRule(const std::string& rule);
+
+        //! [**symbolic api**] - Adds a native simplification rule applied on every node.
+        void addSimplificationRule(triton::callbacks::symbolicSimplificationCallback cb);
+
+        //! [**symbolic api**] - Loads native simplification rules from a file. Returns the number of rules loaded.
+        triton::usize loadSimplificationRules(const std::string& path);
+
+        //! [**symbolic api**] - Loads a shared object which registers native simplification rules.
+        void loadSimplificationPlugin(const std::string& path);
+
+        //! [**symbolic api**] - Returns the native simplification rules written as `lhs -> rhs`.
+        std::vector<std::string> getSimplificationRules(void);
+
+        //! [**symbolic api**] - Removes all native simplification rules.
+        void clearSimplificationRules(void);
+
         //! [**symbolic api**] - Returns the symbolic expression corresponding to the id.
         triton::engines::symbolic::SymbolicExpression* getSymbolicExpressionFromId(triton::usize symExprId) const;
 
@@ -534,10 +692,22 @@ namespace triton {
         triton::engines::taint::TaintEngine* getTaintEngine(void);
 
         //! [**taint api**] - Returns the tainted addresses.
-        const std::set<triton::uint64>& getTaintedMemory(void) const;
+        std::set<triton::uint64> getTaintedMemory(void) const;
+
+        //! [**taint api**] - Returns the runs of tainted bytes as (address, length) pairs.
+        std::vector<std::pair<triton::uint64, triton::usize>> getTaintedMemoryRanges(void) const;
+
+        //! [**taint api**] - Returns the runs of tainted bytes inside [start:end) as (address, length) pairs.
+        std::vector<std::pair<triton::uint64, triton::usize>> getTaintedMemoryRanges(triton::uint64 start, triton::uint64 end) const;
+
+        //! [**taint api**] - Returns the number of tainted bytes inside [start:end).
+        triton::usize countTaintedMemory(triton::uint64 start, triton::uint64 end) const;
+
+        //! [**taint api**] - Looks for the first tainted byte at or after `addr`. Returns false if there is none, otherwise `found` is set.
+        bool getNextTaintedMemory(triton::uint64 addr, triton::uint64& found) const;
 
         //! [**taint api**] - Returns the tainted registers.
-        const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
+        std::set<triton::arch::Register> getTaintedRegisters(void) const;
 
         //! [**taint api**] - Enables or disables the taint engine.
         void enableTaintEngine(bool flag);
@@ -545,6 +715,36 @@ namespace triton {
         //! [**taint api**] - Returns true if the taint engine is enabled.
         bool isTaintEngineEnabled(void) const;
 
+        //! [**taint api**] - Enables or disables the labeled taint mode.
+        void enableTaintLabels(bool flag);
+
+        //! [**taint api**] - Returns true if the labeled taint mode is enabled.
+        bool isTaintLabelsEnabled(void) const;
+
+        //! [**taint api**] - Returns the labels which reach the address:size.
+        std::vector<triton::uint32> getMemoryTaintLabels(triton::uint64 addr, triton::uint32 size=1) const;
+
+        //! [**taint api**] - Returns the labels which reach the memory.
+        std::vector<triton::uint32> getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the labels which reach the register.
+        std::vector<triton::uint32> getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
+        //! [**taint api**] - Enables or disables the taint provenance recorder. Enabling it starts a new graph which keeps at most `capacity` events.
+        void enableTaintProvenance(bool flag, triton::usize capacity=triton::engines::taint::TAINT_PROVENANCE_DEFAULT_CAPACITY);
+
+        //! [**taint api**] - Returns true if the taint provenance recorder is enabled.
+        bool isTaintProvenanceEnabled(void) const;
+
+        //! [**taint api**] - Returns the events which have brought the taint to the address:size, the closest first.
+        std::vector<triton::engines::taint::TaintEvent> getMemoryTaintProvenance(triton::uint64 addr, triton::uint32 size=1) const;
+
+        //! [**taint api**] - Returns the events which have brought the taint to the memory, the closest first.
+        std::vector<triton::engines::taint::TaintEvent> getMemoryTaintProvenance(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the events which have brought the taint to the register, the closest first.
+        std::vector<triton::engines::taint::TaintEvent> getRegisterTaintProvenance(const triton::arch::Register& reg) const;
+
         //! [**taint api**] - Abstract taint verification.
         bool isTainted(const triton::arch::OperandWrapper& op) const;
 
@@ -566,6 +766,12 @@ namespace triton {
         //! [**taint api**] - Sets the flag (taint) to a register.
         bool setTaintRegister(const triton::arch::Register& reg, bool flag);
 
+        //! [**taint api**] - Sets the flag (taint) to a register written by an instruction. A tainted register takes the labels of the registers and the memory read by the instruction.
+        bool setTaintRegister(const triton::arch::Register& reg, bool flag, const triton::arch::Instruction& inst);
+
+        //! [**taint api**] - Sets the flag (taint) to a register computed from the sources. A tainted register takes the labels of the sources.
+        bool setTaintRegister(const triton::arch::Register& reg, bool flag, const std::vector<triton::arch::OperandWrapper>& sources);
+
         //! [**taint api**] - Taints an address.
         /*!
           \param addr the targeted address.
@@ -587,6 +793,30 @@ namespace triton {
         */
         bool taintRegister(const triton::arch::Register& reg);
 
+        //! [**taint api**] - Taints an address with a label.
+        /*!
+          \param addr the targeted address.
+          \param label the label added to the address (only kept if the labeled mode is enabled).
+          \return TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
+        */
+        bool taintMemory(triton::uint64 addr, triton::uint32 label);
+
+        //! [**taint api**] - Taints a memory with a label.
+        /*!
+          \param mem the memory access.
+          \param label the label added to the memory (only kept if the labeled mode is enabled).
+          \return TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+        */
+        bool taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+        //! [**taint api**] - Taints a register with a label.
+        /*!
+          \param reg the register operand.
+          \param label the label added to the register (only kept if the labeled mode is enabled).
+          \return TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+        */
+        bool taintRegister(const triton::arch::Register& reg, triton::uint32 label);
+
         //! [**taint api**] - Untaints an address.
         /*!
           \param addr the targeted address.
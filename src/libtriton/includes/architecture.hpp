@@ -110,6 +110,9 @@ namespace triton {
         */
         std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> getRegisterInformation(triton::uint32 reg) const;
 
+        //! Returns the specification of the register.
+        triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 reg) const;
+
         //! Returns all registers.
         std::set<triton::arch::Register*> getAllRegisters(void) const;
 
@@ -131,6 +134,9 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! Copies the concrete value of a memory area into `area`, which must hold `size` bytes.
+        void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
         //! Returns the concrete value of a register.
         triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
@@ -125,7 +125,7 @@ namespace triton {
         //! Entry point for a visitor.
         virtual void accept(AstVisitor& v) = 0;
 
-        //! Returns the has of the tree. The hash is computed recursively on the whole tree.
+        //! Returns the has of the tree. The hash is computed on the whole tree with an explicit stack (see hashAst()).
         virtual triton::uint512 hash(triton::uint32 deep) = 0;
     };
 
@@ -918,6 +918,18 @@ namespace triton {
     //! AST C++ API - Duplicates the AST
     AbstractNode* newInstance(AbstractNode* node);
 
+    //! AST C++ API - Returns true if the kind is an operator which may be rebuilt by buildNode().
+    bool isOperator(enum kind_e kind);
+
+    //! AST C++ API - Builds an operator node from its childs, DECIMAL_NODE childs (sizes and indexes) included.
+    AbstractNode* buildNode(enum kind_e kind, const std::vector<AbstractNode*>& childs);
+
+    //! AST C++ API - Returns the unique nodes of the DAG in post-order (the childs before their parents) without recursion. The references are followed if `unroll` is true.
+    std::vector<AbstractNode*> nodesExtraction(AbstractNode* root, bool unroll);
+
+    //! AST C++ API - Computes the hash of the tree `node` at the depth `deep` without recursion. The hash of a shared node is computed once per depth.
+    triton::uint512 hashAst(AbstractNode* node, triton::uint32 deep);
+
     //! Custom pow function for hash routine.
     triton::uint512 pow(triton::uint512 hash, triton::uint32 n);
 
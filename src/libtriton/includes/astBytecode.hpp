@@ -0,0 +1,207 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTBYTECODE_H
+#define TRITON_ASTBYTECODE_H
+
+#include <map>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! Defines the maximum size of the nodes of a compiled AST.
+    const triton::uint32 BYTECODE_MAX_BITS = 64;
+
+    //! Defines the number of inputs evaluated together by a batch.
+    const triton::uint32 BYTECODE_BATCH_LANES = 256;
+
+    //! \class AstBytecode
+    /*! \brief A compiled AST
+
+        \description An AST compiled into a linear bytecode. Each instruction computes one node of the DAG on
+        native 64-bits integers, thus a node shared by several parents is computed once. A register is reused
+        once its value is read for the last time, so the registers only hold the live values. References are
+        followed and the symbolic variables are read from slots, so the same bytecode may be run with many
+        values of its variables without any allocation of node. A batch of inputs is run lane by lane with the
+        SIMD instructions of the host (AVX2 or SSE2), or with scalar code.
+    */
+    class AstBytecode {
+
+      public:
+        //! The opcodes of the bytecode.
+        enum opcode_e {
+          OP_CONSTANT = 0,  /*!< immediate */
+          OP_VARIABLE,      /*!< values[immediate] */
+          OP_ADD,
+          OP_AND,
+          OP_ASHR,
+          OP_CONCAT,        /*!< (a << immediate) | b */
+          OP_DISTINCT,
+          OP_EQUAL,
+          OP_EXTRACT,       /*!< a >> immediate */
+          OP_ITE,
+          OP_LAND,
+          OP_LNOT,
+          OP_LOR,
+          OP_LSHR,
+          OP_MUL,
+          OP_NAND,
+          OP_NEG,
+          OP_NOR,
+          OP_NOT,
+          OP_OR,
+          OP_ROL,           /*!< immediate is the rotation */
+          OP_ROR,           /*!< immediate is the rotation */
+          OP_SDIV,
+          OP_SGE,           /*!< immediate is the size of the operands */
+          OP_SGT,           /*!< immediate is the size of the operands */
+          OP_SHL,
+          OP_SLE,           /*!< immediate is the size of the operands */
+          OP_SLT,           /*!< immediate is the size of the operands */
+          OP_SMOD,
+          OP_SREM,
+          OP_SUB,
+          OP_SX,            /*!< immediate is the size of the operand */
+          OP_UDIV,
+          OP_UGE,
+          OP_UGT,
+          OP_ULE,
+          OP_ULT,
+          OP_UREM,
+          OP_XNOR,
+          OP_XOR,
+        };
+
+        //! An instruction of the bytecode.
+        struct Instruction {
+          //! The opcode.
+          enum opcode_e opcode;
+
+          //! The size of the result.
+          triton::uint32 size;
+
+          //! The registers of the operands.
+          triton::uint32 operands[3];
+
+          //! The register of the result.
+          triton::uint32 result;
+
+          //! The immediate operand.
+          triton::uint64 immediate;
+
+          //! The mask of the result.
+          triton::uint64 mask;
+        };
+
+      protected:
+        //! The instructions, in the order of evaluation.
+        std::vector<Instruction> instructions;
+
+        //! The ids of the symbolic variables, ordered by slot.
+        std::vector<triton::usize> variables;
+
+        //! The register of the root.
+        triton::uint32 root;
+
+        //! The size of the root.
+        triton::uint32 size;
+
+        //! The number of registers.
+        triton::uint32 numberOfRegisters;
+
+        //! Appends an instruction and returns its index. The operands are the indexes of their instructions until allocateRegisters().
+        triton::uint32 emit(enum opcode_e opcode, triton::uint32 size, triton::uint32 op1=0, triton::uint32 op2=0, triton::uint32 op3=0, triton::uint64 immediate=0);
+
+        //! Compiles a node whose operands are compiled. Returns the index of its instruction.
+        triton::uint32 compileNode(triton::ast::AbstractNode* node, const std::vector<triton::uint32>& operands, std::map<triton::usize, triton::uint32>& slots);
+
+        //! Replaces the indexes of the instructions by registers, a register is reused after the last read of its value.
+        void allocateRegisters(void);
+
+      public:
+        //! Constructor.
+        AstBytecode();
+
+        //! Constructor. Compiles the node.
+        AstBytecode(triton::ast::AbstractNode* node);
+
+        //! Constructor by copy.
+        AstBytecode(const AstBytecode& copy);
+
+        //! Destructor.
+        ~AstBytecode();
+
+        //! Copies an AstBytecode.
+        void copy(const AstBytecode& other);
+
+        //! Compiles a node. Throws an exception if a node is wider than 64 bits or is not an expression.
+        void compile(triton::ast::AbstractNode* node);
+
+        //! Returns the instructions.
+        const std::vector<Instruction>& getInstructions(void) const;
+
+        //! Returns the ids of the symbolic variables, ordered by slot.
+        const std::vector<triton::usize>& getVariables(void) const;
+
+        //! Returns the size of the root.
+        triton::uint32 getBitvectorSize(void) const;
+
+        //! Returns the number of registers needed to run the bytecode.
+        triton::uint32 getNumberOfRegisters(void) const;
+
+        //! Runs the bytecode. `values` holds the value of each variable slot (see getVariables()).
+        triton::uint64 run(const std::vector<triton::uint64>& values) const;
+
+        //! Runs the bytecode. `values` is indexed by variable id, the missing variables take their concrete value.
+        triton::uint64 run(const std::map<triton::usize, triton::uint64>& values) const;
+
+        //! Runs the bytecode on `count` inputs. `values` is column-major, the `count` values of the slot i start at `values[i * count]`.
+        void runBatch(const triton::uint64* values, triton::usize count, triton::uint64* results) const;
+
+        //! Runs the bytecode on `count` inputs. `values` is column-major. Returns the `count` results.
+        std::vector<triton::uint64> runBatch(const std::vector<triton::uint64>& values, triton::usize count) const;
+
+        //! Copies an AstBytecode.
+        void operator=(const AstBytecode& other);
+    };
+
+    //! AST C++ API - Compiles a node into a bytecode.
+    AstBytecode compile(AbstractNode* node);
+
+    //! AST C++ API - Runs a compiled node. `values` holds the value of each variable slot.
+    triton::uint64 run(const AstBytecode& compiled, const std::vector<triton::uint64>& values);
+
+    //! AST C++ API - Runs a compiled node. `values` is indexed by variable id.
+    triton::uint64 run(const AstBytecode& compiled, const std::map<triton::usize, triton::uint64>& values);
+
+    //! AST C++ API - Runs a compiled node on `count` inputs. `values` is column-major.
+    std::vector<triton::uint64> runBatch(const AstBytecode& compiled, const std::vector<triton::uint64>& values, triton::usize count);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTBYTECODE_H */
@@ -0,0 +1,104 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTFOLDING_H
+#define TRITON_ASTFOLDING_H
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class AstFolding
+    /*! \brief The AST folding class
+
+        \description Folds constants and applies algebraic identities (identity and absorption laws, double negation,
+        extract of concat, zx and sx chains) on a whole DAG. Each node is folded once, the result is kept in a table
+        shared by all the folded trees, thus the nodes shared by several expressions are not folded again.
+    */
+    class AstFolding {
+
+      protected:
+        /*! \brief The map of folded nodes
+         *
+         * \description
+         * **item1**: node<br>
+         * **item2**: folded node
+         */
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> foldedNodes;
+
+        /*! \brief The reverse map of folded nodes
+         *
+         * \description
+         * **item1**: folded node<br>
+         * **item2**: the other nodes folded into it
+         */
+        std::unordered_map<triton::ast::AbstractNode*, std::unordered_set<triton::ast::AbstractNode*>> foldedFrom;
+
+        //! Records the folded node of a node.
+        void setFoldedNode(triton::ast::AbstractNode* node, triton::ast::AbstractNode* folded);
+
+        //! Applies a single rule on a node whose childs are folded. Returns the node if no rule applies.
+        triton::ast::AbstractNode* foldNode(triton::ast::AbstractNode* node) const;
+
+      public:
+        //! Constructor.
+        AstFolding();
+
+        //! Constructor by copy.
+        AstFolding(const AstFolding& copy);
+
+        //! Destructor.
+        ~AstFolding();
+
+        //! Copies an AstFolding.
+        void copy(const AstFolding& other);
+
+        //! Folds the whole tree up to a fixed point. Returns the folded node.
+        triton::ast::AbstractNode* foldAst(triton::ast::AbstractNode* node);
+
+        //! Orders the operands of a commutative node just built and applies a single folding rule. If another node is returned, `node` is deleted.
+        triton::ast::AbstractNode* canonicalizeAstNode(triton::ast::AbstractNode* node) const;
+
+        //! Returns the number of nodes in the table of folded nodes.
+        triton::usize getNumberOfFoldedNodes(void) const;
+
+        //! Clears the table of folded nodes. Must be called when all the nodes are freed.
+        void clearFoldedNodes(void);
+
+        //! Removes the freed nodes from the table of folded nodes. Must be called when nodes are freed.
+        void evictFoldedNodes(const std::set<triton::ast::AbstractNode*>& nodes);
+
+        //! Copies an AstFolding.
+        void operator=(const AstFolding& other);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTFOLDING_H */
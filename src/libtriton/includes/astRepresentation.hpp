@@ -9,6 +9,11 @@
 #define TRITON_ASTREPRESENTATION_H
 
 #include <iostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "astPythonRepresentation.hpp"
 #include "astRepresentationInterface.hpp"
 #include "astSmtRepresentation.hpp"
@@ -43,6 +48,7 @@ namespace triton {
       enum mode_e {
         SMT_REPRESENTATION,     /*!< SMT representation */
         PYTHON_REPRESENTATION,  /*!< Python representation */
+        SMT_DAG_REPRESENTATION, /*!< SMT representation, the shared nodes are bound by let */
         LAST_REPRESENTATION
       };
 
@@ -56,6 +62,30 @@ namespace triton {
           //! AstRepresentation interface.
           triton::ast::representations::AstRepresentationInterface* representations[triton::ast::representations::LAST_REPRESENTATION];
 
+          //! A node being printed: its own text and the childs to print at some offsets of this text.
+          struct PrintFrame {
+            //! The text of the node without its childs.
+            std::string text;
+
+            //! The childs and the offsets where they are printed.
+            std::vector<std::pair<triton::usize, triton::ast::AbstractNode*>> childs;
+
+            //! The next child to print.
+            triton::usize index;
+
+            //! The length of the text already printed.
+            triton::usize offset;
+          };
+
+          //! Prints a node alone with the format of `stream`. Its childs are recorded in the frame instead of being printed.
+          void printNode(const std::ostream& stream, AbstractNode* node, PrintFrame& frame);
+
+          //! Prints a tree. The nodes of `bindings` met below the root are printed as their name.
+          std::ostream& printTree(std::ostream& stream, AbstractNode* node, const std::unordered_map<AbstractNode*, std::string>* bindings);
+
+          //! Prints a term in the SMT_DAG_REPRESENTATION mode. The nodes with several parents are bound by let, grouped by level.
+          std::ostream& printDag(std::ostream& stream, AbstractNode* node);
+
 
         public:
           //! Constructor.
@@ -70,7 +100,7 @@ namespace triton {
           //! Sets the representation mode.
           void setMode(triton::uint32 mode);
 
-          //! Displays the node according to the representation mode.
+          //! Displays the node according to the representation mode. The tree is walked with an explicit stack.
           std::ostream& print(std::ostream& stream, AbstractNode* node);
       };
 
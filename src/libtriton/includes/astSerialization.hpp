@@ -0,0 +1,120 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTSERIALIZATION_H
+#define TRITON_ASTSERIALIZATION_H
+
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \brief The serialization format
+     *
+     * \description A serialized file starts with a fixed header: the magic `TRTN` and the version as 32-bits
+     * little-endian integers. Then comes a list of sections, each one is its kind on one byte and the length
+     * of its payload as 64-bits little-endian integer, thus a mapped file may be walked section by section
+     * without decoding the payloads. The list ends with a `SECTION_END`. Inside the payloads all integers are
+     * LEB128 varints.
+     *
+     * The `SECTION_AST` payload is a node table: the number of roots and their indexes, the number of nodes,
+     * then for each node its kind, its number of childs, the distance from each child to the node (the childs
+     * always come before their parents) and the value of the leaves (DECIMAL, REFERENCE, STRING and VARIABLE).
+     * A node shared by several parents or roots is written once.
+     */
+    const triton::uint32 SERIALIZATION_MAGIC = 0x4e545254;
+
+    //! The version of the serialization format.
+    const triton::uint32 SERIALIZATION_VERSION = 1;
+
+    //! The kinds of section of a serialized file.
+    enum serialization_section_e {
+      SECTION_END = 0,            /*!< End of the file */
+      SECTION_AST,                /*!< Node table */
+      SECTION_STATE,              /*!< Architecture and unique ids of the symbolic engine */
+      SECTION_VARIABLES,          /*!< Symbolic variables */
+      SECTION_EXPRESSIONS,        /*!< Symbolic expressions */
+      SECTION_REGISTERS,          /*!< Symbolic register state */
+      SECTION_MEMORY,             /*!< Memory references */
+      SECTION_PATH_CONSTRAINTS,   /*!< Path constraints */
+      SECTION_TRACE,              /*!< Architecture of an execution trace */
+      SECTION_TRACE_BLOCK,        /*!< Compressed block of trace records */
+    };
+
+    //! AST C++ API - Writes a varint.
+    void writeVarint(std::ostream& stream, triton::uint64 value);
+
+    //! AST C++ API - Writes a varint.
+    void writeVarint(std::ostream& stream, triton::uint512 value);
+
+    //! AST C++ API - Reads a varint. Throws an exception if it does not fit in 64 bits.
+    triton::uint64 readVarint(std::istream& stream);
+
+    //! AST C++ API - Reads a varint. Throws an exception if it does not fit in 512 bits.
+    triton::uint512 readVarint512(std::istream& stream);
+
+    //! AST C++ API - Writes a string as its length followed by its bytes.
+    void writeString(std::ostream& stream, const std::string& value);
+
+    //! AST C++ API - Reads a string.
+    std::string readString(std::istream& stream);
+
+    //! AST C++ API - Writes the header of a serialized file.
+    void writeHeader(std::ostream& stream);
+
+    //! AST C++ API - Reads the header of a serialized file. Throws an exception if the magic or the version does not match.
+    void readHeader(std::istream& stream);
+
+    //! AST C++ API - Writes a section.
+    void writeSection(std::ostream& stream, enum serialization_section_e kind, const std::string& payload);
+
+    //! AST C++ API - Reads a section. Returns its kind, `payload` receives its content.
+    enum serialization_section_e readSection(std::istream& stream, std::string& payload);
+
+    //! AST C++ API - Writes the node table of the DAGs of `roots`.
+    void writeNodeTable(std::ostream& stream, const std::vector<AbstractNode*>& roots);
+
+    /*!
+     * AST C++ API - Reads a node table and rebuilds its nodes. The symbolic variables must exist. `onRoot` is called with
+     * the position and the node of each root as soon as it is rebuilt, thus the symbolic expressions may be created before
+     * the nodes which reference them. Returns the roots.
+     */
+    std::vector<AbstractNode*> readNodeTable(std::istream& stream, const std::function<void(triton::usize, AbstractNode*)>& onRoot);
+
+    //! AST C++ API - Serializes the DAGs of `roots` into a file with a single `SECTION_AST`.
+    void serialize(std::ostream& stream, const std::vector<AbstractNode*>& roots);
+
+    //! AST C++ API - Deserializes the DAGs written by serialize(). Returns the roots.
+    std::vector<AbstractNode*> deserialize(std::istream& stream);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTSERIALIZATION_H */
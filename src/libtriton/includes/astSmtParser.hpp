@@ -0,0 +1,115 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTSMTPARSER_H
+#define TRITON_ASTSMTPARSER_H
+
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class AstSmtParser
+    /*! \brief The SMT-LIB2 parser
+
+        \description Builds Triton's nodes from an SMT-LIB2 script without Z3. The stream is read command by command
+        and the terms are parsed with an explicit stack, thus long scripts and deeply nested `let` are supported. The
+        nodes are built by the node builders, thus they are shared by the AST dictionaries when they are enabled.
+        `declare-fun` and `declare-const` are bound to symbolic variables, `define-fun` defines a constant or a macro
+        expanded at each application. Each `assert` and each top-level term gives back a node.
+    */
+    class AstSmtParser {
+
+      protected:
+        //! A function defined by `define-fun` with parameters.
+        struct Macro {
+          //! The names of the parameters.
+          std::vector<std::string> parameters;
+
+          //! The tokens of the body.
+          std::vector<std::string> body;
+        };
+
+        /*! \brief The map of the global symbols
+         *
+         * \description
+         * **item1**: symbol declared by `declare-fun` or defined by `define-fun` without parameter<br>
+         * **item2**: node
+         */
+        std::unordered_map<std::string, triton::ast::AbstractNode*> symbols;
+
+        //! The functions defined by `define-fun` with parameters.
+        std::unordered_map<std::string, Macro> macros;
+
+        //! Reads the tokens of the next top-level s-expression. Returns false at the end of the stream.
+        bool readCommand(std::istream& stream, std::vector<std::string>& tokens) const;
+
+        //! Parses the term starting at `tokens[index]`. `index` is moved after the term.
+        triton::ast::AbstractNode* parseTerm(const std::vector<std::string>& tokens, triton::usize& index);
+
+        //! Builds the application of an operator.
+        triton::ast::AbstractNode* apply(const std::string& head, const std::vector<triton::uint32>& indices, const std::vector<triton::ast::AbstractNode*>& args) const;
+
+        //! Binds a symbol to a symbolic variable of `size` bits.
+        void declare(const std::string& name, triton::uint32 size);
+
+      public:
+        //! Constructor.
+        AstSmtParser();
+
+        //! Constructor by copy.
+        AstSmtParser(const AstSmtParser& copy);
+
+        //! Destructor.
+        ~AstSmtParser();
+
+        //! Copies an AstSmtParser.
+        void copy(const AstSmtParser& other);
+
+        //! Parses the commands of the stream up to the next `assert` or top-level term. Returns its node, nullptr at the end of the stream.
+        triton::ast::AbstractNode* parseNext(std::istream& stream);
+
+        //! Parses a whole stream. Returns the nodes of the assertions and of the top-level terms.
+        std::vector<triton::ast::AbstractNode*> parse(std::istream& stream);
+
+        //! Parses a whole script. Returns the nodes of the assertions and of the top-level terms.
+        std::vector<triton::ast::AbstractNode*> parse(const std::string& script);
+
+        //! Copies an AstSmtParser.
+        void operator=(const AstSmtParser& other);
+    };
+
+    //! AST C++ API - Parses an SMT-LIB2 script. Returns the nodes of the assertions and of the top-level terms.
+    std::vector<AbstractNode*> parseSmtLib2(std::istream& stream);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTSMTPARSER_H */
@@ -0,0 +1,112 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_BASICBLOCK_H
+#define TRITON_BASICBLOCK_H
+
+#include <ostream>
+#include <vector>
+
+#include "instruction.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Triton namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class BasicBlock
+     *  \brief This class is used to represent a straight-line run of pre-decoded instructions.
+     *
+     *  \description A basic block starts at a given address and ends after the first control
+     *  flow instruction (or at the end of the decoded area). Instructions are stored in their
+     *  disassembled form only (no semantics), so a block may be replayed as many times as needed
+     *  without paying the disassembly cost again.
+     */
+    class BasicBlock {
+
+      protected:
+        //! The start address of the block.
+        triton::uint64 address;
+
+        //! The opcodes of the whole block. Used to check if the cached block is still valid.
+        std::vector<triton::uint8> opcodes;
+
+        //! The pre-decoded instructions of the block.
+        std::vector<triton::arch::Instruction> instructions;
+
+      public:
+        //! Constructor.
+        BasicBlock();
+
+        //! Constructor.
+        BasicBlock(triton::uint64 addr);
+
+        //! Constructor by copy.
+        BasicBlock(const BasicBlock& other);
+
+        //! Destructor.
+        ~BasicBlock();
+
+        //! Copies a BasicBlock.
+        void operator=(const BasicBlock& other);
+
+        //! Returns the start address of the block.
+        triton::uint64 getAddress(void) const;
+
+        //! Returns the address of the next instruction after the block.
+        triton::uint64 getNextAddress(void) const;
+
+        //! Returns the size (in bytes) of the block.
+        triton::usize getSize(void) const;
+
+        //! Returns the opcodes of the block.
+        const std::vector<triton::uint8>& getOpcodes(void) const;
+
+        //! Returns the pre-decoded instructions of the block.
+        const std::vector<triton::arch::Instruction>& getInstructions(void) const;
+
+        //! Returns true if the block does not contain any instruction.
+        bool isEmpty(void) const;
+
+        //! Returns true if the block ends on a control flow instruction (i.e. it has not been cut short by the end of the decoded area).
+        bool isComplete(void) const;
+
+        //! Returns true if the block has been decoded from the same opcodes than `area`. A block which is not complete only matches an area of the same size.
+        bool isSameOpcodes(const triton::uint8* area, triton::usize size) const;
+
+        //! Adds a disassembled instruction at the end of the block.
+        void addInstruction(const triton::arch::Instruction& inst);
+
+        //! Sets the start address of the block.
+        void setAddress(triton::uint64 addr);
+
+        //! Clears the block.
+        void clear(void);
+    };
+
+    //! Displays a BasicBlock.
+    std::ostream& operator<<(std::ostream& stream, const BasicBlock& block);
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_BASICBLOCK_H */
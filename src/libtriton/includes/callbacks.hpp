@@ -11,6 +11,7 @@
 #include <list>
 
 #include "ast.hpp"
+#include "instruction.hpp"
 #include "register.hpp"
 #include "memoryAccess.hpp"
 #include "tritonTypes.hpp"
@@ -41,6 +42,7 @@ namespace triton {
       GET_CONCRETE_MEMORY_VALUE,    /*!< Get concrete memory value callback */
       GET_CONCRETE_REGISTER_VALUE,  /*!< Get concrete register value callback */
       SYMBOLIC_SIMPLIFICATION,      /*!< Symbolic simplification callback */
+      SYSCALL,                      /*!< Syscall callback */
     };
 
     /*! \brief The prototype of a GET_CONCRETE_MEMORY_VALUE callback.
@@ -64,6 +66,14 @@ namespace triton {
      */
     typedef triton::ast::AbstractNode* (*symbolicSimplificationCallback)(triton::ast::AbstractNode* node);
 
+    /*! \brief The prototype of a SYSCALL callback.
+     *
+     * \description The callback takes as unique argument the processed syscall instruction. Callbacks will be
+     * called by triton::API::emulate() each time that a syscall is executed and may emulate it by updating the
+     * concrete state. The emulation goes on only if all callbacks return true.
+     */
+    typedef bool (*syscallCallback)(triton::arch::Instruction& inst);
+
     //! \class Callbacks
     /*! \brief The callbacks class */
     class Callbacks {
@@ -77,6 +87,9 @@ namespace triton {
 
         //! [python] Callbacks for all symbolic simplifications.
         std::list<PyObject*> pySymbolicSimplificationCallbacks;
+
+        //! [python] Callbacks for all syscalls.
+        std::list<PyObject*> pySyscallCallbacks;
         #endif
 
         //! [c++] Callbacks for all concrete memory needs.
@@ -88,6 +101,9 @@ namespace triton {
         //! [c++] Callbacks for all symbolic simplifications.
         std::list<triton::callbacks::symbolicSimplificationCallback> symbolicSimplificationCallbacks;
 
+        //! [c++] Callbacks for all syscalls.
+        std::list<triton::callbacks::syscallCallback> syscallCallbacks;
+
         //! Returns the number of callbacks recorded.
         triton::usize countCallbacks(void) const;
 
@@ -116,6 +132,9 @@ namespace triton {
         //! Adds a SYMBOLIC_SIMPLIFICATION callback.
         void addCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! Adds a SYSCALL callback.
+        void addCallback(triton::callbacks::syscallCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
         //! Adds a python callback.
         void addCallback(PyObject* function, triton::callbacks::callback_e kind);
@@ -133,11 +152,17 @@ namespace triton {
         //! Deletes a SYMBOLIC_SIMPLIFICATION callback.
         void removeCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! Deletes a SYSCALL callback.
+        void removeCallback(triton::callbacks::syscallCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
         //! Deletes a python callback according to its kind.
         void removeCallback(PyObject* function, triton::callbacks::callback_e kind);
         #endif
 
+        //! Returns true if there is at least one SYMBOLIC_SIMPLIFICATION callback.
+        bool isSymbolicSimplificationDefined(void) const;
+
         //! Processes callbacks according to the kind and the C++ polymorphism.
         triton::ast::AbstractNode* processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const;
 
@@ -146,6 +171,9 @@ namespace triton {
 
         //! Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const;
+
+        //! Processes callbacks according to the kind and the C++ polymorphism. Returns false if a callback has returned false.
+        bool processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Instruction& inst) const;
     };
 
   /*! @} End of callbacks namespace */
@@ -85,6 +85,9 @@ namespace triton {
         */
         virtual std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> getRegisterInformation(triton::uint32 reg) const = 0;
 
+        //! Returns the specification of a register id.
+        virtual triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 reg) const = 0;
+
         //! Returns all registers.
         virtual std::set<triton::arch::Register*> getAllRegisters(void) const = 0;
 
@@ -106,6 +109,9 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         virtual std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const = 0;
 
+        //! Copies the concrete value of a memory area into `area`, which must hold `size` bytes.
+        virtual void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const = 0;
+
         //! Returns the concrete value of a register.
         virtual triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const = 0;
 
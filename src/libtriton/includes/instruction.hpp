@@ -208,6 +208,9 @@ namespace triton {
         //! Sets the taint of the instruction based on its expressions.
         void setTaint(void);
 
+        //! Sets the taint of the instruction.
+        void setTaint(bool flag);
+
         //! Records an instruction context for a memory access.
         void updateContext(const triton::arch::MemoryAccess& mem);
 
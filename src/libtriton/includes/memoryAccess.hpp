@@ -32,6 +32,37 @@ namespace triton {
    *  @{
    */
 
+    /*! \struct LeaDescriptor
+     *  \brief The compact and trivially copyable description of the LEA of a memory access.
+     *
+     *  \description Registers are kept by id and their values are read from the CPU when the
+     *  address is computed. The Register and Immediate returned by the MemoryAccess LEA getters
+     *  are views built on demand from this descriptor.
+     */
+    struct LeaDescriptor {
+      //! The segment register id.
+      triton::uint32 segment;
+
+      //! The base register id.
+      triton::uint32 base;
+
+      //! The index register id.
+      triton::uint32 index;
+
+      //! The size (in bytes) of the displacement, 0 if there is no displacement.
+      triton::uint32 displacementSize;
+
+      //! The displacement value.
+      triton::uint64 displacement;
+
+      //! The size (in bytes) of the scale, 0 if there is no scale.
+      triton::uint32 scaleSize;
+
+      //! The scale value.
+      triton::uint64 scale;
+    };
+
+
     /*! \class MemoryAccess
      *  \brief This class is used to represent a memory access.
      */
@@ -50,20 +81,8 @@ namespace triton {
         //! Contains the pc relative if it exists.
         triton::uint64 pcRelative;
 
-        //! LEA - If the operand has a segment register, this attribute is filled.
-        triton::arch::Register segmentReg;
-
-        //! LEA - If the operand has a base register, this attribute is filled.
-        triton::arch::Register baseReg;
-
-        //! LEA - If the operand has an index register, this attribute is filled.
-        triton::arch::Register indexReg;
-
-        //! LEA - If the operand has a displacement, this attribute is filled.
-        triton::arch::Immediate displacement;
-
-        //! LEA - If the operand has a scale, this attribute is filled.
-        triton::arch::Immediate scale;
+        //! LEA - The segment, base and index registers, the displacement and the scale of the operand.
+        triton::arch::LeaDescriptor lea;
 
         //! The AST of the memory access.
         triton::ast::AbstractNode* ast;
@@ -71,6 +90,9 @@ namespace triton {
         //! Copy a MemoryAccess.
         void copy(const MemoryAccess& other);
 
+        //! Clears the LEA description.
+        void clearLea(void);
+
       private:
         //! LEA - Returns the base register value.
         triton::uint64 getBaseValue(void);
@@ -109,6 +131,9 @@ namespace triton {
         //! Initialize the address of the memory.
         void initAddress(void);
 
+        //! Initializes the address of the memory from the concrete values of its registers, without building the LEA AST.
+        void initConcreteAddress(void);
+
         //! Returns the AST of the memory access (LEA).
         triton::ast::AbstractNode* getLeaAst(void) const;
 
@@ -137,34 +162,34 @@ namespace triton {
         triton::uint32 getType(void) const;
 
         //! LEA - Returns the segment register operand.
-        triton::arch::Register& getSegmentRegister(void);
+        triton::arch::Register getSegmentRegister(void) const;
 
         //! LEA - Returns the base register operand.
-        triton::arch::Register& getBaseRegister(void);
+        triton::arch::Register getBaseRegister(void) const;
 
         //! LEA - Returns the index register operand.
-        triton::arch::Register& getIndexRegister(void);
+        triton::arch::Register getIndexRegister(void) const;
 
         //! LEA - Returns the displacement operand.
-        triton::arch::Immediate& getDisplacement(void);
+        triton::arch::Immediate getDisplacement(void) const;
 
         //! LEA - Returns the scale operand.
-        triton::arch::Immediate& getScale(void);
+        triton::arch::Immediate getScale(void) const;
 
         //! LEA - Returns the segment register operand.
-        const triton::arch::Register& getConstSegmentRegister(void) const;
+        triton::arch::Register getConstSegmentRegister(void) const;
 
         //! LEA - Returns the base register operand.
-        const triton::arch::Register& getConstBaseRegister(void) const;
+        triton::arch::Register getConstBaseRegister(void) const;
 
         //! LEA - Returns the index register operand.
-        const triton::arch::Register& getConstIndexRegister(void) const;
+        triton::arch::Register getConstIndexRegister(void) const;
 
         //! LEA - Returns the displacement operand.
-        const triton::arch::Immediate& getConstDisplacement(void) const;
+        triton::arch::Immediate getConstDisplacement(void) const;
 
         //! LEA - Returns the scale operand.
-        const triton::arch::Immediate& getConstScale(void) const;
+        triton::arch::Immediate getConstScale(void) const;
 
         //! True if this concrete memory value is trusted and synchronized with the real MMU value.
         bool isTrusted(void) const;
@@ -185,19 +210,22 @@ namespace triton {
         void setPcRelative(triton::uint64 addr);
 
         //! LEA - Sets the segment register operand.
-        void setSegmentRegister(triton::arch::Register& segment);
+        void setSegmentRegister(const triton::arch::Register& segment);
 
         //! LEA - Sets the base register operand.
-        void setBaseRegister(triton::arch::Register& base);
+        void setBaseRegister(const triton::arch::Register& base);
 
         //! LEA - Sets the index register operand.
-        void setIndexRegister(triton::arch::Register& index);
+        void setIndexRegister(const triton::arch::Register& index);
 
         //! LEA - Sets the displacement operand.
-        void setDisplacement(triton::arch::Immediate& displacement);
+        void setDisplacement(const triton::arch::Immediate& displacement);
 
         //! LEA - Sets the scale operand.
-        void setScale(triton::arch::Immediate& scale);
+        void setScale(const triton::arch::Immediate& scale);
+
+        //! LEA - Returns the compact description of the LEA.
+        const triton::arch::LeaDescriptor& getLeaDescriptor(void) const;
 
         //! Copies a MemoryAccess.
         void operator=(const MemoryAccess& other);
@@ -12,6 +12,7 @@
 #define TRITON_PYOBJECT_H
 
 #include "ast.hpp"
+#include "astBytecode.hpp"
 #include "bitsVector.hpp"
 #include "elf.hpp"
 #include "elfDynamicTable.hpp"
@@ -55,6 +56,9 @@ namespace triton {
      *  @{
      */
 
+      //! Creates the AstBytecode python class.
+      PyObject* PyAstBytecode(const triton::ast::AstBytecode& bytecode);
+
       //! Creates the AstNode python class.
       PyObject* PyAstNode(triton::ast::AbstractNode* node);
 
@@ -121,6 +125,20 @@ namespace triton {
       //! Creates the SymbolicVariable python class.
       PyObject* PySymbolicVariable(triton::engines::symbolic::SymbolicVariable* symVar);
 
+      //! Creates the View python class over a container of the engines (see view_e).
+      PyObject* PyView(triton::uint32 kind);
+
+      /* AstBytecode ==================================================== */
+
+      //! pyAstBytecode object.
+      typedef struct {
+        PyObject_HEAD
+        triton::ast::AstBytecode* bytecode;
+      } AstBytecode_Object;
+
+      //! pyAstBytecode type.
+      extern PyTypeObject AstBytecode_Type;
+
       /* AstNode ======================================================== */
 
       //! pyAstNode object.
@@ -309,6 +327,43 @@ namespace triton {
       //! pySymbolicVariable type.
       extern PyTypeObject SymbolicVariable_Type;
 
+      /* View =========================================================== */
+
+      //! The containers behind a pyView object.
+      enum view_e {
+        VIEW_SYMBOLIC_EXPRESSIONS = 0, //!< {id : SymbolicExpression}
+        VIEW_SYMBOLIC_MEMORY,          //!< {address : SymbolicExpression}
+        VIEW_SYMBOLIC_VARIABLES,       //!< {id : SymbolicVariable}
+        VIEW_TAINTED_MEMORY,           //!< [address]
+      };
+
+      //! The items returned by a pyView iterator.
+      enum view_items_e {
+        VIEW_KEYS = 0,  //!< The keys.
+        VIEW_VALUES,    //!< The items.
+        VIEW_ITEMS,     //!< The (key, item) tuples.
+      };
+
+      //! pyView object, also used by its iterators.
+      typedef struct {
+        PyObject_HEAD
+        triton::uint32 kind;      //!< The container (view_e).
+        triton::uint64 start;     //!< The first key.
+        triton::uint64 last;      //!< The last key (inclusive).
+        bool byKind;              //!< True if only the items of `symKind` are kept.
+        triton::uint32 symKind;   //!< The kind of symbolic expression or variable kept.
+        bool tainted;             //!< True if only the tainted symbolic expressions are kept.
+        triton::uint32 items;     //!< The items returned by an iterator (view_items_e).
+        triton::uint64 cursor;    //!< The next key of an iterator.
+        bool exhausted;           //!< True if an iterator has ended.
+      } View_Object;
+
+      //! pyView type.
+      extern PyTypeObject View_Type;
+
+      //! pyView iterator type.
+      extern PyTypeObject ViewIterator_Type;
+
     /*! @} End of python namespace */
     };
   /*! @} End of bindings namespace */
@@ -317,6 +372,12 @@ namespace triton {
 };
 
 
+/*! Checks if the pyObject is a triton::ast::AstBytecode. */
+#define PyAstBytecode_Check(v) ((v)->ob_type == &triton::bindings::python::AstBytecode_Type)
+
+/*! Returns the triton::ast::AstBytecode. */
+#define PyAstBytecode_AsAstBytecode(v) (((triton::bindings::python::AstBytecode_Object*)(v))->bytecode)
+
 /*! Returns the triton::ast::AbstractNode. */
 #define PyAstNode_AsAstNode(v) (((triton::bindings::python::AstNode_Object*)(v))->node)
 
@@ -422,5 +483,8 @@ namespace triton {
 /*! Returns the triton::engines::symbolic::SymbolicVariable. */
 #define PySymbolicVariable_AsSymbolicVariable(v) (((triton::bindings::python::SymbolicVariable_Object*)(v))->symVar)
 
+/*! Checks if the pyObject is a View. */
+#define PyView_Check(v) ((v)->ob_type == &triton::bindings::python::View_Type)
+
 #endif /* TRITON_PYOBJECT_H */
 #endif /* TRITON_PYTHON_BINDINGS */
@@ -75,13 +75,13 @@ namespace triton {
       PyObject* PyLong_FromUint64(triton::uint64 value);
 
       //! Returns a pyObject from a triton::uint128.
-      PyObject* PyLong_FromUint128(triton::uint128 value);
+      PyObject* PyLong_FromUint128(const triton::uint128& value);
 
       //! Returns a pyObject from a triton::uint256.
-      PyObject* PyLong_FromUint256(triton::uint256 value);
+      PyObject* PyLong_FromUint256(const triton::uint256& value);
 
       //! Returns a pyObject from a triton::uint512.
-      PyObject* PyLong_FromUint512(triton::uint512 value);
+      PyObject* PyLong_FromUint512(const triton::uint512& value);
 
     /*! @} End of python namespace */
     };
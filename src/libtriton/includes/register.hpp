@@ -33,14 +33,35 @@ namespace triton {
    *  @{
    */
 
+    /*! \struct RegisterSpecification
+     *  \brief The compact and trivially copyable specification of a register.
+     *
+     *  \description Register specifications are provided by the CPU from a static table, so
+     *  building a Register does not allocate anything. The name points into this table.
+     */
+    struct RegisterSpecification {
+      //! The name of the register.
+      const char* name;
+
+      //! The highest bit of the register.
+      triton::uint32 high;
+
+      //! The lower bit of the register.
+      triton::uint32 low;
+
+      //! The parent id of the register.
+      triton::uint32 parent;
+    };
+
+
     /*! \class Register
      *  \brief This class is used when an instruction has a register operand.
      */
     class Register : public BitsVector, public OperandInterface {
 
       protected:
-        //! The name of the register.
-        std::string name;
+        //! The name of the register (points into the static specification table of the CPU).
+        const char* name;
 
         //! The id of the register.
         triton::uint32 id;
@@ -0,0 +1,129 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SEMANTICSTEMPLATE_H
+#define TRITON_SEMANTICSTEMPLATE_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "astEnums.hpp"
+#include "instruction.hpp"
+#include "register.hpp"
+#include "symbolicEnums.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Triton namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class SemanticsTemplate
+     *  \brief This class is used to represent the semantics of an instruction built once at a given address.
+     *
+     *  \description The ASTs built by the semantics of an instruction only depend on its opcodes and on the
+     *  registers it reads. A template keeps these ASTs as a flat list of nodes where the registers read are
+     *  inputs and where the references between the expressions of the instruction are indexes. Instantiating
+     *  a template reads its inputs again and rebuilds the expressions, without going through the semantics.
+     *  The instructions which access the memory cannot be recorded.
+     */
+    class SemanticsTemplate {
+
+      protected:
+        //! A node of the template. The childs are indexes of previous nodes.
+        struct TemplateNode {
+          //! The kind of the node, UNDEFINED_NODE for an input and REFERENCE_NODE for an expression of the instruction.
+          enum triton::ast::kind_e kind;
+
+          //! The childs of an operator.
+          std::vector<triton::uint32> childs;
+
+          //! The value of a bitvector or of a decimal, or the index of an input or of an expression.
+          triton::uint512 value;
+
+          //! The size of a bitvector.
+          triton::uint32 size;
+
+          //! True if the node depends on an input or on an expression.
+          bool dependent;
+        };
+
+        //! An expression of the template.
+        struct TemplateExpression {
+          //! The kind of the expression (REG or UNDEF).
+          enum triton::engines::symbolic::symkind_e kind;
+
+          //! The register written by a REG expression.
+          triton::arch::Register reg;
+
+          //! The node written.
+          triton::uint32 root;
+
+          //! The comment of the expression.
+          std::string comment;
+        };
+
+        //! The opcodes of the instruction.
+        std::vector<triton::uint8> opcodes;
+
+        //! The registers read by the instruction.
+        std::vector<triton::arch::Register> inputs;
+
+        //! The nodes of all the expressions.
+        std::vector<TemplateNode> nodes;
+
+        //! The expressions in the order of the semantics.
+        std::vector<TemplateExpression> expressions;
+
+        //! Adds the nodes of an AST which are not indexed yet and sets the root of the expression. Returns false if a node cannot be rebuilt.
+        bool addNodes(triton::ast::AbstractNode* root, std::unordered_map<triton::ast::AbstractNode*, triton::uint32>& indexes, const std::unordered_map<triton::usize, triton::uint32>& ids, TemplateExpression& expr);
+
+      public:
+        //! Constructor.
+        SemanticsTemplate();
+
+        //! Constructor by copy.
+        SemanticsTemplate(const SemanticsTemplate& other);
+
+        //! Destructor.
+        ~SemanticsTemplate();
+
+        //! Copies a SemanticsTemplate.
+        void operator=(const SemanticsTemplate& other);
+
+        //! Returns true if the template holds the semantics of the instruction's opcodes.
+        bool isSameOpcodes(const triton::arch::Instruction& inst) const;
+
+        //! Records the semantics just built for an instruction. Returns false if they cannot be instantiated again.
+        bool record(const triton::arch::Instruction& inst);
+
+        //! Builds the expressions of the template for an instruction. The instruction must not have expressions.
+        void instantiate(triton::arch::Instruction& inst) const;
+
+        //! Sets the taint of the expressions instantiated for an instruction, once the taint is spread.
+        void setTaint(triton::arch::Instruction& inst) const;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SEMANTICSTEMPLATE_H */
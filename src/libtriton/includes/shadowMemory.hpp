@@ -0,0 +1,136 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SHADOWMEMORY_H
+#define TRITON_SHADOWMEMORY_H
+
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! The number of bytes covered by a shadow page.
+      const triton::uint64 SHADOW_PAGE_SIZE = 0x1000;
+
+      //! The number of 64-bit words of a shadow page bitmap.
+      const triton::uint32 SHADOW_PAGE_WORDS = SHADOW_PAGE_SIZE / 64;
+
+      /*! \class ShadowPage
+          \brief A bitmap of one bit per byte for a 4 KiB page. */
+      class ShadowPage {
+        public:
+          //! The bitmap of the page.
+          triton::uint64 words[SHADOW_PAGE_WORDS];
+
+          //! The number of bits set in the page.
+          triton::uint32 count;
+
+          //! Constructor.
+          ShadowPage();
+      };
+
+      /*! \class ShadowMemory
+          \brief A paged shadow memory which holds one bit per byte.
+
+          \description Pages are allocated on the first set and released when they
+          become empty. Accesses are processed by chunks of 64 bits, so checking
+          or spreading an access of 64 bytes costs a couple of word operations.
+      */
+      class ShadowMemory {
+
+        protected:
+          //! The allocated pages indexed by page number.
+          std::unordered_map<triton::uint64, ShadowPage> pages;
+
+          //! The number of bits set in the whole shadow memory.
+          triton::usize count;
+
+          //! The ordered numbers of the allocated pages, used by the range queries.
+          std::set<triton::uint64> allocated;
+
+          //! Applies `bits` on the chunk [addr:n] (n <= 64 and the chunk must not cross a word). If `assign` is true the chunk is replaced, otherwise it is or-ed.
+          void writeChunk(triton::uint64 addr, triton::uint32 n, triton::uint64 bits, bool assign);
+
+          //! Returns the bits of the chunk [addr:n] (n <= 64 and the chunk must not cross a word).
+          triton::uint64 readChunk(triton::uint64 addr, triton::uint32 n) const;
+
+          //! Returns the size of the chunk starting at `addr` which stays inside a word.
+          triton::uint32 chunkSize(triton::uint64 addr, triton::usize size) const;
+
+        public:
+          //! Constructor.
+          ShadowMemory();
+
+          //! Returns true if at least one byte of [addr:size] is set.
+          bool isSet(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Sets all bytes of [addr:size].
+          void set(triton::uint64 addr, triton::usize size=1);
+
+          //! Clears all bytes of [addr:size].
+          void unset(triton::uint64 addr, triton::usize size=1);
+
+          //! Sets the bytes of [dst:size] for which the byte of [src:size] is set. Returns true if at least one byte is set.
+          bool unionArea(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Copies the bits of [src:size] into [dst:size].
+          void assignArea(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Returns the number of bytes set.
+          triton::usize size(void) const;
+
+          //! Returns all addresses set.
+          std::set<triton::uint64> getAddresses(void) const;
+
+          //! Returns the number of bytes set in [start:last] (`last` is included).
+          triton::usize size(triton::uint64 start, triton::uint64 last) const;
+
+          //! Returns the runs of bytes set in [start:last] (`last` is included) as (address, length) pairs.
+          std::vector<std::pair<triton::uint64, triton::usize>> getRanges(triton::uint64 start, triton::uint64 last) const;
+
+          //! Looks for the first byte set at or after `addr`. Returns false if there is none, otherwise `found` is set.
+          bool findNext(triton::uint64 addr, triton::uint64& found) const;
+
+          //! Clears the whole shadow memory.
+          void clear(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SHADOWMEMORY_H */
@@ -0,0 +1,190 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SIMPLIFICATIONRULES_H
+#define TRITON_SIMPLIFICATIONRULES_H
+
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ast.hpp"
+#include "callbacks.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! The name of the function exported by a simplification plugin.
+      const char SIMPLIFICATION_PLUGIN_ENTRY[] = "tritonSimplificationPlugin";
+
+      //! Defines the maximum number of rewrites chained on a same node.
+      const triton::uint32 SIMPLIFICATION_MAX_REWRITES = 32;
+
+      class SimplificationRules;
+
+      //! The signature of the function exported by a simplification plugin.
+      typedef void (*simplificationPluginEntry)(SimplificationRules* rules);
+
+      /*! \class SimplificationPattern
+          \brief A side of a rewrite rule. */
+      class SimplificationPattern {
+        public:
+          //! The kinds of pattern.
+          enum pattern_e {
+            PATTERN_CONSTANT = 0, /*!< An integer, `5`, `-1` or `(_ bv5 8)` */
+            PATTERN_NODE,         /*!< An operator, `(bvadd a b)` */
+            PATTERN_VARIABLE,     /*!< A pattern variable, `a` */
+          };
+
+          //! The kind of pattern.
+          enum pattern_e type;
+
+          //! The kind of node if the pattern is an operator.
+          enum triton::ast::kind_e kind;
+
+          //! The parameters of an indexed operator, `((_ extract 7 0) a)`.
+          std::vector<triton::uint32> parameters;
+
+          //! The operands if the pattern is an operator.
+          std::vector<SimplificationPattern> childs;
+
+          //! The value if the pattern is a constant. Negative constants are stored as their two's complement on 512 bits.
+          triton::uint512 value;
+
+          //! The size if the pattern is a constant, 0 if it fits any size.
+          triton::uint32 size;
+
+          //! The index of the pattern variable.
+          triton::uint32 variable;
+
+          //! Constructor.
+          SimplificationPattern();
+      };
+
+      /*! \class SimplificationRule
+          \brief A rewrite rule, `lhs -> rhs`. */
+      class SimplificationRule {
+        public:
+          //! The text of the rule.
+          std::string text;
+
+          //! The pattern matched.
+          SimplificationPattern lhs;
+
+          //! The pattern built.
+          SimplificationPattern rhs;
+
+          //! The names of the pattern variables.
+          std::vector<std::string> variables;
+      };
+
+      /*! \class SimplificationRules
+          \brief The native rule engine of the simplification passes.
+
+          \description Rules are written with the SMT2-Lib syntax of Triton's AST, like
+          `(bvor (bvand a (bvnot b)) (bvand (bvnot a) b)) -> (bvxor a b)`, or registered as C++
+          functions. They are applied bottom-up on every node of an expression, each node being
+          visited once per simplification.
+      */
+      class SimplificationRules {
+
+        protected:
+          //! The rewrite rules.
+          std::vector<SimplificationRule> rules;
+
+          //! The indexes of the rewrite rules according to the kind of their root.
+          std::map<triton::uint32, std::vector<triton::usize>> rulesByKind;
+
+          //! The native rules.
+          std::list<triton::callbacks::symbolicSimplificationCallback> nativeRules;
+
+          //! Returns true if the pattern matches the node. Bounded variables are kept in `bindings`.
+          bool match(const SimplificationPattern& pattern, triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& bindings) const;
+
+          //! Builds a node from a pattern. `size` is the size of the constants without a defined size.
+          triton::ast::AbstractNode* build(const SimplificationPattern& pattern, const std::vector<triton::ast::AbstractNode*>& bindings, triton::uint32 size) const;
+
+          //! Applies the first rule which matches the node. Returns the node if no rule matches.
+          triton::ast::AbstractNode* rewrite(triton::ast::AbstractNode* node) const;
+
+          //! Simplifies a node whose childs have not been visited yet.
+          triton::ast::AbstractNode* visit(triton::ast::AbstractNode* node, std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& cache, triton::uint32 depth) const;
+
+        public:
+          //! Constructor.
+          SimplificationRules();
+
+          //! Constructor by copy.
+          SimplificationRules(const SimplificationRules& copy);
+
+          //! Destructor.
+          ~SimplificationRules();
+
+          //! Copies a SimplificationRules.
+          void copy(const SimplificationRules& other);
+
+          //! Returns true if there is no rule.
+          bool isEmpty(void) const;
+
+          //! Parses and adds a rewrite rule.
+          void addRule(const std::string& rule);
+
+          //! Adds a native rule. The callback returns its argument if it does not apply.
+          void addRule(triton::callbacks::symbolicSimplificationCallback cb);
+
+          //! Loads the rewrite rules of a file, one rule per line. Returns the number of rules loaded.
+          triton::usize loadRules(const std::string& path);
+
+          //! Loads a shared object and calls its `tritonSimplificationPlugin` function. The shared object is never unloaded.
+          void loadPlugin(const std::string& path);
+
+          //! Returns the text of the rewrite rules.
+          std::vector<std::string> getRules(void) const;
+
+          //! Removes all rules.
+          void clear(void);
+
+          //! Applies the rules on the whole tree. Returns the simplified node.
+          triton::ast::AbstractNode* apply(triton::ast::AbstractNode* node) const;
+
+          //! Copies a SimplificationRules.
+          void operator=(const SimplificationRules& other);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SIMPLIFICATIONRULES_H */
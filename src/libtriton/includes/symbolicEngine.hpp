@@ -8,8 +8,10 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
+#include <istream>
 #include <list>
 #include <map>
+#include <ostream>
 #include <string>
 
 #include "ast.hpp"
@@ -19,6 +21,7 @@
 #include "register.hpp"
 #include "symbolicEnums.hpp"
 #include "symbolicExpression.hpp"
+#include "astFolding.hpp"
 #include "symbolicOptimization.hpp"
 #include "symbolicSimplification.hpp"
 #include "symbolicVariable.hpp"
@@ -53,6 +56,7 @@ namespace triton {
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
         : public triton::ast::AstDictionaries,
+          public triton::ast::AstFolding,
           public triton::engines::symbolic::SymbolicOptimization,
           public triton::engines::symbolic::SymbolicSimplification,
           public triton::engines::symbolic::PathManager {
@@ -74,6 +78,9 @@ namespace triton {
           //! Symbolic variables id.
           triton::usize uniqueSymVarId;
 
+          //! The id of the first symbolic expression not folded by `foldSymbolicExpressions()`.
+          triton::usize foldedSymExprId;
+
           /*! \brief The map of symbolic variables
            *
            * \description
@@ -117,6 +124,9 @@ namespace triton {
           //! Removes the symbolic expression corresponding to the id.
           void removeSymbolicExpression(triton::usize symExprId);
 
+          //! Folds the symbolic expressions created since the last call. Returns the number of expressions changed.
+          triton::usize foldSymbolicExpressions(void);
+
           //! Adds an aligned entry.
           void addAlignedMemory(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node);
 
@@ -159,6 +169,9 @@ namespace triton {
           //! Returns the map (addr:expr) of all symbolic memory defined.
           std::map<triton::uint64, SymbolicExpression*> getSymbolicMemory(void) const;
 
+          //! Returns the map (addr:id) of all symbolic memory defined, without copy.
+          const std::map<triton::uint64, triton::usize>& getSymbolicMemoryReferences(void) const;
+
           //! Returns the symbolic expression id corresponding to the register.
           triton::usize getSymbolicRegisterId(const triton::arch::Register& reg) const;
 
@@ -216,7 +229,7 @@ namespace triton {
           //! Assigns a symbolic expression to a memory.
           void assignSymbolicExpressionToMemory(SymbolicExpression *se, const triton::arch::MemoryAccess& mem);
 
-          //! Returns the full AST of a root node.
+          //! Returns the full AST of a root node. The ids of the references replaced are added into `processed`.
           triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed);
 
           //! Returns the list of the tainted symbolic expressions.
@@ -249,6 +262,12 @@ namespace triton {
           //! Concretizes a specific symbolic register reference.
           void concretizeRegister(const triton::arch::Register& reg);
 
+          //! Writes the symbolic state (variables, expressions, register and memory references, path constraints) into a binary file.
+          void saveSymbolicState(std::ostream& stream) const;
+
+          //! Replaces the symbolic state by the one written by `saveSymbolicState()`. The architecture must be the same.
+          void loadSymbolicState(std::istream& stream);
+
           //! Enables or disables the symbolic execution engine.
           void enable(bool flag);
 
@@ -54,10 +54,16 @@ namespace triton {
       //! Enumerates all Kinds of symbolic optimization.
       enum optimization_e {
         ALIGNED_MEMORY,        //!< Keep a map of aligned memory.
+        AST_CANONICALIZATION,  //!< Fold and order the operands of the AST nodes when they are built.
         AST_DICTIONARIES,      //!< Abstract Syntax Tree dictionaries.
+        AST_FOLDING,           //!< Fold the constants and the algebraic identities of new expressions.
+        CONCRETE_FAST_PATH,    //!< Emulate natively the instructions which do not involve symbolized nor tainted inputs.
+        DEAD_FLAGS_ELIMINATION,//!< Remove flag expressions overwritten before being read inside a processed block.
         ONLY_ON_SYMBOLIZED,    //!< Perform symbolic execution only on symbolized expressions.
         ONLY_ON_TAINTED,       //!< Perform symbolic execution only on tainted instructions.
         PC_TRACKING_SYMBOLIC,  //!< Track path constraints only if they are symbolized.
+        SEMANTICS_TEMPLATES,   //!< Cache the decoding of the instructions and rebuild the expressions of an instruction already processed at the same address from a template.
+        TAINT_ONLY,            //!< Only spread the taint through a table of rules, without building ASTs nor updating the concrete state.
       };
 
     /*! @} End of symbolic namespace */
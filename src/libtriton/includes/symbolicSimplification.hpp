@@ -11,6 +11,7 @@
 #include <list>
 
 #include "ast.hpp"
+#include "simplificationRules.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -46,6 +47,9 @@ namespace triton {
           //! Flag to define if we can use z3 to simplify expressions. Default: false.
           bool z3Enabled;
 
+          //! The native rules applied before the simplification callbacks.
+          triton::engines::symbolic::SimplificationRules rules;
+
         public:
           //! Constructor.
           SymbolicSimplification();
@@ -65,6 +69,9 @@ namespace triton {
           //! Enabled, Triton will use the simplification passes of z3 before to call its recorded simplification passes.
           void enableZ3Simplification(bool flag);
 
+          //! Returns the native simplification rules.
+          triton::engines::symbolic::SimplificationRules& getSimplificationRules(void);
+
           //! Processes all recorded simplifications. Returns the simplified node.
           triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node, bool z3=false) const;
 
@@ -8,10 +8,19 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <map>
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "instruction.hpp"
 #include "memoryAccess.hpp"
+#include "operandWrapper.hpp"
 #include "register.hpp"
+#include "shadowMemory.hpp"
+#include "taintLabels.hpp"
+#include "taintProvenance.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -54,15 +63,60 @@ namespace triton {
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::set<triton::uint64> taintedMemory;
+          //! The shadow memory of tainted addresses (one bit per byte).
+          triton::engines::taint::ShadowMemory taintedMemory;
 
-          //! The set of tainted registers. Currently it is an over approximation of the taint.
-          std::set<triton::arch::Register> taintedRegisters;
+          //! The tainted bytes of each parent register (bit `n` is the byte `n`), indexed by register id.
+          std::vector<triton::uint64> taintedRegisters;
+
+          //! Defines if the labeled taint mode is enabled or disabled.
+          bool labelsFlag;
+
+          //! The interned label sets. Mutable as unions are memoized even by queries.
+          mutable triton::engines::taint::TaintLabels labels;
+
+          //! The label set of each labeled byte. Bytes without entry carry the empty set.
+          std::unordered_map<triton::uint64, triton::usize> memoryLabels;
+
+          //! The label set of each labeled parent register, indexed by register id.
+          std::map<triton::uint32, triton::usize> registerLabels;
+
+          //! Defines if the provenance recorder is enabled or disabled.
+          bool provenanceFlag;
+
+          //! The provenance graph of the taint.
+          triton::engines::taint::TaintProvenance provenance;
 
           //! Copies a TaintEngine.
           void copy(const TaintEngine& other);
 
+          //! Returns the union of the label sets of [addr:size].
+          triton::usize getMemoryLabelSet(triton::uint64 addr, triton::usize size) const;
+
+          //! Returns the label set of a register.
+          triton::usize getRegisterLabelSet(const triton::arch::Register& reg) const;
+
+          //! Replaces the label set of each byte of [addr:size].
+          void setMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::usize set);
+
+          //! Merges a label set into each byte of [addr:size].
+          void mergeMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::usize set);
+
+          //! Replaces the label set of a register.
+          void setRegisterLabelSet(const triton::arch::Register& reg, triton::usize set);
+
+          //! Returns the mask of the bytes covered by a register inside its parent.
+          triton::uint64 getRegisterBytesMask(const triton::arch::Register& reg) const;
+
+          //! Returns the tainted bytes of a parent register.
+          triton::uint64 getRegisterTaint(triton::uint32 parentId) const;
+
+          //! Replaces the tainted bytes of a parent register.
+          void setRegisterTaint(triton::uint32 parentId, triton::uint64 mask);
+
+          //! Spreads `flag` on the bytes written by `reg`. Returns true if other bytes of the parent are still tainted.
+          bool spreadRegister(const triton::arch::Register& reg, bool flag);
+
 
         public:
           //! Returns true if the taint engine is enabled.
@@ -71,11 +125,59 @@ namespace triton {
           //! Enables or disables the taint engine.
           void enable(bool flag);
 
+          //! Returns true if the labeled taint mode is enabled.
+          bool isLabelsEnabled(void) const;
+
+          //! Enables or disables the labeled taint mode. Disabling it drops all labels.
+          void enableLabels(bool flag);
+
+          //! Returns true if the provenance recorder is enabled.
+          bool isProvenanceEnabled(void) const;
+
+          //! Enables or disables the provenance recorder. Enabling it starts a new graph which keeps at most `capacity` events.
+          void enableProvenance(bool flag, triton::usize capacity=TAINT_PROVENANCE_DEFAULT_CAPACITY);
+
+          //! Starts the provenance events of the instruction at `addr`.
+          void enterInstruction(triton::uint64 addr);
+
+          //! Ends the provenance events of the current instruction.
+          void leaveInstruction(void);
+
+          //! Returns the events which have brought the taint to [addr:size], the closest first.
+          std::vector<triton::engines::taint::TaintEvent> getMemoryProvenance(triton::uint64 addr, triton::uint32 size=1) const;
+
+          //! Returns the events which have brought the taint to the memory, the closest first.
+          std::vector<triton::engines::taint::TaintEvent> getMemoryProvenance(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the events which have brought the taint to the register, the closest first.
+          std::vector<triton::engines::taint::TaintEvent> getRegisterProvenance(const triton::arch::Register& reg) const;
+
+          //! Returns the labels which reach [addr:size].
+          std::vector<triton::uint32> getMemoryLabels(triton::uint64 addr, triton::uint32 size=1) const;
+
+          //! Returns the labels which reach the memory.
+          std::vector<triton::uint32> getMemoryLabels(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the labels which reach the register.
+          std::vector<triton::uint32> getRegisterLabels(const triton::arch::Register& reg) const;
+
           //! Returns the tainted addresses.
-          const std::set<triton::uint64>& getTaintedMemory(void) const;
+          std::set<triton::uint64> getTaintedMemory(void) const;
+
+          //! Returns the runs of tainted bytes as (address, length) pairs.
+          std::vector<std::pair<triton::uint64, triton::usize>> getTaintedMemoryRanges(void) const;
 
-          //! Returns the tainted registers.
-          const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
+          //! Returns the runs of tainted bytes inside [start:end) as (address, length) pairs.
+          std::vector<std::pair<triton::uint64, triton::usize>> getTaintedMemoryRanges(triton::uint64 start, triton::uint64 end) const;
+
+          //! Returns the number of tainted bytes inside [start:end).
+          triton::usize countTaintedMemory(triton::uint64 start, triton::uint64 end) const;
+
+          //! Looks for the first tainted byte at or after `addr`. Returns false if there is none, otherwise `found` is set.
+          bool getNextTaintedMemory(triton::uint64 addr, triton::uint64& found) const;
+
+          //! Returns the tainted registers (parent registers with at least one tainted byte).
+          std::set<triton::arch::Register> getTaintedRegisters(void) const;
 
           //! Returns true if the addr is tainted.
           /*!
@@ -110,6 +212,22 @@ namespace triton {
           */
           bool setTaintRegister(const triton::arch::Register& reg, bool flag);
 
+          //! Sets register flag. A tainted register takes the labels of the registers and the memory read by the instruction.
+          /*!
+            \param reg the register operand.
+            \param flag TAINTED or !TAINTED
+            \param inst the instruction which writes the register.
+          */
+          bool setTaintRegister(const triton::arch::Register& reg, bool flag, const triton::arch::Instruction& inst);
+
+          //! Sets register flag. A tainted register takes the labels of the sources.
+          /*!
+            \param reg the register operand.
+            \param flag TAINTED or !TAINTED
+            \param sources the operands from which the register is computed.
+          */
+          bool setTaintRegister(const triton::arch::Register& reg, bool flag, const std::vector<triton::arch::OperandWrapper>& sources);
+
           //! Taints an address.
           /*!
             \param addr the targeted address.
@@ -131,6 +249,30 @@ namespace triton {
           */
           bool taintRegister(const triton::arch::Register& reg);
 
+          //! Taints an address with a label.
+          /*!
+            \param addr the targeted address.
+            \param label the label added to the address (only kept if the labeled mode is enabled).
+            \return TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
+          */
+          bool taintMemory(triton::uint64 addr, triton::uint32 label);
+
+          //! Taints a memory with a label.
+          /*!
+            \param mem the memory access.
+            \param label the label added to the memory (only kept if the labeled mode is enabled).
+            \return TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+          */
+          bool taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+          //! Taints a register with a label.
+          /*!
+            \param reg the register operand.
+            \param label the label added to the register (only kept if the labeled mode is enabled).
+            \return TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+          */
+          bool taintRegister(const triton::arch::Register& reg, triton::uint32 label);
+
           //! Untaints an address.
           /*!
             \param addr the targeted address.
@@ -0,0 +1,94 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTLABELS_H
+#define TRITON_TAINTLABELS_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! Defines the id of the empty label set.
+      const triton::usize EMPTY_LABEL_SET = 0;
+
+      /*! \class TaintLabels
+          \brief The table of interned taint label sets.
+
+          \description Each distinct set of labels is stored once and is referenced by an id,
+          so bytes and registers only carry a `usize`. The union of two sets is memoized, thus
+          spreading the same pair of sets again costs a single lookup.
+      */
+      class TaintLabels {
+
+        protected:
+          //! The interned sets indexed by id. The labels of a set are sorted.
+          std::vector<std::vector<triton::uint32>> sets;
+
+          //! The reverse index of the interned sets.
+          std::map<std::vector<triton::uint32>, triton::usize> index;
+
+          //! The memoized unions. The key is ordered (low id, high id).
+          std::map<std::pair<triton::usize, triton::usize>, triton::usize> unions;
+
+        public:
+          //! Constructor.
+          TaintLabels();
+
+          //! Interns a set of labels and returns its id.
+          triton::usize intern(const std::vector<triton::uint32>& labels);
+
+          //! Returns the id of the set which only contains `label`.
+          triton::usize single(triton::uint32 label);
+
+          //! Returns the id of the union of two sets.
+          triton::usize merge(triton::usize set1, triton::usize set2);
+
+          //! Returns the labels of a set.
+          const std::vector<triton::uint32>& getLabels(triton::usize set) const;
+
+          //! Returns the number of interned sets.
+          triton::usize size(void) const;
+
+          //! Clears the table.
+          void clear(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTLABELS_H */
@@ -0,0 +1,177 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTPROVENANCE_H
+#define TRITON_TAINTPROVENANCE_H
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! Defines the default number of events kept by the provenance recorder.
+      const triton::usize TAINT_PROVENANCE_DEFAULT_CAPACITY = 0x10000;
+
+      //! Defines the maximum number of parents of an event. Other parents are dropped.
+      const triton::uint32 TAINT_PROVENANCE_MAX_PARENTS = 4;
+
+      /*! \class TaintLocation
+          \brief A tainted location: a memory area or a parent register. */
+      class TaintLocation {
+        public:
+          //! True if the location is a register.
+          bool isRegister;
+
+          //! The address of the memory area or the id of the parent register.
+          triton::uint64 value;
+
+          //! The size (in bytes) of the memory area.
+          triton::uint32 size;
+
+          //! Constructor of a memory area.
+          TaintLocation(triton::uint64 addr, triton::uint32 size);
+
+          //! Constructor of a parent register.
+          TaintLocation(triton::uint32 parentId);
+      };
+
+      /*! \class TaintEvent
+          \brief An edge set of the provenance graph: a location has been tainted by an instruction. */
+      class TaintEvent {
+        public:
+          //! The id of the event (starts at 1, 0 means no event).
+          triton::uint64 id;
+
+          //! The address of the instruction which has tainted the location.
+          triton::uint64 address;
+
+          //! The tainted location.
+          TaintLocation location;
+
+          //! The ids of the events which have tainted the sources.
+          triton::uint64 parents[TAINT_PROVENANCE_MAX_PARENTS];
+
+          //! The number of parents.
+          triton::uint32 numberOfParents;
+
+          //! Constructor.
+          TaintEvent();
+      };
+
+      /*! \class TaintProvenance
+          \brief The recorder of the taint provenance graph.
+
+          \description Each spreading of the taint adds an event which links the destination to the events
+          which have tainted its sources. Events are kept in a ring buffer, thus the memory is bounded by the
+          capacity and the oldest events are dropped first. Walking back the graph from a sink gives the
+          instructions which have brought the taint up to it.
+      */
+      class TaintProvenance {
+
+        protected:
+          //! The ring buffer of events. The event `id` lives at `(id - 1) % capacity`. It grows up to the capacity.
+          std::vector<TaintEvent> events;
+
+          //! The maximum number of events kept.
+          triton::usize capacity;
+
+          //! The id of the next event.
+          triton::uint64 nextId;
+
+          //! The last event which has tainted each byte of memory.
+          std::unordered_map<triton::uint64, triton::uint64> memoryWriters;
+
+          //! The last event which has tainted each parent register.
+          std::map<triton::uint32, triton::uint64> registerWriters;
+
+          //! The size of `memoryWriters` which triggers the next purge of the dropped events.
+          triton::usize purgeThreshold;
+
+          //! The address of the current instruction.
+          triton::uint64 address;
+
+          //! The id of the first event of the current instruction, 0 if no instruction is processed.
+          triton::uint64 instructionFirstId;
+
+          //! Adds the last writers of a location to `parents`, up to `limit` parents.
+          void collectWriters(const TaintLocation& loc, std::vector<triton::uint64>& parents, triton::usize limit) const;
+
+          //! Adds an event for `loc` and makes it its last writer.
+          void addEvent(const TaintLocation& loc, const std::vector<triton::uint64>& parents);
+
+          //! Removes the writers which point to dropped events.
+          void purge(void);
+
+        public:
+          //! Constructor.
+          TaintProvenance(triton::usize capacity=TAINT_PROVENANCE_DEFAULT_CAPACITY);
+
+          //! Returns the maximum number of events kept.
+          triton::usize getCapacity(void) const;
+
+          //! Returns true if the event is still in the ring buffer.
+          bool isAlive(triton::uint64 id) const;
+
+          //! Returns an event. The event must be alive.
+          const TaintEvent& getEvent(triton::uint64 id) const;
+
+          //! Starts the events of an instruction.
+          void enterInstruction(triton::uint64 addr);
+
+          //! Ends the events of the current instruction.
+          void leaveInstruction(void);
+
+          //! Records that `dst` has been tainted by `src`. If `keep` is true (union), the last writer of `dst` is also a parent.
+          void spread(const TaintLocation& dst, const TaintLocation& src, bool keep);
+
+          //! Records that `dst` has been tainted without source. Inside an instruction, its parents are the events of this instruction.
+          void introduce(const TaintLocation& dst);
+
+          //! Forgets the last writers of an untainted location.
+          void remove(const TaintLocation& loc);
+
+          //! Walks back the graph from a location and returns the events reached, the closest first.
+          std::vector<TaintEvent> backtrack(const TaintLocation& loc) const;
+
+          //! Clears all events.
+          void clear(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTPROVENANCE_H */
@@ -0,0 +1,101 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEFORMAT_H
+#define TRITON_TRACEFORMAT_H
+
+#include <string>
+#include <vector>
+
+#include "memoryAccess.hpp"
+#include "register.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The execution trace namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \brief The execution trace format
+       *
+       * \description A trace uses the container of the AST serialization (see triton::ast::writeHeader()): the header,
+       * a `SECTION_TRACE` which holds the architecture, then `SECTION_TRACE_BLOCK` sections up to the `SECTION_END`.
+       * A block holds its number of records, the size of its records once decompressed and the compressed records.
+       * Each block is decoded without the previous ones, thus a trace may be split and replayed from any block if the
+       * concrete state is known.
+       *
+       * A record is one executed instruction with the concrete values it needs:
+       *
+       * - its address, as the zigzag difference with the address following the previous record.
+       * - its opcodes, or an empty size if the same opcodes are already recorded at this address in the block.
+       * - the registers given for this record, as their id and the xor with the previous value of this register in the block.
+       * - the memory values it reads, as the zigzag difference with the previous address, the size and the value.
+       *
+       * All integers are LEB128 varints.
+       */
+      const triton::usize TRACE_BLOCK_RECORDS = 4096;
+
+      //! One instruction of an execution trace.
+      struct TraceRecord {
+        //! The address of the instruction.
+        triton::uint64 address;
+
+        //! The opcodes of the instruction.
+        std::vector<triton::uint8> opcodes;
+
+        //! The registers which must be set before the instruction.
+        std::vector<triton::arch::Register> registers;
+
+        //! The memory values read by the instruction.
+        std::vector<triton::arch::MemoryAccess> memory;
+      };
+
+      //! Encodes a signed difference as an unsigned integer (0, -1, 1, -2, ...).
+      inline triton::uint64 zigzag(triton::uint64 to, triton::uint64 from) {
+        triton::uint64 delta = to - from;
+        return (delta << 1) ^ ((delta >> 63) ? 0xffffffffffffffff : 0);
+      }
+
+      //! Decodes a zigzag difference.
+      inline triton::uint64 unzigzag(triton::uint64 value, triton::uint64 from) {
+        return from + ((value >> 1) ^ ((value & 1) ? 0xffffffffffffffff : 0));
+      }
+
+      //! Compresses a block with a LZ77 scheme. The output is given back by decompressBlock().
+      std::string compressBlock(const std::string& input);
+
+      //! Decompresses a block of `size` bytes. Throws an exception if the block is corrupted.
+      std::string decompressBlock(const std::string& input, triton::usize size);
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEFORMAT_H */
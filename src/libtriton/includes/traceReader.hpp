@@ -0,0 +1,102 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEREADER_H
+#define TRITON_TRACEREADER_H
+
+#include <istream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "traceFormat.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The execution trace namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \class TraceReader
+       *  \brief Reads the records of an execution trace written by triton::format::trace::TraceRecorder.
+       *
+       * \description The blocks are read and decompressed one by one, thus a trace is streamed and never
+       * loaded in memory. The registers and the memory accesses of the records need the architecture of the
+       * trace to be defined.
+       */
+      class TraceReader {
+        protected:
+          //! The input stream.
+          std::istream* stream;
+
+          //! The architecture of the trace.
+          triton::uint32 architecture;
+
+          //! True once the end of the trace is read.
+          bool finished;
+
+          //! The records of the current block.
+          std::istringstream block;
+
+          //! The number of records left in the current block.
+          triton::usize blockCount;
+
+          //! The address following the previous record of the block.
+          triton::uint64 nextAddress;
+
+          //! The address of the last memory value of the block.
+          triton::uint64 lastMemoryAddress;
+
+          //! The opcodes read in the block for each address.
+          std::unordered_map<triton::uint64, std::vector<triton::uint8>> blockOpcodes;
+
+          //! The last value read in the block for each register.
+          std::unordered_map<triton::uint32, triton::uint512> blockRegisters;
+
+          //! Reads the next block. Returns false at the end of the trace.
+          bool nextBlock(void);
+
+        public:
+          //! Constructor. Reads the header of the trace.
+          TraceReader(std::istream& stream);
+
+          //! Returns the architecture of the trace (see triton::arch::architectures_e).
+          triton::uint32 getArchitecture(void) const;
+
+          //! Reads the next record. Returns false at the end of the trace.
+          bool next(TraceRecord& record);
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEREADER_H */
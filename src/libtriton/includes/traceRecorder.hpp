@@ -0,0 +1,133 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACERECORDER_H
+#define TRITON_TRACERECORDER_H
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "instruction.hpp"
+#include "memoryAccess.hpp"
+#include "register.hpp"
+#include "traceFormat.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The execution trace namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \class TraceRecorder
+       *  \brief Writes an execution trace (see triton::format::trace::TRACE_BLOCK_RECORDS).
+       *
+       * \description The concrete values of an instruction are given first by addRegisterValue() and addMemoryValue(),
+       * then addInstruction() writes the record. Every given register is written, as the replay may hold another value
+       * than the last one given, thus a front-end only gives the registers which differ from its engine state. The records
+       * are compressed and written block by block, close() writes the last block and the end of the trace.
+       */
+      class TraceRecorder {
+        protected:
+          //! The output stream.
+          std::ostream* stream;
+
+          //! The number of records of a block.
+          triton::usize blockRecords;
+
+          //! The number of recorded instructions.
+          triton::usize numberOfInstructions;
+
+          //! True once the end of the trace is written.
+          bool closed;
+
+          //! The registers of the next record.
+          std::vector<std::pair<triton::uint32, triton::uint512>> pendingRegisters;
+
+          //! The memory values of the next record.
+          std::vector<triton::arch::MemoryAccess> pendingMemory;
+
+          //! The records of the current block.
+          std::ostringstream block;
+
+          //! The number of records of the current block.
+          triton::usize blockCount;
+
+          //! The address expected for the next record of the block.
+          triton::uint64 nextAddress;
+
+          //! The address of the last memory value of the block.
+          triton::uint64 lastMemoryAddress;
+
+          //! The opcodes recorded in the block for each address.
+          std::unordered_map<triton::uint64, std::string> blockOpcodes;
+
+          //! The last value written in the block for each register.
+          std::unordered_map<triton::uint32, triton::uint512> blockRegisters;
+
+          //! Compresses and writes the current block.
+          void flush(void);
+
+        public:
+          //! Constructor. Writes the header of a trace of `arch` (see triton::arch::architectures_e).
+          TraceRecorder(std::ostream& stream, triton::uint32 arch, triton::usize blockRecords=TRACE_BLOCK_RECORDS);
+
+          //! Destructor. Closes the trace if it is not closed.
+          ~TraceRecorder();
+
+          //! Gives the concrete value of a register before the next instruction.
+          void addRegisterValue(const triton::arch::Register& reg);
+
+          //! Gives the concrete value of a register before the next instruction.
+          void addRegisterValue(triton::uint32 regId, triton::uint512 value);
+
+          //! Gives a concrete memory value read by the next instruction.
+          void addMemoryValue(const triton::arch::MemoryAccess& mem);
+
+          //! Records an instruction with the values given since the previous one.
+          void addInstruction(triton::uint64 address, const triton::uint8* opcodes, triton::uint32 size);
+
+          //! Records an instruction with the values given since the previous one.
+          void addInstruction(const triton::arch::Instruction& inst);
+
+          //! Returns the number of recorded instructions.
+          triton::usize getNumberOfInstructions(void) const;
+
+          //! Writes the last block and the end of the trace. Nothing can be recorded after.
+          void close(void);
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACERECORDER_H */
@@ -208,6 +208,7 @@ namespace triton {
           bool isSegment(triton::uint32 regId) const;
 
           std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> getRegisterInformation(triton::uint32 reg) const;
+          triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 reg) const;
           std::set<triton::arch::Register*> getAllRegisters(void) const;
           std::set<triton::arch::Register*> getParentRegisters(void) const;
           triton::uint512 getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks=true) const;
@@ -220,6 +221,7 @@ namespace triton {
           triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const;
           bool buildSemantics(triton::arch::Instruction& inst) const;
           void disassembly(triton::arch::Instruction& inst) const;
+          void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
           void setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value);
           void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values);
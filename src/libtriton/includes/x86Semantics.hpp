@@ -48,6 +48,12 @@ namespace triton {
       //! Builds the semantics of the instruction. Returns true if the instruction is supported.
       bool build(triton::arch::Instruction& inst);
 
+      //! Emulates natively the instruction if all its inputs are concrete. Returns false if the instruction must go through the symbolic semantics.
+      bool buildConcrete(triton::arch::Instruction& inst);
+
+      //! Only spreads the taint of the instruction through the rules table. Returns false if the instruction must go through the symbolic semantics.
+      bool buildTaint(triton::arch::Instruction& inst);
+
 
       /* Semantics ============================================================================= */
 
@@ -262,6 +262,9 @@ namespace triton {
       //! Returns all information about the register from its ID.
       std::tuple<std::string, triton::uint32, triton::uint32, triton::uint32> registerIdToRegisterInformation(triton::uint32 reg);
 
+      //! Returns the specification of the register from its ID.
+      triton::arch::RegisterSpecification registerIdToRegisterSpecification(triton::uint32 reg);
+
       //! Converts a capstone's register id to a triton's register id.
       triton::uint32 capstoneRegisterToTritonRegister(triton::uint32 id);
 
@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <fstream>
+
 #include <pin.H>
 
 /* libTriton */
@@ -236,6 +238,37 @@ namespace tracer {
     }
 
 
+    /* The file of the execution trace */
+    static std::ofstream traceFile;
+
+
+    static PyObject* pintool_recordTrace(PyObject* self, PyObject* path) {
+      /* Check if the architecture is definied */
+      if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        return PyErr_Format(PyExc_TypeError, "tracer::pintool::recordTrace(): Architecture is not defined.");
+
+      if (!PyString_Check(path))
+        return PyErr_Format(PyExc_TypeError, "tracer::pintool::recordTrace(): Expected a string as argument.");
+
+      if (tracer::pintool::context::traceRecorder)
+        return PyErr_Format(PyExc_TypeError, "tracer::pintool::recordTrace(): The trace is already recorded.");
+
+      traceFile.open(PyString_AsString(path), std::ios::out | std::ios::binary | std::ios::trunc);
+      if (!traceFile.is_open())
+        return PyErr_Format(PyExc_TypeError, "tracer::pintool::recordTrace(): Cannot open the file.");
+
+      try {
+        tracer::pintool::context::traceRecorder = new triton::format::trace::TraceRecorder(traceFile, triton::api.getArchitecture());
+      }
+      catch (const std::exception& e) {
+        return PyErr_Format(PyExc_TypeError, "%s", e.what());
+      }
+
+      Py_INCREF(Py_None);
+      return Py_None;
+    }
+
+
     static PyObject* pintool_restoreSnapshot(PyObject* self, PyObject* noarg) {
       tracer::pintool::snapshot.setRestore(true);
       Py_INCREF(Py_None);
@@ -444,6 +477,7 @@ namespace tracer {
       {"getSyscallReturn",          pintool_getSyscallReturn,           METH_O,         ""},
       {"insertCall",                pintool_insertCall,                 METH_VARARGS,   ""},
       {"isSnapshotEnabled",         pintool_isSnapshotEnabled,          METH_NOARGS,    ""},
+      {"recordTrace",               pintool_recordTrace,                METH_O,         ""},
       {"restoreSnapshot",           pintool_restoreSnapshot,            METH_NOARGS,    ""},
       {"runProgram",                pintool_runProgram,                 METH_NOARGS,    ""},
       {"setCurrentMemoryValue",     pintool_setCurrentMemoryValue,      METH_VARARGS,   ""},
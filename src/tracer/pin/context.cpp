@@ -26,6 +26,8 @@ namespace tracer {
       CONTEXT* lastContext    = nullptr;
       bool     mustBeExecuted = false;
 
+      triton::format::trace::TraceRecorder* traceRecorder = nullptr;
+
 
       triton::uint512 getCurrentRegisterValue(triton::arch::Register& reg) {
         triton::uint8 buffer[DQQWORD_SIZE] = {0};
@@ -470,7 +472,16 @@ namespace tracer {
       void needConcreteRegisterValue(triton::arch::Register& reg) {
         triton::uint512 value = tracer::pintool::context::getCurrentRegisterValue(reg);
         reg.setConcreteValue(value);
+
+        /* A value already known by Triton is rebuilt by the replay, it is neither set nor recorded */
+        if (triton::api.getConcreteRegisterValue(reg, false) == value)
+          return;
+
         triton::api.setConcreteRegisterValue(reg);
+
+        /* The values given to Triton are the ones needed to replay the instruction */
+        if (tracer::pintool::context::traceRecorder)
+          tracer::pintool::context::traceRecorder->addRegisterValue(reg);
       }
 
     };
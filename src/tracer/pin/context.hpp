@@ -12,6 +12,7 @@
 
 /* libTriton */
 #include <api.hpp>
+#include <traceRecorder.hpp>
 #include <tritonTypes.hpp>
 
 
@@ -45,6 +46,9 @@ namespace tracer {
       //! True if the context must be executed.
       extern bool mustBeExecuted;
 
+      //! The recorder of the execution trace, nullptr if the trace is not recorded.
+      extern triton::format::trace::TraceRecorder* traceRecorder;
+
       //! Returns the current register value from a Register.
       triton::uint512 getCurrentRegisterValue(triton::arch::Register& reg);
 
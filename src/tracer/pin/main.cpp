@@ -579,6 +579,10 @@ namespace tracer {
       /* Process the IR and taint */
       triton::api.buildSemantics(*tritonInst);
 
+      /* Record the instruction with the concrete values given to Triton */
+      if (tracer::pintool::context::traceRecorder)
+        tracer::pintool::context::traceRecorder->addInstruction(*tritonInst);
+
       /* Execute the Python callback */
       if (tracer::pintool::context::mustBeExecuted == false)
         tracer::pintool::callbacks::before(tritonInst);
@@ -641,6 +645,8 @@ namespace tracer {
       PIN_LockClient();
       triton::uint512 value = tracer::pintool::context::getCurrentMemoryValue(addr, size);
       triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(addr, size, value));
+      if (tracer::pintool::context::traceRecorder && tracer::pintool::analysisTrigger.getState())
+        tracer::pintool::context::traceRecorder->addMemoryValue(triton::arch::MemoryAccess(addr, size, value));
       /* Mutex */
       PIN_UnlockClient();
     }
@@ -711,6 +717,10 @@ namespace tracer {
     static void callbackFini(int, VOID *) {
       /* Execute the Python callback */
       tracer::pintool::callbacks::fini();
+
+      /* Write the last block of the execution trace */
+      if (tracer::pintool::context::traceRecorder)
+        tracer::pintool::context::traceRecorder->close();
     }
 
 